@@ -5,8 +5,13 @@
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 
-// Configuration file path
-#define CONFIG_FILE "/config.json"
+// Configuration file paths
+#define CONFIG_FILE "/config.msgpack"    // MessagePack snapshot; edits since are in the journal (config_journal.h)
+#define CONFIG_LEGACY_FILE "/config.json"  // JSON snapshot of older firmware, converted at first boot
+
+// Write-behind: saveConfiguration() marks the config dirty, the write follows
+#define CONFIG_WRITE_DELAY 3000        // ms of no further changes before writing (coalesces bursts)
+#define CONFIG_WRITE_MAX_DELAY 30000   // ms: written by then even while changes keep coming
 
 // Global configuration document (StaticJsonDocument allocated in .bss, not heap)
 // Increased to 8KB to support 15-20 dynamic module instances
@@ -15,11 +20,12 @@ extern StaticJsonDocument<8192> config;
 // Configuration management functions
 bool initStorage();
 bool loadConfiguration();
-bool saveConfiguration(bool force = false);
+bool saveConfiguration(bool force = false);  // Deferred; force writes now (queued to the writer)
+void maintainConfiguration();                 // Call from loop(): writes a dirty config when due
+bool flushConfiguration();                    // Before ESP.restart(): everything on flash
 void setDefaultConfig();
 
-// Module cache functions
-void updateModuleCache(const char* moduleId, JsonObject data);
+// Module cache functions (readings live in readings_store.h)
 bool isCacheStale(const char* moduleId);
 unsigned long getCacheAge(const char* moduleId);
 
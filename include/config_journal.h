@@ -0,0 +1,126 @@
+#ifndef CONFIG_JOURNAL_H
+#define CONFIG_JOURNAL_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <map>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#define CONFIG_JOURNAL_FILE "/config.jnl"
+#define CONFIG_TEMP_FILE "/config.tmp"
+#define CONFIG_JOURNAL_MAX 4096          // bytes: compact into the snapshot past this
+#define CONFIG_RECORD_MAX 2048           // bytes: larger changes go straight to a compaction
+#define CONFIG_SNAPSHOT_MAGIC 0xC1       // Snapshot header byte (never used by MessagePack), then the generation
+#define CONFIG_SNAPSHOT_HEADER_SIZE 5
+
+// Writer task settings
+#define CONFIG_WRITER_STACK 4096         // bytes
+#define CONFIG_WRITER_PRIORITY 1         // Same as loopTask
+#define CONFIG_WRITE_QUEUE_LENGTH 4      // Writes waiting for the task (commit blocks when full)
+#define CONFIG_FLUSH_TIMEOUT 5000        // ms: flush() gives up waiting after this
+
+/**
+ * Config Journal
+ *
+ * Crash-safe persistence for the config document. The snapshot (MessagePack,
+ * CONFIG_FILE) is only ever replaced through a temp file and rename; edits in
+ * between are appended to a journal as checksummed MessagePack records, one
+ * per changed section.
+ * A section is a second-level entry (one module, one device setting) or a
+ * top-level value that isn't an object, so a typical edit writes tens to a
+ * few hundred bytes instead of the whole document.
+ *
+ * Every snapshot carries a generation number and every record the generation
+ * it was written against. A compaction starts a new generation, so a journal
+ * left behind by a power cut between the snapshot rename and the journal
+ * removal is recognised as older than the snapshot and skipped; replaying it
+ * would undo edits the snapshot holds.
+ *
+ * Boot loads the snapshot and replays the journal. A torn record (power cut
+ * mid-append) fails its length or checksum and ends the replay; everything
+ * before it is kept, and the journal is compacted right away so new records
+ * never follow garbage. After a failed write at run time the writer drops
+ * the appends queued behind it until the next snapshot, which the next
+ * commit() queues. A whole record that doesn't parse or doesn't fit is
+ * skipped, not taken for a torn one; a full pool is garbage-collected first.
+ *
+ * commit() and compact() build the bytes on the loop task and hand them to
+ * a writer task in order, so flash erase/program never stalls the button or
+ * display. flush() waits for the writer to catch up (before a restart);
+ * stop() drops what is queued and ends the writer (before a format).
+ * Before init() writes run inline.
+ */
+class ConfigJournal {
+private:
+    enum WriteKind {
+        WRITE_APPEND,    // Records onto the journal
+        WRITE_SNAPSHOT,  // Temp file + rename, journal removed
+        WRITE_BARRIER,   // Signals flushDone
+        WRITE_STOP       // Signals flushDone and ends the writer task
+    };
+
+    struct WriteJob {
+        WriteKind kind;
+        std::vector<uint8_t> data;  // Framed records, or the whole MessagePack snapshot
+    };
+
+    std::map<String, uint32_t> sections;  // "modules/bitcoin" -> hash of its JSON
+    uint32_t generation;        // Of the newest snapshot (on flash or queued); 0 = headerless
+    bool ready;                 // sections match what is on flash (or queued for it)
+    size_t journalSize;         // bytes, including queued appends
+
+    QueueHandle_t writeQueue;
+    SemaphoreHandle_t flushDone;
+    TaskHandle_t task;
+    volatile bool writeFailed;  // Set by the writer: next commit compacts
+    bool appendsHeld;           // Writer only: a write failed, appends wait for the next snapshot
+    bool stopped;               // stop() called: no more writes until restart
+
+    // Stats (the volatile ones are updated by the writer task)
+    uint32_t saveRequests;      // saveConfiguration() calls
+    uint32_t records;           // Appended since boot
+    volatile uint32_t writes;   // Appends + snapshots that reached flash
+    volatile uint32_t compactions;
+    volatile uint32_t bytesWritten;  // Journal + snapshot bytes since boot
+    uint16_t replayed;          // Records applied at boot
+    uint16_t skipped;           // Records at boot older than the snapshot
+    bool tornAtBoot;
+
+    static uint32_t hashValue(JsonVariantConst value);
+    static void collectSections(JsonDocument& doc, std::map<String, uint32_t>& out);
+    static bool applyRecord(JsonDocument& doc, JsonObjectConst record);
+    bool appendRecord(std::vector<uint8_t>& out, const String& path, JsonVariantConst value, bool remove);
+    void submit(WriteJob* job);
+    void execute(WriteJob& job);
+    static void taskMain(void* param);
+
+public:
+    ConfigJournal();
+
+    bool init();  // Starts the writer task
+
+    // Boot: the snapshot file's header; returns where its MessagePack starts
+    size_t openSnapshot(const uint8_t* data, size_t length);
+    // Boot: apply the journal on top of the loaded snapshot; false if it was torn
+    bool replay(JsonDocument& doc);
+    void begin(JsonDocument& doc);  // Baseline for commit() (compacts a torn or long journal)
+
+    bool commit(JsonDocument& doc);   // Queue records for the sections changed since the last commit
+    bool compact(JsonDocument& doc);  // Queue a full snapshot; the journal is emptied after it
+    bool flush();                     // Wait until queued writes are on flash; false on a write error
+    bool stop();                      // Drop queued writes, wait out the current one, end the writer
+    bool isReady() { return ready; }
+    bool hasWriteFailed() { return writeFailed; }
+
+    void countRequest() { saveRequests++; }
+    uint32_t getRequestCount() { return saveRequests; }
+    uint32_t getWriteCount() { return writes; }
+
+    void toJson(JsonObject out);
+};
+
+#endif // CONFIG_JOURNAL_H
@@ -0,0 +1,59 @@
+#ifndef CONNECTION_POOL_H
+#define CONNECTION_POOL_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFiClientSecure.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Pool settings
+#define POOL_MAX_CONNECTIONS 3       // One per upstream API host
+#define POOL_IDLE_TIMEOUT 60000      // ms: most servers drop idle keep-alive around 60s
+#define POOL_MIN_FREE_HEAP 60000     // bytes: below this, close instead of keeping alive
+
+/**
+ * Connection Pool
+ *
+ * Keeps HTTPS connections open between fetches, keyed by host and port, so
+ * repeat requests to the same API skip the TCP connect and TLS handshake.
+ * Thread-safe: the fetch worker and loop task may both make requests.
+ */
+class ConnectionPool {
+private:
+    struct Entry {
+        String host;
+        uint16_t port;
+        WiFiClientSecure* client;
+        unsigned long lastUsed;  // millis()
+        bool inUse;
+    };
+
+    Entry entries[POOL_MAX_CONNECTIONS];
+    SemaphoreHandle_t lock;
+
+    // Stats
+    uint32_t reused;
+    uint32_t handshakes;
+    uint64_t handshakeUsTotal;
+    uint32_t staleRetries;
+
+    void closeEntry(Entry& entry);
+
+public:
+    ConnectionPool();
+
+    // Returns a client for host:port; reused = already connected (skip connect)
+    WiFiClientSecure* acquire(const String& host, uint16_t port, bool& reused);
+    // Return a client; keepAlive = false closes the connection
+    void release(WiFiClientSecure* client, bool keepAlive);
+    void closeIdle();  // Drop connections idle past POOL_IDLE_TIMEOUT
+
+    void recordHandshake(uint32_t us);
+    void recordStaleRetry() { staleRetries++; }
+
+    void toJson(JsonObject out);
+    void print();
+};
+
+#endif // CONNECTION_POOL_H
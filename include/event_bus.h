@@ -0,0 +1,42 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+#define EVENT_BUS_MAX_LISTENERS 4
+
+// Receives every published event: name plus compact JSON payload
+typedef std::function<void(const char* event, const String& data)> EventListener;
+
+/**
+ * Event Bus
+ *
+ * In-process publish/subscribe for state changes (module readings, errors,
+ * backoff). Publishers don't know who listens; the settings server forwards
+ * events to browsers over Server-Sent Events. Loop task only.
+ */
+class EventBus {
+private:
+    struct Listener {
+        int id;
+        EventListener callback;
+    };
+
+    std::vector<Listener> listeners;
+    int nextId;
+    uint32_t published;
+
+public:
+    EventBus();
+
+    int subscribe(EventListener callback);  // Returns an id for unsubscribe(), -1 when full
+    void unsubscribe(int id);
+    void publish(const char* event, const String& data);
+
+    bool hasListeners() { return !listeners.empty(); }
+    uint32_t getPublishedCount() { return published; }
+};
+
+#endif // EVENT_BUS_H
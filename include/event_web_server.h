@@ -0,0 +1,194 @@
+#ifndef EVENT_WEB_SERVER_H
+#define EVENT_WEB_SERVER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+#include <HTTP_Method.h>
+#include <functional>
+#include <vector>
+
+// Server settings
+#define HTTP_MAX_CONNECTIONS 4         // Open client sockets (browser opens 2-3 per page)
+#define HTTP_MAX_LINE 1024             // bytes: request line or a single header
+#define HTTP_MAX_HEADERS 24            // Headers kept per request (extra ones are ignored)
+#define HTTP_MAX_BODY 8192             // bytes: POST body (config JSON fits in the global document)
+#define HTTP_READ_PER_POLL 1024        // bytes read per connection per handleClient()
+#define HTTP_WRITE_PER_POLL 2872       // bytes written per connection per handleClient() (two TCP segments)
+#define HTTP_WRITE_TIMEOUT 10000       // ms: a response the client stops reading is dropped after this
+#define HTTP_CHUNK_SIZE 512            // bytes buffered per chunk of a streamed response
+#define HTTP_REQUEST_TIMEOUT 10000     // ms: a started request must arrive within this
+#define HTTP_KEEPALIVE_TIMEOUT 5000    // ms: idle keep-alive connections are closed after this
+#define HTTP_DEFERRED_TIMEOUT 20000    // ms: deferred responses answer 504 after this
+#define HTTP_MAX_EVENT_STREAMS 2       // Server-Sent Events clients (each holds a connection)
+#define HTTP_EVENT_HEARTBEAT 15000     // ms: comment line on quiet event streams (detects dead clients)
+#define HTTP_EVENT_BACKLOG 4096        // bytes of unsent events before a slow event client is dropped
+
+typedef std::function<void()> RequestHandler;
+typedef uint32_t ResponseHandle;  // 0 = none
+
+// Streamed response body: writes the next piece to out, returns false when done
+typedef std::function<bool(Print& out)> ChunkProducer;
+
+class ChunkedPrint;
+
+/**
+ * Event Web Server
+ *
+ * Non-blocking HTTP/1.1 server for the settings pages. Each connection runs
+ * its own state machine (read request, handle, write response, keep-alive),
+ * and handleClient() only does the work that is ready, so one slow client
+ * never stalls the others or the display. Writes hand the socket only what
+ * it accepts right away; the rest waits for a later poll.
+ *
+ * Handlers use the same calls as the Arduino WebServer (arg, header, send).
+ * A handler that needs a fetch calls defer() and answers later through
+ * sendDeferred(); the connection stays open while other requests are served.
+ * Responses of unbounded size use sendChunked(), which pulls the body from a
+ * producer a piece at a time instead of building it in RAM.
+ * beginEventStream() turns a request into a Server-Sent Events stream that
+ * broadcastEvent() pushes to until the client disconnects.
+ * HEAD requests run the GET handler and get its headers without the body.
+ */
+class EventWebServer {
+private:
+    enum ConnState {
+        CONN_FREE,
+        CONN_READ_REQUEST,   // Request line
+        CONN_READ_HEADERS,
+        CONN_READ_BODY,
+        CONN_DEFERRED,       // Handler will answer via sendDeferred()
+        CONN_WRITING,
+        CONN_EVENT_STREAM    // Open text/event-stream, written by broadcastEvent()
+    };
+
+    struct Connection {
+        WiFiClient client;
+        ConnState state;
+        unsigned long lastActivity;  // millis()
+        unsigned long requestStart;  // millis() of the first request byte, 0 = between requests
+        uint16_t served;             // Requests answered on this connection
+
+        // Request
+        String line;
+        HTTPMethod method;
+        String uri;
+        String query;
+        std::vector<std::pair<String, String>> headers;
+        String* body;                // Heap copy so the buffer is freed between requests
+        size_t contentLength;
+        bool keepAlive;
+        bool http11;
+        uint32_t dispatchedUs;       // micros() when the handler ran, 0 = not dispatched
+
+        // Response: head (status line + headers), then body
+        String head;
+        size_t headPos;
+        String* payload;             // Owned body for send(), nullptr for send_P()
+        const uint8_t* bodyData;
+        size_t bodyLen;
+        size_t bodyPos;
+        ChunkProducer producer;      // sendChunked() body source
+        ChunkedPrint* stream;
+        std::vector<uint8_t> pending;  // Framed chunks or events the socket hasn't taken yet
+        size_t pendingPos;
+
+        ResponseHandle deferred;
+        unsigned long deferredAt;
+    };
+
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        RequestHandler handler;
+    };
+
+    WiFiServer listener;
+    Connection conns[HTTP_MAX_CONNECTIONS];
+    std::vector<Route> routes;
+
+    Connection* current;  // Connection whose handler is running
+    std::vector<std::pair<String, String>> args;
+    std::vector<std::pair<String, String>> responseHeaders;  // sendHeader() before send()
+    bool responded;
+
+    // Stats
+    uint32_t requests;
+    uint32_t keepAliveReuses;
+    uint32_t rejected;
+    uint32_t deferredCount;
+    uint32_t deferredTimeouts;
+    uint32_t maxHandlerUs;
+    uint32_t streamed;
+    uint32_t lastTtfbUs;             // Handler start to first response byte
+    uint32_t maxTtfbUs;
+    uint32_t eventsSent;
+
+    void accept();
+    void poll(Connection& conn);
+    bool readRequest(Connection& conn);  // true once a whole request is in
+    bool processLine(Connection& conn);  // false after answering a malformed request
+    void dispatch(Connection& conn);
+    // buildHead() lengths for bodies of unknown size
+    static const long LENGTH_CHUNKED = -1;      // Chunked on HTTP/1.1, until close on 1.0
+    static const long LENGTH_UNTIL_CLOSE = -2;
+
+    void buildHead(Connection& conn, int code, const char* contentType, long length,
+                   const std::vector<std::pair<String, String>>* extraHeaders);
+    void respond(Connection& conn, int code, const char* contentType,
+                 const uint8_t* data, size_t length, String* owned,
+                 const std::vector<std::pair<String, String>>* extraHeaders);
+    long writeNow(Connection& conn, const uint8_t* data, size_t length);  // Bytes taken, -1 on error
+    bool flushPending(Connection& conn);  // false once the connection is closed
+    void writeSome(Connection& conn);
+    void finishResponse(Connection& conn);
+    void resetRequest(Connection& conn);
+    void close(Connection& conn);
+    void sendError(Connection& conn, int code, const char* message);
+    bool writeEvent(Connection& conn, const String& text);
+    void parseArgs(const String& encoded);
+
+    static HTTPMethod parseMethod(const String& name);
+    static String urlDecode(const String& text);
+    static const char* statusText(int code);
+
+public:
+    explicit EventWebServer(uint16_t port = 80);
+    ~EventWebServer();
+
+    void on(const String& uri, RequestHandler handler);
+    void on(const String& uri, HTTPMethod method, RequestHandler handler);
+    void begin();
+    void stop();
+    void handleClient();  // Call from loop(): advances every connection
+
+    // Request accessors (valid inside a handler)
+    String arg(const String& name);  // "plain" = raw body
+    bool hasArg(const String& name);
+    String header(const String& name);
+    String uri();
+    HTTPMethod method();
+
+    // Responses (inside a handler)
+    void sendHeader(const String& name, const String& value);
+    void send(int code, const char* contentType, const String& content);
+    void send_P(int code, PGM_P contentType, PGM_P content);
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t length);  // Binary (e.g. gzip)
+    void sendChunked(int code, const char* contentType, ChunkProducer producer);  // Constant memory
+
+    // Server-Sent Events: beginEventStream() (inside a handler) keeps the
+    // connection open; false when HTTP_MAX_EVENT_STREAMS are already open
+    bool beginEventStream();
+    uint8_t broadcastEvent(const char* event, const String& data);  // Returns clients reached
+    uint8_t getEventStreamCount();
+
+    // Deferred responses: answer outside the handler (e.g. from a fetch callback)
+    ResponseHandle defer();
+    bool sendDeferred(ResponseHandle handle, int code, const char* contentType, const String& content);
+
+    uint8_t getOpenConnections();
+    bool isWriting();  // A response is still being written (e.g. before a restart)
+    void toJson(JsonObject out);
+};
+
+#endif // EVENT_WEB_SERVER_H
@@ -0,0 +1,74 @@
+#ifndef FETCH_STATS_H
+#define FETCH_STATS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <map>
+
+// Fetch phases, in request order
+enum FetchPhase {
+    PHASE_DNS,          // Hostname lookup
+    PHASE_CONNECT,      // TCP connect + TLS handshake (one call in WiFiClientSecure)
+    PHASE_FIRST_BYTE,   // Request sent until response headers parsed
+    PHASE_BODY,         // Reading the response body (streamed requests: read + JSON parse)
+    PHASE_PARSE,        // Module handling of the response (loop task)
+    PHASE_COUNT
+};
+
+// Microsecond timings for one fetch (0 = phase not reached)
+struct FetchTrace {
+    uint32_t us[PHASE_COUNT];
+    uint32_t wireBytes;     // Body bytes received (compressed if encoded)
+    uint32_t bodyBytes;     // Body bytes after decoding
+    uint32_t inflateUs;     // CPU time spent decompressing (part of the body phase)
+
+    FetchTrace() : wireBytes(0), bodyBytes(0), inflateUs(0) { memset(us, 0, sizeof(us)); }
+};
+
+#define STATS_BUCKETS 25  // log2 buckets: [2^i, 2^(i+1)) us, last bucket ~16s+
+
+// Per-phase histogram (log2 buckets keep it small and fixed-size)
+struct PhaseHistogram {
+    uint16_t buckets[STATS_BUCKETS];
+    uint32_t count;
+    uint32_t maxUs;
+
+    PhaseHistogram() : count(0), maxUs(0) { memset(buckets, 0, sizeof(buckets)); }
+    void add(uint32_t us);
+    uint32_t percentile(uint8_t pct);  // Upper bound of the bucket holding pct
+};
+
+struct ModuleFetchStats {
+    PhaseHistogram phases[PHASE_COUNT];
+
+    // Transfer totals (compression savings and its CPU cost)
+    uint32_t wireBytes;
+    uint32_t bodyBytes;
+    uint32_t inflateUs;
+    uint32_t compressedFetches;
+
+    ModuleFetchStats() : wireBytes(0), bodyBytes(0), inflateUs(0), compressedFetches(0) {}
+};
+
+/**
+ * Fetch Stats
+ *
+ * Per-module histograms of fetch phase timings, fed from FetchTrace results on
+ * the loop task. Readable via /api/fetch-stats and the "stats" serial command.
+ */
+class FetchStats {
+private:
+    std::map<String, ModuleFetchStats> modules;
+
+public:
+    void record(const String& moduleId, const FetchTrace& trace);
+    void forget(const String& moduleId);
+    void reset();
+
+    void toJson(JsonObject out);
+    void print();
+
+    static const char* phaseName(uint8_t phase);
+};
+
+#endif // FETCH_STATS_H
@@ -0,0 +1,93 @@
+#ifndef FETCH_WORKER_H
+#define FETCH_WORKER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <functional>
+#include <memory>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include "fetch_stats.h"
+
+// Worker task settings
+#define FETCH_WORKER_STACK 12288     // bytes (TLS handshake needs a deep stack)
+#define FETCH_WORKER_PRIORITY 1      // Same as loopTask
+#define FETCH_QUEUE_LENGTH 8         // Max jobs waiting for the worker
+#define FETCH_IDLE_CHECK_MS 10000    // Idle wake-up to reap pooled connections
+#define FETCH_FILTER_SIZE 1024       // Default bytes for newFilter()
+
+// HTTP request handed to the worker
+struct FetchRequest {
+    String url;
+    bool withHeaders;  // Use httpGetWithHeaders() (browser-like headers)
+
+    // Streaming parse: with docCapacity set, the worker deserializes the body
+    // straight from the socket through filter (if any) instead of returning it.
+    // Only allocated by newFilter(), so requests without one cost no filter heap
+    size_t docCapacity;
+    std::unique_ptr<DynamicJsonDocument> filter;
+
+    // Conditional request (ETag/Last-Modified, max-age) for streamed requests.
+    // A hit comes back as HTTP 304 with no document: the caller's data is current
+    bool useCache;
+
+    FetchRequest() : withHeaders(false), docCapacity(0), useCache(true) {}
+
+    // Empty filter to fill in (replacing any); batches that grow with their members size it to fit
+    JsonDocument& newFilter(size_t capacity = FETCH_FILTER_SIZE) {
+        filter.reset(new DynamicJsonDocument(capacity));
+        return *filter;
+    }
+};
+
+// Result handed back to the loop task
+struct FetchResult {
+    bool success;
+    int httpCode;             // HTTP status or HTTPClient error (<0)
+    String body;
+    String errorMsg;
+    unsigned long durationMs;
+    FetchTrace trace;         // Per-phase timings (parse is filled in by the scheduler)
+    DynamicJsonDocument* doc; // Parsed body for streaming requests (owned by the worker)
+};
+
+typedef std::function<void(FetchResult& result)> FetchCallback;
+
+/**
+ * Fetch Worker
+ *
+ * Runs blocking HTTPS requests on a dedicated FreeRTOS task so loop()
+ * (button, display, settings server) keeps running while a fetch is in flight.
+ * Completion callbacks run on the loop task from dispatchResults(), so they
+ * can safely touch the global config.
+ */
+class FetchWorker {
+private:
+    struct Job {
+        FetchRequest request;
+        FetchResult result;
+        FetchCallback onComplete;
+
+        ~Job() { delete result.doc; }
+    };
+
+    QueueHandle_t jobQueue;
+    QueueHandle_t resultQueue;
+    TaskHandle_t task;
+    uint8_t pending;  // Submitted but not yet dispatched (loop task only)
+
+    static void taskMain(void* param);
+
+public:
+    FetchWorker();
+
+    bool init();
+    bool submit(FetchRequest&& request, FetchCallback onComplete);  // Moved into the job
+    void dispatchResults();  // Call from loop(): runs callbacks of finished jobs
+
+    bool isBusy() { return pending > 0; }
+    uint8_t getPendingCount() { return pending; }
+};
+
+#endif // FETCH_WORKER_H
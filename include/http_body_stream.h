@@ -0,0 +1,47 @@
+#ifndef HTTP_BODY_STREAM_H
+#define HTTP_BODY_STREAM_H
+
+#include <Arduino.h>
+
+#define BODY_STREAM_BUFFER 128  // bytes read from the socket at a time
+
+/**
+ * HTTP Body Stream
+ *
+ * Presents an HTTP response body (Content-Length, chunked, or read-until-close)
+ * as a plain Stream, so ArduinoJson can parse straight from the socket without
+ * buffering the whole body in a String. Reads block on the underlying client's
+ * timeout; read() returns -1 only at the end of the body or on timeout.
+ */
+class HttpBodyStream : public Stream {
+private:
+    Stream& in;
+    long remaining;      // Content-Length bytes left (-1 = unknown)
+    bool chunked;
+    long chunkLeft;      // Bytes left in the current chunk
+    bool done;
+    size_t bytesRead;    // Body bytes taken off the wire
+
+    uint8_t buffer[BODY_STREAM_BUFFER];
+    size_t bufferLen;
+    size_t bufferPos;
+
+    bool fill();
+    bool readChunkHeader();
+    void readLine(char* line, size_t size);
+
+public:
+    HttpBodyStream(Stream& in, long contentLength, bool chunked);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;  // Blocks until length or end of body
+    size_t write(uint8_t) override { return 0; }
+
+    void drain();  // Consume the rest of the body so the connection can be reused
+    bool isComplete() { return done && bufferPos >= bufferLen; }
+    size_t getBytesRead() { return bytesRead; }
+};
+
+#endif // HTTP_BODY_STREAM_H
@@ -0,0 +1,57 @@
+#ifndef HTTP_CACHE_H
+#define HTTP_CACHE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define HTTP_CACHE_ENTRIES 12  // URLs remembered (one per batch/module request)
+
+/**
+ * HTTP Cache
+ *
+ * Remembers response validators (ETag, Last-Modified) and freshness
+ * (Cache-Control max-age) per URL. Bodies are not stored - the parsed values
+ * already live in the module config - so a hit means "what you have is current".
+ * Thread-safe: used from the fetch worker, inspected from the loop task.
+ */
+class HttpCache {
+private:
+    struct Entry {
+        String url;
+        String etag;
+        String lastModified;
+        unsigned long storedAt;   // millis()
+        unsigned long freshFor;   // ms from storedAt (0 = always revalidate)
+        unsigned long lastUsed;   // millis(), for eviction
+        uint32_t hits;
+    };
+
+    Entry entries[HTTP_CACHE_ENTRIES];
+    SemaphoreHandle_t lock;
+
+    // Stats
+    uint32_t freshHits;      // Skipped the request entirely (max-age)
+    uint32_t revalidated;    // 304 Not Modified
+    uint32_t misses;         // Full 200 response
+    uint32_t uncacheable;    // no-store or no validators/max-age
+
+    Entry* find(const String& url);
+
+public:
+    HttpCache();
+
+    // True if a cached response is still fresh (no request needed)
+    bool isFresh(const String& url);
+    // Validators for a conditional request (empty if none)
+    void getValidators(const String& url, String& etag, String& lastModified);
+
+    void storeResponse(const String& url, const String& etag, const String& lastModified,
+                       const String& cacheControl, const String& age);
+    void recordNotModified(const String& url, const String& cacheControl, const String& age);
+
+    void toJson(JsonObject out);
+};
+
+#endif // HTTP_CACHE_H
@@ -0,0 +1,66 @@
+#ifndef INFLATE_STREAM_H
+#define INFLATE_STREAM_H
+
+#include <Arduino.h>
+
+#if CONFIG_IDF_TARGET_ESP32C3
+#include "esp32c3/rom/miniz.h"
+#else
+#include "rom/miniz.h"
+#endif
+
+#define INFLATE_INPUT_BUFFER 256  // compressed bytes read from the body at a time
+
+/**
+ * Inflate Stream
+ *
+ * Streaming gzip/deflate decoder over another Stream (the HTTP body), using the
+ * tinfl inflater in ROM. Memory is bounded: the 32KB deflate window plus the
+ * ~11KB decompressor state, both freed with the stream. Output is produced
+ * on demand as the JSON parser reads.
+ */
+class InflateStream : public Stream {
+public:
+    enum Format { GZIP, DEFLATE };
+
+private:
+    Stream& in;
+    Format format;
+    tinfl_decompressor* decomp;
+    uint8_t* window;              // TINFL_LZ_DICT_SIZE ring buffer (also the output)
+    uint8_t input[INFLATE_INPUT_BUFFER];
+    size_t inputLen;
+    size_t inputPos;
+    bool inputDone;
+    uint32_t flags;
+
+    size_t windowOfs;             // Where the next output goes
+    size_t outPos;                // Unread output: [outPos, outEnd)
+    size_t outEnd;
+    bool started;
+    bool finished;
+    bool failed;
+
+    size_t bytesOut;
+    uint32_t inflateUs;
+
+    bool begin();
+    bool skipGzipHeader();
+    bool produce();
+
+public:
+    InflateStream(Stream& in, Format format);
+    ~InflateStream();
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t write(uint8_t) override { return 0; }
+
+    bool hasError() { return failed; }
+    size_t getBytesOut() { return bytesOut; }
+    uint32_t getInflateUs() { return inflateUs; }  // CPU time spent decoding
+};
+
+#endif // INFLATE_STREAM_H
@@ -5,17 +5,74 @@
 #include <WiFi.h>
 #include <WiFiClientSecure.h>
 #include <HTTPClient.h>
-#include <WebServer.h>
+#include "event_web_server.h"
+#include "fetch_stats.h"
+#include "connection_pool.h"
+#include "fetch_worker.h"
+#include "http_cache.h"
+#include "search_cache.h"
+#include <map>
+#include <vector>
+
+// WiFi association settings
+#define WIFI_FAST_CONNECT_TIMEOUT 4000   // ms: direct connect to the cached BSSID/channel before scanning
+#define WIFI_SCAN_CONNECT_TIMEOUT 15000  // ms: a reconnect that scans gives up after this
+#define WIFI_BACKOFF_MIN 1000            // ms: first retry after a failed reconnect
+#define WIFI_BACKOFF_MAX 60000           // ms: retry delay cap (doubles per failure, +/-20% jitter)
+
+// Restarts requested over the web wait for their reply to go out
+#define RESTART_GRACE 200                // ms: after the last response left the server, for lwIP to send it
+#define RESTART_MAX_WAIT 3000            // ms: restart anyway if a client isn't reading
+
+// Station link as seen by the rest of the firmware (driven by WiFi events)
+enum LinkState {
+    LINK_DOWN,        // Waiting for the next reconnect attempt
+    LINK_CONNECTING,  // begin() issued, waiting for an IP
+    LINK_UP           // Associated with an IP - fetches may run
+};
+
+// Restart requested by a web handler, carried out from handleClient()
+enum PendingRestart {
+    RESTART_NONE,
+    RESTART_REBOOT,
+    RESTART_FACTORY_RESET  // Format LittleFS, then reboot
+};
+
+// Time-to-associate measurements (boot connect and reconnects)
+struct WiFiConnectStats {
+    unsigned long lastAssociateMs;  // begin() to connected, 0 = not connected yet
+    bool lastFastPath;              // Last association used the cached BSSID/channel
+    uint32_t fastConnects;
+    uint32_t fastFallbacks;         // Cached AP didn't answer, fell back to a scan
+    uint32_t fullConnects;
+    uint32_t linkDrops;             // Link lost after being up
+    uint32_t reconnectAttempts;
+    unsigned long lastOutageMs;     // Link lost to link back up
+};
 
 class NetworkManager {
 private:
-    WebServer* server;
+    EventWebServer* server;
     String apName;
     String apPassword;
     String animalName;
     bool isAPMode;
     bool isSettingsMode;  // True when running settings web server
-    unsigned long lastReconnectAttempt;
+
+    // Link state: WiFi events (event task) only raise flags, maintainConnection() acts on them
+    LinkState linkState;
+    volatile bool linkUpEvent;
+    volatile bool linkDownEvent;
+    volatile uint8_t disconnectReason;
+    bool eventsRegistered;
+    unsigned long linkDownSince;    // millis() the link was lost
+    unsigned long nextReconnectAt;  // millis() of the next attempt while LINK_DOWN
+    uint8_t reconnectFailures;      // Backoff exponent, reset once the link is up
+
+    // Fast reconnect: pending association and its measurements
+    unsigned long associateStart;  // millis() of the pending reconnect begin(), 0 = none
+    bool associateFast;            // Pending attempt targets the cached BSSID/channel
+    WiFiConnectStats wifiStats;
 
     // WiFi scan caching
     String cachedScanResults;
@@ -25,6 +82,24 @@ private:
     // Client connection tracking
     bool clientWasConnected;
 
+    // Kept-alive HTTPS connections for API fetches
+    ConnectionPool connectionPool;
+
+    // Validators/freshness of API responses (conditional requests)
+    HttpCache httpCache;
+
+    // Stock search results, and browser requests waiting on an upstream search
+    SearchCache searchCache;
+    std::map<String, std::vector<ResponseHandle>> pendingSearches;
+
+    // Event bus subscription feeding /api/events (-1 = none)
+    int eventSubscription;
+
+    // Restart waiting for its reply to be written
+    PendingRestart pendingRestart;
+    unsigned long restartRequestedAt;  // millis()
+    unsigned long restartFlushedAt;    // millis() the server had nothing left to write, 0 = not yet
+
     // Web server handlers - Setup mode
     void setupWebServer();
     void handleRoot();
@@ -34,12 +109,35 @@ private:
     // Web server handlers - Settings mode
     void setupSettingsServer();
     void handleSettingsRoot();
+    void sendGzipPage(const uint8_t* data, size_t length, const char* etag);  // ETag/304 aware
+    void writeModuleJson(Print& out, const String& moduleId, JsonObject moduleConfig);  // One /api/modules entry
     void handleValidateCode();
     void handleGetConfig();
     void handleUpdateConfig();
     void handleStockSearch();
+    void onStockSearchResult(const String& query, FetchResult& result);
     void handleRestart();
     void handleFactoryReset();
+    void scheduleRestart(PendingRestart kind);
+    void finishPendingRestart();
+
+    // Shared HTTPS GET with per-phase timing; fills response, or parses into doc when given
+    bool httpRequest(const char* url, bool browserHeaders, String* response, JsonDocument* doc,
+                     JsonVariantConst filter, bool useCache, String& errorMsg, int* httpCode, FetchTrace* trace);
+
+    // Cached access point (config["wifi"]: bssid, channel, lease) for direct connects
+    bool loadCachedAP(uint8_t bssid[6], int32_t& channel);
+    void applyCachedLease();
+    void rememberAP();
+    void recordAssociation(unsigned long ms, bool fast);
+    bool waitForAssociation(unsigned long start, unsigned long timeout);
+
+    // Event-driven reconnection
+    void registerWiFiEvents();
+    void onLinkUp(unsigned long now);
+    void onLinkDown(unsigned long now);
+    void startReconnect(unsigned long now);
+    unsigned long reconnectDelay();
 
     // WiFi scanning
     void startWiFiScan();
@@ -59,18 +157,31 @@ public:
     void startConfigAP();
     void stopConfigAP();
     bool isConnected();
-    void reconnect();
+    bool isOnline() { return linkState == LINK_UP; }  // Fetches should only run while true
+    LinkState getLinkState() { return linkState; }
+    void maintainConnection();  // Call from loop(): handles link events and reconnect backoff
 
     // Settings server management
     void startSettingsServer();
     void stopSettingsServer();
     bool isSettingsServerRunning();
 
-    // HTTP requests
-    bool httpGet(const char* url, String& response, String& errorMsg);
-    bool httpGetWithHeaders(const char* url, String& response, String& errorMsg);
+    // HTTP requests (blocking - call from the fetch worker task, not loop())
+    // httpCode (optional) receives the HTTP status or HTTPClient error (<0)
+    // trace (optional) receives microsecond timings per phase
+    bool httpGet(const char* url, String& response, String& errorMsg, int* httpCode = nullptr,
+                 FetchTrace* trace = nullptr);
+    bool httpGetWithHeaders(const char* url, String& response, String& errorMsg, int* httpCode = nullptr,
+                            FetchTrace* trace = nullptr);
+    // Streams the body into doc through request.filter (bounded memory, no body String).
+    // Returns true with httpCode 304 (doc untouched) when the cached data is still current
+    bool httpGetJson(const FetchRequest& request, JsonDocument& doc, String& errorMsg, int* httpCode = nullptr,
+                     FetchTrace* trace = nullptr);
 
     // Accessors
+    ConnectionPool& getConnectionPool() { return connectionPool; }
+    HttpCache& getHttpCache() { return httpCache; }
+    const WiFiConnectStats& getWiFiStats() { return wifiStats; }
     String getAPName() { return apName; }
     String getAPPassword() { return apPassword; }
     String getAnimalName() { return animalName; }
@@ -0,0 +1,105 @@
+#ifndef READINGS_STORE_H
+#define READINGS_STORE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define READINGS_MAX_MODULES 24          // Slots (config holds 15-20 module instances)
+#define READING_CONDITION_LEN 16         // "Thunderstorm" + terminator
+#define READING_ERROR_LEN 48             // Longer fetch errors are truncated
+#define READINGS_FILE "/readings.bin"
+#define READINGS_TEMP_FILE "/readings.tmp"
+#define READINGS_SAVE_INTERVAL 300000    // ms: longest gap between snapshots (and before restarts)
+#define READINGS_SAVE_MIN_INTERVAL 60000 // ms: shortest gap, bounds flash wear
+
+// Fields a reading carries - JSON output only writes these (same keys as before)
+enum ReadingField : uint8_t {
+    READING_VALUE = 0x01,        // "value" (price)
+    READING_CHANGE = 0x02,       // "change" (stocks: vs previous close)
+    READING_CHANGE24H = 0x04,    // "change24h" (crypto), stored in change
+    READING_TEMPERATURE = 0x08,  // "temperature"
+    READING_CONDITION = 0x10,    // "condition"
+    READING_CODE = 0x20          // "securityCode", "codeTimeRemaining" (settings)
+};
+
+// Live state of one module - fixed layout, written raw to the snapshot file
+struct ModuleReading {
+    float value;
+    float change;                  // Percent
+    float temperature;             // °C
+    uint32_t securityCode;
+    uint32_t codeTimeRemaining;    // ms
+    unsigned long lastUpdate;      // Wall-clock or uptime seconds (see time_sync.h), 0 = never
+    uint8_t fields;                // ReadingField bits in use
+    bool lastSuccess;
+    char condition[READING_CONDITION_LEN];
+    char lastError[READING_ERROR_LEN];
+};
+
+/**
+ * Readings Store
+ *
+ * Volatile module readings (prices, temperatures, last error), kept out of
+ * the persistent config document so fetches never touch it and config saves
+ * only happen on user edits. One fixed slot per module: writers and the
+ * display read and write plain struct fields instead of JSON keys.
+ *
+ * The store is snapshotted to its own file once per refresh interval
+ * (clamped to READINGS_SAVE_MIN_INTERVAL..READINGS_SAVE_INTERVAL) and before
+ * restarts, so after a power cut the restored values are at most about one
+ * refresh old. Slots declared non-persistent (readings a module recomputes
+ * on its own, like the settings security code) never mark the store dirty
+ * and are left out of the snapshot. Loop task only.
+ */
+class ReadingsStore {
+private:
+    ModuleReading slots[READINGS_MAX_MODULES];
+    String slotIds[READINGS_MAX_MODULES];  // "" = free slot
+    bool persistent[READINGS_MAX_MODULES]; // false: edits stay in RAM, never snapshotted
+    ModuleReading empty;                   // read() of an unknown module
+
+    bool dirty;               // Changed since the last snapshot
+    unsigned long lastSave;   // millis()
+    uint32_t snapshots;
+
+    int allocate(const char* moduleId);
+    static void clearReading(ModuleReading& reading);
+
+public:
+    ReadingsStore();
+
+    int find(const char* moduleId);     // Slot, -1 if none
+    // Slot with these fields, -1 when full. persist = false drops what a snapshot held for it
+    int declare(const char* moduleId, uint8_t fields, bool persist = true);
+
+    // Lookups: nullptr for unknown modules. edit() marks the store dirty (persistent slots)
+    const ModuleReading* get(const char* moduleId);
+    const ModuleReading* get(int slot);
+    const ModuleReading& read(const char* moduleId);  // Empty reading for unknown modules
+    ModuleReading* edit(const char* moduleId);  // Allocates a slot if needed
+    ModuleReading* edit(int slot);
+
+    unsigned long getLastUpdate(const char* moduleId);  // 0 = never
+    void setLastUpdate(const char* moduleId, unsigned long timestamp);
+    void setStatus(const char* moduleId, bool success, const String& error);
+    void reset(const char* moduleId);    // Forget values (module settings changed), keep fields
+    void release(const char* moduleId);  // Module deleted
+
+    // Reading fields plus lastUpdate/lastSuccess/lastError, as in /api/modules
+    void toJson(const char* moduleId, JsonObject out);
+
+    // Stamps taken before SNTP sync: uptime seconds -> epoch
+    uint8_t rebaseTimestamps(unsigned long epoch, unsigned long uptime);
+
+    // Readings left in config.json by older firmware: moved here and stripped
+    uint8_t migrateFromConfig(JsonObject modules);
+
+    bool load();
+    bool save();
+    void maybeSave();  // Call from loop(): snapshots when dirty and the interval passed
+
+    uint8_t getCount();
+    uint32_t getSnapshotCount() { return snapshots; }
+};
+
+#endif // READINGS_STORE_H
@@ -3,6 +3,9 @@
 
 #include <Arduino.h>
 #include <map>
+#include <vector>
+#include <functional>
+#include "fetch_worker.h"
 
 // Forward declaration
 class ModuleInterface;
@@ -10,7 +13,7 @@ class ModuleInterface;
 // Scheduler states
 enum SchedulerState {
     IDLE,         // Waiting for next scheduled fetch
-    FETCHING,     // HTTP request in progress
+    FETCHING,     // HTTP request in progress (on the fetch worker)
     COOLDOWN,     // Mandatory gap between requests
     RETRY_WAIT    // Backing off after failure
 };
@@ -20,21 +23,95 @@ struct SchedulerContext {
     SchedulerState state;
     unsigned long lastFetchTime;
     unsigned long nextAllowedFetch;
-    uint8_t retryCount;
-    uint16_t retryDelay;
     String currentModule;
 };
 
+// Per-module fetch state (retry/backoff is tracked per module, not globally)
+struct ModuleFetchState {
+    unsigned long lastAttempt;     // seconds (millis() / 1000), 0 = never
+    unsigned long nextAllowed;     // seconds, fetches denied before this (backoff)
+    uint8_t consecutiveFailures;
+    int16_t lastErrorCode;         // HTTP status, HTTPClient error (<0), 0 = none/parse error
+
+    // Adaptive refresh: how fast the reading has been moving
+    float lastValue;               // Reading at lastValueAt
+    unsigned long lastValueAt;     // seconds, 0 = no reading yet
+    float volatility;              // EWMA of relative change, fraction per hour
+    uint16_t adaptiveInterval;     // seconds, 0 = use the fixed interval
+
+    uint32_t publishedHash;        // Last state pushed to the event bus (skip repeats)
+};
+
+// Background refresh queue entry (min-heap ordered by dueAt)
+struct ScheduleEntry {
+    unsigned long dueAt;  // seconds (millis() / 1000)
+    String moduleId;
+};
+
+// Callback run once a module's in-flight fetch has finished (loop task)
+typedef std::function<void()> FetchWaiter;
+
+struct PendingWaiter {
+    String moduleId;
+    FetchWaiter callback;
+};
+
+// Per-upstream-host token bucket
+struct HostBucket {
+    float tokens;
+    float ratePerSec;
+    float burst;
+    unsigned long lastRefill;  // millis()
+    uint32_t throttled;        // Dispatches deferred for lack of tokens
+};
+
 class Scheduler {
 private:
     std::map<String, ModuleInterface*> modules;
+    std::map<String, ModuleFetchState> fetchStates;
     SchedulerContext context;
     unsigned long lastGlobalFetch;
 
     static const uint16_t GLOBAL_MIN_INTERVAL = 10;  // 10 seconds between any fetches
+    static const uint16_t CATCHUP_MIN_INTERVAL = 2;  // Gap during the catch-up burst after an outage
+
+    // Connectivity: fetches pause while the WiFi link is down
+    bool offline;
+    uint8_t catchUpRemaining;  // Fetches left in the post-outage burst
+
+    // Next-due times for every network module (background refresh mode)
+    std::vector<ScheduleEntry> refreshQueue;
+
+    // Modules with a request queued or running on the fetch worker
+    std::vector<String> inFlight;
+    std::vector<PendingWaiter> waiters;  // Deferred HTTP responses waiting on inFlight
+
+    // Rate limiting per upstream host, plus a randomized hold after boot
+    std::map<String, HostBucket> hostBuckets;
+    unsigned long startupHoldUntil;
 
     uint16_t calculateBackoff(uint8_t retryCount);
     void executeFetch();
+    void executeBatchFetch(ModuleInterface* lead);
+    void onFetchResult(const String& moduleId, FetchResult& result);
+    void onBatchResult(const std::vector<String>& memberIds, FetchResult& result);
+    void completeFetch(const String& moduleId, bool success, const String& errorMsg, int httpCode);
+    void notifyWaiters(const String& moduleId);
+    void publishModuleDelta(const String& moduleId);  // "module" event when reading/error/backoff changed
+    bool hasCurrentData(const String& moduleId);
+    void markUnchanged(const String& moduleId);  // 304 / still-fresh cache hit
+    uint16_t refreshIntervalFor(ModuleInterface* module);
+    bool isDue(unsigned long lastUpdate, uint16_t interval);  // lastUpdate is wall-clock (see time_sync.h)
+    void updateVolatility(const String& moduleId, ModuleInterface* module, unsigned long now);
+    void scheduleRefresh(const String& moduleId, unsigned long dueAt);
+    bool tickBackground(unsigned long now);
+    uint16_t minFetchGap();               // Global interval, shortened during catch-up
+    void startCatchUp(unsigned long now);  // Link back: requeue stale modules, most stale first
+    HostBucket& bucketFor(const char* host);
+    void refillBucket(HostBucket& bucket);
+    bool hostHasToken(const char* host);
+    void takeHostToken(const char* host);
+    unsigned long hostWaitSeconds(const char* host);
 
 public:
     Scheduler();
@@ -45,7 +122,15 @@ public:
     void unregisterModule(const char* moduleId);
     void loadModulesFromConfig();  // Load all modules from config using factory
     void tick();
-    void requestFetch(const char* moduleId, bool forced = false);
+    bool requestFetch(const char* moduleId, bool forced = false);  // true if dispatched
+    bool isBackgroundRefreshEnabled();
+    const ModuleFetchState* getFetchState(const char* moduleId);
+    bool isAdaptiveRefreshEnabled();
+    uint16_t getRefreshInterval(const char* moduleId);  // Effective interval (fixed or adaptive)
+    bool isFetchInFlight(const char* moduleId);
+    void onFetchComplete(const char* moduleId, FetchWaiter callback);  // Runs now if nothing is in flight
+    void printRefreshQueue();  // Serial report of queue order and data age
+    void printHostLimits();    // Serial report of per-host token buckets
 
     SchedulerState getState() { return context.state; }
     String getCurrentModule() { return context.currentModule; }
@@ -0,0 +1,53 @@
+#ifndef SEARCH_CACHE_H
+#define SEARCH_CACHE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#define SEARCH_CACHE_ENTRIES 8       // Recent queries kept (LRU)
+#define SEARCH_CACHE_TTL 600000      // ms: symbol lists barely change, 10 min is plenty
+#define SEARCH_MAX_RESULTS 10        // quotesCount asked from upstream
+#define SEARCH_DOC_CAPACITY 4096     // bytes for one filtered result set
+
+/**
+ * Search Cache
+ *
+ * LRU cache of stock search results keyed by the upper-cased query. Results
+ * are stored as the compact {"quotes":[...]} JSON served to the browser.
+ * A query can also be answered from a cached shorter prefix ("AP" -> "APP")
+ * when that result set was complete (fewer than SEARCH_MAX_RESULTS quotes),
+ * by keeping the quotes that still match. Loop task only.
+ */
+class SearchCache {
+private:
+    struct Entry {
+        String query;
+        String results;
+        uint8_t count;            // Quotes in results
+        unsigned long storedAt;   // millis()
+        unsigned long lastUsed;   // millis(), for eviction
+    };
+
+    Entry entries[SEARCH_CACHE_ENTRIES];
+
+    // Stats
+    uint32_t hits;
+    uint32_t prefixHits;
+    uint32_t misses;
+
+    Entry* find(const String& query);
+    bool filterPrefix(const Entry& entry, const String& query, String& results);
+
+public:
+    SearchCache();
+
+    static String normalize(const String& query);  // Trimmed, upper-case
+
+    // Fills results from an exact or prefix entry; query must be normalized
+    bool lookup(const String& query, String& results);
+    void store(const String& query, const String& results, uint8_t count);
+
+    void toJson(JsonObject out);
+};
+
+#endif // SEARCH_CACHE_H
@@ -0,0 +1,28 @@
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+#include <Arduino.h>
+
+// SNTP servers (UTC only - timestamps are compared, never displayed as dates)
+#define NTP_SERVER_1 "pool.ntp.org"
+#define NTP_SERVER_2 "time.google.com"
+
+// Timestamps at or above this are epoch seconds; below are uptime seconds
+#define EPOCH_VALID_AFTER 1600000000UL  // Sep 2020
+
+// How long after boot to wait for SNTP before treating epoch stamps as stale
+#define TIME_SYNC_GRACE 20  // seconds
+
+// Returned by timestampAge() when the age can't be known yet
+#define AGE_UNKNOWN 0xFFFFFFFFUL
+
+// Persisted timestamps (lastUpdate) are wall-clock epoch seconds once SNTP has
+// synced, so cached data survives reboots. Before the first sync they fall back
+// to uptime seconds and are rebased to epoch when the clock arrives.
+void initTimeSync();                                // Call once WiFi is up
+bool checkTimeSync();                               // Call from loop(): true once, on first sync
+bool isTimeSynced();
+unsigned long nowSeconds();                         // Epoch if synced, otherwise uptime
+unsigned long timestampAge(unsigned long timestamp);  // Seconds, AGE_UNKNOWN if not comparable
+
+#endif // TIME_SYNC_H
@@ -0,0 +1,492 @@
+// Generated by scripts/build_web_assets.py from web/ - do not edit
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+// web/portal.html: 1162 bytes, 1161 minified, 651 gzipped
+#define PORTAL_HTML_ETAG "\"37f1e42a6146c3f1\""
+#define PORTAL_HTML_GZ_LEN 651
+const uint8_t PORTAL_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x54, 0x5d, 0x6b, 0xdb, 0x30,
+    0x14, 0x7d, 0xf7, 0xaf, 0x70, 0x5d, 0x86, 0x6d, 0x9a, 0xd8, 0x49, 0xbb, 0xc2, 0xb0, 0x65, 0x41,
+    0x3f, 0x52, 0xb6, 0xb1, 0xae, 0x85, 0x04, 0xca, 0x1e, 0x15, 0x49, 0x4e, 0xb4, 0xda, 0x92, 0x90,
+    0xe5, 0x7c, 0x10, 0xf2, 0xdf, 0x77, 0x6d, 0xa5, 0x49, 0x29, 0x94, 0x3d, 0xe9, 0x4a, 0xf7, 0xdc,
+    0x73, 0xaf, 0xcf, 0x91, 0x8c, 0xce, 0xee, 0x9f, 0xee, 0x66, 0x7f, 0x9e, 0x27, 0xfe, 0xd2, 0xd6,
+    0x15, 0xf6, 0x50, 0xbf, 0xa0, 0x25, 0x27, 0x0c, 0xa3, 0x9a, 0x5b, 0xe2, 0x4b, 0x52, 0xf3, 0x22,
+    0x58, 0x09, 0xbe, 0xd6, 0xca, 0xd8, 0xc0, 0xa7, 0x4a, 0x5a, 0x2e, 0x6d, 0x11, 0xac, 0x05, 0xb3,
+    0xcb, 0x82, 0xf1, 0x95, 0xa0, 0x7c, 0xd8, 0x6f, 0x06, 0x42, 0x0a, 0x2b, 0x48, 0x35, 0x6c, 0x28,
+    0xa9, 0x78, 0x31, 0x0e, 0x80, 0xcf, 0x0a, 0x5b, 0x71, 0x3c, 0xe5, 0xb6, 0xd5, 0x28, 0x75, 0x1b,
+    0xd4, 0xd8, 0x2d, 0x2c, 0x73, 0xc5, 0xb6, 0xbb, 0x12, 0xd8, 0x86, 0x25, 0xa9, 0x45, 0xb5, 0xcd,
+    0x6e, 0x0c, 0xd4, 0xe6, 0x35, 0x31, 0x0b, 0x21, 0xb3, 0xcb, 0x91, 0xde, 0xec, 0x85, 0xd4, 0xad,
+    0x1d, 0x34, 0xbc, 0xe2, 0xd4, 0xee, 0xfa, 0x16, 0xd9, 0x78, 0x34, 0xfa, 0x92, 0x6b, 0xc2, 0x98,
+    0x90, 0x8b, 0xec, 0x9b, 0xde, 0xbc, 0xe1, 0xaf, 0xf5, 0xc6, 0x1f, 0xed, 0xbd, 0x79, 0x6b, 0xad,
+    0x92, 0xbb, 0x39, 0xa1, 0xaf, 0x0b, 0xa3, 0x5a, 0xc9, 0xb2, 0xf3, 0xaf, 0x77, 0x37, 0x0f, 0xd7,
+    0xa3, 0x9c, 0xaa, 0x4a, 0x99, 0xec, 0xbc, 0x2c, 0xcb, 0x63, 0xf9, 0xf8, 0x12, 0xea, 0xe7, 0xca,
+    0x30, 0x6e, 0x32, 0xa9, 0x24, 0xcf, 0xdf, 0xb5, 0x70, 0xb4, 0x43, 0xab, 0x74, 0x36, 0x06, 0xee,
+    0x3d, 0x4a, 0xdd, 0xd4, 0x28, 0xed, 0xb5, 0xf1, 0x50, 0x37, 0x3e, 0x08, 0x75, 0x89, 0xef, 0x89,
+    0x25, 0x33, 0x03, 0x0d, 0xb9, 0xf1, 0x0f, 0xdf, 0x09, 0xa7, 0xa8, 0x22, 0x73, 0x5e, 0xe1, 0x17,
+    0xf1, 0x20, 0x32, 0x94, 0xba, 0x0d, 0x72, 0x5f, 0xe2, 0x0b, 0x56, 0x04, 0x4d, 0x23, 0x58, 0x00,
+    0x6c, 0xee, 0x08, 0xf8, 0x1c, 0xe4, 0x99, 0x34, 0xcd, 0x1a, 0x26, 0x3a, 0xd5, 0xf4, 0x1a, 0xf8,
+    0x76, 0xab, 0xc1, 0x05, 0x7d, 0xc8, 0x06, 0x3d, 0x85, 0x5e, 0x77, 0x0c, 0x0e, 0xf6, 0xa8, 0x58,
+    0x5b, 0xf1, 0x63, 0x95, 0xf7, 0xbe, 0x55, 0xad, 0x3a, 0x9c, 0xd2, 0x56, 0x28, 0xe9, 0xaf, 0x48,
+    0xd5, 0x02, 0xd3, 0x5c, 0x58, 0xaa, 0x84, 0x0c, 0xf0, 0xad, 0x0b, 0x50, 0xea, 0xf2, 0x1f, 0x71,
+    0xdc, 0x2e, 0xb9, 0xe1, 0x6d, 0x1d, 0xe0, 0xc9, 0x21, 0x3a, 0x22, 0xbd, 0x0f, 0xd0, 0xc6, 0x2a,
+    0xfa, 0x1a, 0xe0, 0x69, 0xb7, 0x7c, 0x46, 0xb7, 0xe6, 0xa4, 0xa3, 0x09, 0xf0, 0x8b, 0x0b, 0x4e,
+    0xb8, 0x93, 0x10, 0x4c, 0xac, 0xfa, 0xb1, 0x69, 0xb9, 0xe8, 0x04, 0x82, 0x2d, 0x46, 0xce, 0x56,
+    0x5f, 0x49, 0x5a, 0x09, 0xfa, 0x0a, 0xbd, 0xc8, 0x8a, 0x47, 0x71, 0x80, 0xef, 0x54, 0xad, 0x2b,
+    0x6e, 0xb9, 0x3f, 0xb5, 0x5c, 0xfb, 0x57, 0xe9, 0x15, 0x4a, 0x1d, 0x14, 0xb4, 0xa6, 0x46, 0x68,
+    0xe0, 0x2b, 0x5b, 0x49, 0xfb, 0x11, 0x5c, 0xcd, 0x6e, 0x45, 0x8c, 0x4f, 0x8b, 0x5d, 0xa7, 0x7f,
+    0xc6, 0x14, 0x6d, 0x6b, 0xb8, 0xcc, 0xc9, 0x82, 0xdb, 0x49, 0xc5, 0xbb, 0xf0, 0x76, 0xfb, 0x83,
+    0x45, 0x61, 0x97, 0x0d, 0xe3, 0xa4, 0x9f, 0x7a, 0xf0, 0xa6, 0xfa, 0xe7, 0x70, 0x70, 0xe2, 0x88,
+    0xf6, 0x6a, 0x67, 0xc5, 0xa7, 0x60, 0xc8, 0xbf, 0x81, 0xf7, 0x79, 0xc9, 0x2d, 0x5d, 0x46, 0x61,
+    0xda, 0x0d, 0x17, 0x0e, 0x76, 0xf0, 0xe2, 0x96, 0x8a, 0x65, 0xe1, 0xf3, 0xd3, 0x74, 0x16, 0x0e,
+    0xba, 0x2b, 0x96, 0xfd, 0x9c, 0x3e, 0xfd, 0x4e, 0x1a, 0x6b, 0xe0, 0xc2, 0x8a, 0x72, 0x1b, 0xd1,
+    0x78, 0x1f, 0x27, 0x20, 0x9d, 0x8c, 0xa2, 0xb8, 0xc0, 0xf0, 0xcc, 0x8c, 0x8d, 0xc2, 0x29, 0x54,
+    0xb3, 0xb3, 0x30, 0x8e, 0xf3, 0xbd, 0x77, 0x64, 0xa4, 0x44, 0x86, 0x07, 0xa8, 0x29, 0xb0, 0x49,
+    0xfe, 0x36, 0x4a, 0x46, 0xf1, 0xe1, 0x44, 0x16, 0xb8, 0x57, 0xa2, 0x29, 0xfe, 0xa3, 0x41, 0x2e,
+    0x93, 0x52, 0x99, 0x09, 0x01, 0xce, 0x4d, 0x81, 0x9b, 0x44, 0x48, 0xc9, 0xcd, 0xf7, 0xd9, 0xe3,
+    0xaf, 0x8b, 0xc2, 0x0b, 0x3f, 0xb8, 0x1b, 0x5e, 0x6c, 0x92, 0xae, 0xea, 0x22, 0x0c, 0xf0, 0x29,
+    0x3e, 0x7a, 0x1c, 0xc2, 0xe8, 0xb9, 0x07, 0x4e, 0x3b, 0x67, 0xc0, 0xaa, 0xfe, 0x09, 0xa5, 0xfd,
+    0x2f, 0xe7, 0x1f, 0xf1, 0xce, 0x12, 0x9f, 0x89, 0x04, 0x00, 0x00,
+};
+
+// web/settings.html: 37091 bytes, 26952 minified, 6897 gzipped
+#define SETTINGS_HTML_ETAG "\"6b76446c94c03a3d\""
+#define SETTINGS_HTML_GZ_LEN 6897
+const uint8_t SETTINGS_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xed, 0x72, 0xdb, 0x38,
+    0x92, 0xff, 0xfd, 0x14, 0x88, 0x26, 0x1b, 0x52, 0x37, 0x12, 0x2d, 0xf9, 0x2b, 0x19, 0xdb, 0x72,
+    0xca, 0xb1, 0x9d, 0x1d, 0x4f, 0x39, 0x4e, 0x2e, 0x76, 0x76, 0x2b, 0x35, 0x3b, 0xb5, 0xa6, 0x49,
+    0x48, 0xe2, 0x84, 0x22, 0x15, 0x92, 0x8a, 0xa3, 0xf1, 0xea, 0x1d, 0xf6, 0x45, 0xee, 0xa5, 0xee,
+    0x49, 0xae, 0xbb, 0x01, 0x90, 0x00, 0x3f, 0x24, 0xc5, 0xc9, 0x4c, 0xcd, 0x56, 0xdd, 0xed, 0x6d,
+    0x2c, 0x82, 0x40, 0xa3, 0xd1, 0x5f, 0xe8, 0x6e, 0x34, 0xb8, 0x87, 0x8f, 0x4e, 0x5f, 0x9f, 0x5c,
+    0xbf, 0x7f, 0x73, 0xc6, 0xc6, 0xd9, 0x24, 0x3c, 0xda, 0x38, 0x54, 0x7f, 0xb8, 0xeb, 0xc3, 0x9f,
+    0x09, 0xcf, 0x5c, 0x16, 0xb9, 0x13, 0x3e, 0x68, 0x7d, 0x0a, 0xf8, 0xdd, 0x34, 0x4e, 0xb2, 0x16,
+    0xf3, 0xe2, 0x28, 0xe3, 0x51, 0x36, 0x68, 0xdd, 0x05, 0x7e, 0x36, 0x1e, 0xf8, 0xfc, 0x53, 0xe0,
+    0xf1, 0x2e, 0x3d, 0x74, 0x82, 0x28, 0xc8, 0x02, 0x37, 0xec, 0xa6, 0x9e, 0x1b, 0xf2, 0x41, 0xbf,
+    0x05, 0x30, 0xb2, 0x20, 0x0b, 0xf9, 0xd1, 0xa9, 0x9b, 0xb9, 0xd7, 0x89, 0xeb, 0x7d, 0xe0, 0x09,
+    0xbb, 0xe2, 0x59, 0x16, 0x44, 0xa3, 0xf4, 0x70, 0x53, 0xbc, 0xdb, 0x38, 0x4c, 0xb3, 0x39, 0xfe,
+    0xfd, 0x2f, 0x76, 0xcf, 0x6e, 0xe3, 0xcf, 0xdd, 0x34, 0xf8, 0x0d, 0xde, 0xef, 0xc3, 0xef, 0xc4,
+    0xe7, 0x49, 0x17, 0x9a, 0x0e, 0xd8, 0x62, 0xe3, 0x36, 0xf6, 0xe7, 0xd0, 0x61, 0x08, 0xd3, 0x77,
+    0x87, 0xee, 0x24, 0x08, 0xe7, 0xfb, 0xac, 0xeb, 0x4e, 0xa7, 0x21, 0xef, 0xa6, 0xf3, 0x34, 0xe3,
+    0x93, 0x0e, 0x7b, 0x11, 0x06, 0xd1, 0x87, 0x57, 0xae, 0x77, 0x45, 0xcf, 0x2f, 0xa1, 0x67, 0x87,
+    0x59, 0x57, 0x7c, 0x14, 0x73, 0xf6, 0xee, 0xdc, 0xea, 0xb0, 0xe3, 0x04, 0x90, 0xeb, 0xb0, 0xd4,
+    0x8d, 0xd2, 0x6e, 0xca, 0x93, 0x60, 0x78, 0xc0, 0x26, 0x6e, 0x32, 0x0a, 0xa2, 0x7d, 0xd6, 0x3b,
+    0x60, 0x53, 0xd7, 0xf7, 0x69, 0xde, 0xad, 0xde, 0x14, 0x66, 0xbc, 0x05, 0x6c, 0x47, 0x49, 0x3c,
+    0x8b, 0xfc, 0x7d, 0xf6, 0xdd, 0x70, 0x17, 0xff, 0x83, 0x68, 0x38, 0xb8, 0x7e, 0x37, 0x88, 0x60,
+    0x21, 0xf7, 0x30, 0xfa, 0xb3, 0x58, 0xf9, 0x3e, 0xdb, 0xeb, 0xd1, 0xa8, 0x1c, 0x1e, 0x73, 0x67,
+    0x59, 0x5c, 0x86, 0x32, 0x84, 0x19, 0xe5, 0xaa, 0x12, 0xd7, 0x0f, 0x66, 0xe9, 0x3e, 0xeb, 0x6f,
+    0xd1, 0x64, 0xb8, 0xec, 0xb1, 0xeb, 0xc7, 0x77, 0x38, 0x14, 0x9a, 0xd8, 0x33, 0xf8, 0x6f, 0x32,
+    0xba, 0x75, 0xed, 0x5e, 0x87, 0xfe, 0xe3, 0xf4, 0xdb, 0x34, 0x3d, 0xb2, 0x86, 0xe6, 0xd6, 0x21,
+    0xc3, 0xba, 0xb9, 0x9b, 0x74, 0x47, 0x08, 0x14, 0x78, 0x63, 0xf7, 0xb7, 0x77, 0x7d, 0x3e, 0xea,
+    0xb0, 0xef, 0xf6, 0xf6, 0x9e, 0x72, 0xee, 0xb2, 0xde, 0x5f, 0xe0, 0xf7, 0xd3, 0xbd, 0x9d, 0x5b,
+    0x77, 0x8b, 0xf5, 0x7b, 0xbd, 0xbf, 0x00, 0x28, 0x2f, 0x0e, 0xe3, 0x64, 0x9f, 0xdd, 0x8d, 0x83,
+    0x8c, 0x6b, 0x6b, 0xdf, 0x16, 0x6b, 0xaf, 0xe2, 0x28, 0xfe, 0xe9, 0x21, 0xa1, 0x32, 0xfe, 0x39,
+    0xeb, 0xba, 0x61, 0x30, 0x82, 0x75, 0x7a, 0x30, 0x1d, 0x4f, 0x74, 0xcc, 0xc6, 0x7d, 0x22, 0x4c,
+    0x4e, 0x56, 0x62, 0x18, 0xb0, 0x94, 0x03, 0x61, 0x9f, 0x4d, 0x3f, 0xeb, 0x5d, 0xa7, 0x5a, 0xcf,
+    0x7e, 0x4f, 0x81, 0x8f, 0xa7, 0xae, 0x17, 0x64, 0xc0, 0xdd, 0x9e, 0xf3, 0x43, 0x4e, 0x71, 0x98,
+    0x06, 0x3a, 0x97, 0xd0, 0x44, 0x48, 0x81, 0xef, 0xf3, 0x08, 0x5e, 0xf9, 0x41, 0x3a, 0x0d, 0x5d,
+    0x18, 0x15, 0xc5, 0x11, 0x97, 0xc3, 0x7c, 0xde, 0x0d, 0xa2, 0xe9, 0x2c, 0x53, 0x62, 0x23, 0xb0,
+    0xd8, 0x26, 0x8a, 0xd7, 0x2d, 0x22, 0x04, 0xc9, 0x84, 0x65, 0xa7, 0x88, 0x00, 0xce, 0xd2, 0xdf,
+    0xc5, 0x9e, 0x92, 0xc1, 0x48, 0x37, 0x8d, 0x50, 0xe2, 0x9d, 0x20, 0xd4, 0x3e, 0x71, 0x2c, 0x8d,
+    0xc3, 0xc0, 0x67, 0xdf, 0xf9, 0xbe, 0x5f, 0x21, 0xa0, 0x5c, 0xf7, 0xed, 0x2c, 0xcb, 0xe2, 0xa8,
+    0xc4, 0x3b, 0xc9, 0xa3, 0x32, 0x47, 0x14, 0x64, 0xb1, 0x9c, 0x62, 0x5a, 0x9c, 0x69, 0x6b, 0xa7,
+    0x86, 0x49, 0x34, 0x87, 0x37, 0x4b, 0x52, 0x04, 0x32, 0x8d, 0x03, 0xb1, 0x24, 0x6d, 0xdd, 0xfd,
+    0xbd, 0xca, 0x6a, 0x04, 0xf1, 0xbb, 0x59, 0x3c, 0x55, 0x0b, 0xca, 0x12, 0x50, 0x0e, 0x50, 0xe2,
+    0x18, 0xc8, 0xe2, 0x86, 0x21, 0xf0, 0x60, 0x3b, 0x2d, 0x50, 0xdf, 0x1f, 0xc7, 0x9f, 0x2a, 0xc2,
+    0xf7, 0xdd, 0xee, 0xee, 0xde, 0x33, 0x7f, 0x5b, 0x8e, 0x1d, 0xc6, 0xc9, 0x64, 0x5f, 0xfc, 0x0c,
+    0xdd, 0x8c, 0xbf, 0xb7, 0xbb, 0xfd, 0xe9, 0xe7, 0x76, 0x01, 0xc2, 0x49, 0x39, 0xf0, 0xd3, 0x77,
+    0x93, 0x79, 0x85, 0x0e, 0xde, 0xd3, 0xdd, 0xa7, 0xbe, 0xd6, 0xd3, 0x77, 0xa3, 0x51, 0x75, 0x36,
+    0xdf, 0xdb, 0xde, 0xdd, 0xd9, 0xd5, 0x01, 0x4e, 0x10, 0xd1, 0x7b, 0xb5, 0x32, 0xa1, 0x77, 0x39,
+    0xc1, 0x50, 0x8f, 0xc4, 0xca, 0x75, 0x52, 0xec, 0x48, 0xf1, 0x99, 0xc4, 0xfe, 0x0c, 0x0c, 0x48,
+    0x18, 0xa4, 0x59, 0x2e, 0x8b, 0x82, 0x1c, 0x5b, 0x3d, 0xb3, 0x0b, 0x30, 0x65, 0x52, 0x46, 0x65,
+    0xf8, 0x6c, 0xf8, 0xc3, 0xd0, 0xad, 0x95, 0x02, 0xfe, 0x03, 0xf7, 0xf8, 0xb0, 0x9e, 0x49, 0x25,
+    0x19, 0x92, 0xb3, 0xde, 0xc6, 0xb0, 0x9a, 0x89, 0x50, 0x84, 0x83, 0x42, 0x9c, 0x87, 0x21, 0x87,
+    0x47, 0x12, 0x54, 0xc2, 0x21, 0x2d, 0xc4, 0x55, 0x31, 0x7b, 0x02, 0x4c, 0x69, 0xe6, 0x9c, 0xbe,
+    0x80, 0x82, 0x7f, 0x02, 0x2d, 0x29, 0x72, 0xb9, 0x08, 0x2e, 0x31, 0x43, 0xfd, 0xde, 0x56, 0xa7,
+    0xbf, 0xb5, 0xd7, 0xd9, 0xda, 0xde, 0x01, 0x63, 0xb4, 0xd5, 0x2e, 0x83, 0x76, 0xfc, 0xc4, 0x1d,
+    0xc1, 0x3a, 0x46, 0x00, 0x5d, 0xd3, 0xe0, 0x5d, 0xa3, 0x9f, 0x47, 0xd2, 0x5f, 0xd1, 0x45, 0x49,
+    0x81, 0x24, 0x18, 0x8d, 0x33, 0x45, 0x15, 0x6d, 0x54, 0x34, 0x8c, 0x71, 0x14, 0x10, 0x02, 0x5e,
+    0xea, 0x6f, 0x70, 0x6b, 0x52, 0xf0, 0xee, 0xb8, 0x18, 0x7d, 0x1b, 0x87, 0x7e, 0x8d, 0xd8, 0x6b,
+    0x06, 0xa9, 0x18, 0xef, 0xc3, 0xfe, 0x16, 0xa0, 0xe8, 0xe4, 0x74, 0x90, 0x22, 0x58, 0x11, 0x15,
+    0x35, 0x7c, 0x57, 0x19, 0xa9, 0x02, 0x88, 0xeb, 0x21, 0xcd, 0x53, 0xdd, 0x04, 0x09, 0x9e, 0x8d,
+    0xdc, 0x69, 0xae, 0xf9, 0xe5, 0xce, 0xb9, 0x25, 0x30, 0x84, 0xb6, 0x6e, 0x33, 0xda, 0x93, 0xa6,
+    0xd7, 0x44, 0x6a, 0x5b, 0x82, 0x85, 0x5e, 0x5d, 0x01, 0xba, 0x56, 0x7c, 0x97, 0x6d, 0x69, 0xfc,
+    0xe9, 0x70, 0x7b, 0xd8, 0x20, 0xa1, 0xba, 0x40, 0xfb, 0x6e, 0x3a, 0xe6, 0x7e, 0x21, 0x23, 0xc5,
+    0x62, 0xb2, 0xf9, 0x94, 0xc3, 0x9e, 0x03, 0xe2, 0xae, 0xad, 0x1d, 0x9f, 0x0f, 0xe8, 0xdf, 0x2e,
+    0x48, 0xc5, 0x14, 0x6d, 0x00, 0x8a, 0xd9, 0x6c, 0x12, 0x01, 0xf0, 0x84, 0x4f, 0xb9, 0x9b, 0xd9,
+    0xb8, 0xda, 0xee, 0x30, 0x80, 0xdd, 0x79, 0x12, 0x44, 0xb0, 0x87, 0xda, 0x7d, 0xc4, 0xaf, 0xc3,
+    0xfa, 0xc3, 0xa4, 0xdd, 0x96, 0x84, 0xeb, 0x6b, 0xdb, 0xa9, 0x6e, 0xa0, 0xcc, 0xe9, 0x4b, 0x1a,
+    0x59, 0xb2, 0x9d, 0x0f, 0xd3, 0xc7, 0xba, 0x9d, 0xa1, 0x62, 0x57, 0x57, 0x69, 0x1b, 0x22, 0xf7,
+    0x3b, 0x69, 0x1b, 0xad, 0xdb, 0x59, 0xa1, 0x4b, 0xca, 0x9a, 0x3c, 0xab, 0xa1, 0x99, 0xa3, 0xeb,
+    0x8d, 0x2e, 0xe5, 0x86, 0x22, 0xed, 0xf6, 0x72, 0x31, 0x77, 0xc3, 0xea, 0x06, 0x3b, 0x8d, 0xd5,
+    0xf2, 0x87, 0xc1, 0x67, 0x0e, 0x2c, 0x27, 0x1e, 0xf5, 0x70, 0x13, 0x1d, 0x66, 0xf4, 0xc3, 0xd8,
+    0x69, 0xc6, 0x12, 0xaa, 0x78, 0xd2, 0x79, 0x66, 0x38, 0x39, 0xbb, 0xb0, 0xd2, 0xdf, 0x40, 0xe3,
+    0x7d, 0xd2, 0xf5, 0x9e, 0x8e, 0x82, 0x83, 0xba, 0xf3, 0x89, 0x57, 0xf5, 0xac, 0xd6, 0x36, 0xfe,
+    0x3a, 0x4b, 0xb3, 0x60, 0x38, 0xef, 0x4a, 0xdf, 0xc1, 0x70, 0x54, 0x08, 0x5c, 0xb7, 0xf0, 0x2a,
+    0x1a, 0x25, 0xa8, 0xe4, 0xa4, 0x95, 0xbc, 0x0f, 0xcd, 0xf9, 0xdb, 0x15, 0xce, 0x9f, 0x7c, 0xfa,
+    0x41, 0x6c, 0xad, 0x9f, 0xbb, 0x6a, 0xd1, 0xcf, 0x7a, 0x9f, 0xc6, 0xe0, 0xd7, 0x80, 0x30, 0x0c,
+    0xc3, 0xf8, 0xae, 0x3b, 0x57, 0xfa, 0x9e, 0xe3, 0x92, 0x3b, 0x75, 0xba, 0xb3, 0x54, 0x65, 0x89,
+    0xb0, 0x6d, 0x25, 0x0e, 0xe7, 0x1b, 0x15, 0xee, 0xbc, 0x5d, 0x5c, 0x47, 0xe1, 0x56, 0x2d, 0xed,
+    0x14, 0xba, 0xb7, 0xdc, 0x60, 0xec, 0x6d, 0x18, 0x7b, 0x1f, 0xea, 0xa4, 0xa0, 0x41, 0xa6, 0x34,
+    0x58, 0xe4, 0x66, 0x75, 0x98, 0xde, 0x94, 0xf2, 0x90, 0x7b, 0x59, 0x61, 0xe2, 0xca, 0xfe, 0x53,
+    0xaf, 0xc1, 0x7f, 0x5a, 0xa6, 0xa9, 0x15, 0xb3, 0xae, 0xb0, 0x58, 0x6e, 0x84, 0xab, 0xb6, 0xc4,
+    0xa4, 0x47, 0xc5, 0x2a, 0x1b, 0x7b, 0x0d, 0x4f, 0x53, 0x77, 0xc4, 0x75, 0xef, 0x53, 0xf9, 0xec,
+    0x55, 0x04, 0x6b, 0xc9, 0x5e, 0xaf, 0x56, 0x02, 0xac, 0xc3, 0x93, 0x24, 0x4e, 0xaa, 0x8e, 0x85,
+    0xff, 0xd4, 0x2f, 0x5c, 0xc2, 0xef, 0x9e, 0x6e, 0xf5, 0xbd, 0xad, 0x9d, 0x82, 0x5c, 0xfd, 0x82,
+    0x5c, 0xc3, 0x5d, 0x6f, 0xcf, 0xbb, 0x35, 0x40, 0xa6, 0x33, 0xcf, 0x83, 0x9f, 0x15, 0xc7, 0x69,
+    0x87, 0xfb, 0x3a, 0xd0, 0xfe, 0xee, 0xee, 0xd3, 0x06, 0xa0, 0xde, 0x36, 0x57, 0x40, 0x53, 0x08,
+    0x2c, 0xbc, 0x71, 0x57, 0x8f, 0x7a, 0x0a, 0xd5, 0x4f, 0x38, 0xd8, 0xf7, 0xe0, 0x13, 0xd7, 0x7b,
+    0x26, 0x3c, 0x9d, 0x85, 0x59, 0x9a, 0x9b, 0x3d, 0x03, 0x70, 0xa3, 0x73, 0xac, 0x33, 0x67, 0x57,
+    0x69, 0x97, 0xd2, 0x9f, 0x2d, 0xa1, 0x5e, 0x55, 0x05, 0xaa, 0xd1, 0xdc, 0x02, 0x11, 0xe9, 0xb1,
+    0x95, 0x24, 0xae, 0x62, 0xc9, 0xf3, 0x28, 0x53, 0xba, 0x5f, 0x9a, 0x24, 0x72, 0xbe, 0x9e, 0x23,
+    0x66, 0xce, 0x59, 0xef, 0x24, 0x6b, 0x11, 0xa4, 0xde, 0x37, 0x74, 0xd3, 0xac, 0xeb, 0x8d, 0x83,
+    0xd0, 0x2f, 0xf6, 0x09, 0x85, 0x4a, 0x1e, 0xc9, 0xe8, 0x0b, 0x0a, 0x26, 0xa3, 0x42, 0xa7, 0x84,
+    0x8d, 0xc8, 0xc9, 0xb4, 0x53, 0xe3, 0x4c, 0xd5, 0xc5, 0x73, 0xbb, 0xa8, 0x89, 0x00, 0x97, 0x76,
+    0x3a, 0xb1, 0x08, 0x80, 0xd9, 0x10, 0xd6, 0x4d, 0xb2, 0xee, 0x56, 0xaf, 0xc9, 0x39, 0x46, 0xa2,
+    0x74, 0x79, 0xe4, 0x57, 0x15, 0xaf, 0x62, 0x80, 0x55, 0x57, 0x1c, 0x77, 0xb8, 0x29, 0x43, 0xfe,
+    0xc3, 0x4d, 0x99, 0x6a, 0xc0, 0xe8, 0x1e, 0xfe, 0xf8, 0xc1, 0x27, 0xe6, 0x01, 0x4d, 0xd2, 0x41,
+    0x2b, 0x97, 0xb8, 0x96, 0xd9, 0x2e, 0x6c, 0x25, 0x36, 0x8e, 0xfb, 0x7a, 0x5e, 0x01, 0x40, 0xf5,
+    0xa1, 0x11, 0x6c, 0x91, 0xaf, 0x3a, 0x75, 0xd3, 0xd9, 0x2d, 0xe5, 0x18, 0x5a, 0x47, 0x2a, 0xe9,
+    0xc0, 0x9e, 0xb0, 0x93, 0x38, 0x1a, 0x06, 0xa3, 0x59, 0xe2, 0xa2, 0x0c, 0x1f, 0x6e, 0x4e, 0x11,
+    0x0b, 0x80, 0x2f, 0x67, 0xc1, 0xd1, 0x61, 0x8c, 0x2b, 0xc5, 0x94, 0x47, 0x4b, 0xc7, 0x06, 0x96,
+    0xd1, 0xa2, 0x19, 0x64, 0x9b, 0x46, 0xbe, 0xd6, 0xd1, 0x19, 0x51, 0x11, 0x63, 0x4e, 0x36, 0x4c,
+    0xe2, 0x09, 0x13, 0x79, 0x91, 0x9c, 0x2a, 0x62, 0x1e, 0x11, 0x8d, 0xe2, 0x26, 0x2c, 0x46, 0xb7,
+    0x68, 0x3a, 0x1c, 0xa4, 0x4d, 0xa4, 0xa2, 0xd6, 0x16, 0xea, 0x40, 0xc8, 0xa3, 0x51, 0x36, 0x1e,
+    0xb4, 0xf6, 0x5a, 0x0c, 0xe0, 0x78, 0x7c, 0x0c, 0x5b, 0x00, 0x4f, 0x06, 0xad, 0x1e, 0xfd, 0x1f,
+    0x34, 0xba, 0x18, 0xb2, 0x46, 0x83, 0xd6, 0xcf, 0xbd, 0xee, 0x0f, 0xbf, 0xdc, 0xef, 0x2d, 0x10,
+    0x43, 0x69, 0xc7, 0xe2, 0xc8, 0x0b, 0x03, 0xef, 0xc3, 0xa0, 0xf5, 0x09, 0xb8, 0xea, 0x83, 0x23,
+    0x76, 0x02, 0xb0, 0xed, 0x76, 0xeb, 0xe8, 0x5d, 0x84, 0x96, 0x5e, 0x4b, 0xc4, 0x88, 0x01, 0x15,
+    0x0a, 0x90, 0x6d, 0xca, 0x31, 0x53, 0x86, 0x50, 0x58, 0x2c, 0x11, 0x78, 0xb7, 0x8e, 0x14, 0xed,
+    0x4a, 0x24, 0x4c, 0x25, 0xec, 0x5a, 0x2a, 0xe6, 0x83, 0x0d, 0xc6, 0x2a, 0x01, 0x69, 0x31, 0x12,
+    0x0e, 0x98, 0xb0, 0xc6, 0x98, 0x6a, 0xcb, 0x93, 0xc3, 0x44, 0xf8, 0x97, 0x47, 0x95, 0xad, 0x62,
+    0xd9, 0xb0, 0x88, 0x78, 0x96, 0xe1, 0x82, 0x2f, 0xe8, 0x97, 0xb6, 0xce, 0x12, 0xb6, 0x72, 0x69,
+    0x95, 0xa5, 0x96, 0x17, 0x39, 0xde, 0x3e, 0x3a, 0x16, 0x5e, 0xc8, 0x2b, 0xf2, 0xa7, 0x80, 0x74,
+    0xd0, 0x84, 0x22, 0x21, 0x51, 0x5e, 0x15, 0x48, 0xb4, 0x8e, 0x4e, 0x21, 0x4c, 0x02, 0x5f, 0x09,
+    0x4c, 0x27, 0xe9, 0x24, 0xeb, 0xb2, 0x13, 0xc4, 0x96, 0x9d, 0xf9, 0x41, 0x86, 0xed, 0x9e, 0x94,
+    0x4e, 0x2e, 0x24, 0x26, 0xc7, 0xb0, 0x08, 0x54, 0x0b, 0x2c, 0xb5, 0xb6, 0x23, 0x7d, 0x49, 0xf2,
+    0x7d, 0x11, 0x1c, 0x90, 0xb6, 0xec, 0x94, 0xe8, 0x2a, 0x1d, 0xb6, 0xd6, 0xd1, 0xb1, 0xef, 0xb3,
+    0x4b, 0x7e, 0x27, 0xd7, 0x04, 0x4b, 0xda, 0xf9, 0x92, 0x25, 0x55, 0xe2, 0xd7, 0x5d, 0x5a, 0xe7,
+    0xc9, 0x38, 0x8e, 0x53, 0xce, 0x5c, 0x26, 0xc3, 0x13, 0xf2, 0x3c, 0x61, 0x7d, 0x80, 0xd4, 0x7e,
+    0xed, 0xd2, 0xb0, 0x43, 0x5a, 0x5e, 0x5b, 0x1e, 0x62, 0xd4, 0x0a, 0x9a, 0xea, 0x8b, 0x16, 0xaa,
+    0x25, 0xd8, 0x73, 0x2a, 0xd4, 0xae, 0x10, 0x6d, 0xe2, 0x8f, 0x2e, 0x65, 0xb9, 0x87, 0x82, 0x23,
+    0xc8, 0x07, 0x3a, 0x3a, 0x99, 0x25, 0x09, 0x8f, 0x3c, 0xd4, 0x52, 0xd1, 0xb0, 0x71, 0x28, 0xbd,
+    0x17, 0x52, 0x4f, 0xf9, 0x16, 0xfb, 0xc7, 0x53, 0x34, 0x1a, 0x0c, 0x14, 0x6a, 0x06, 0xa4, 0x79,
+    0x77, 0x75, 0x0a, 0xca, 0x74, 0xc5, 0x4e, 0xe3, 0x30, 0x74, 0x13, 0x66, 0xc3, 0x73, 0xfb, 0x70,
+    0x53, 0xf4, 0xa9, 0x74, 0x3e, 0x7b, 0xf7, 0x16, 0xac, 0xc4, 0x2c, 0x89, 0x99, 0x0d, 0x3f, 0x9b,
+    0xfb, 0xfd, 0xf5, 0xc5, 0x9b, 0xd6, 0xd1, 0x8b, 0x04, 0x76, 0xd8, 0x74, 0xcc, 0xde, 0xe0, 0xee,
+    0xc1, 0x6c, 0x68, 0x6b, 0x1e, 0xf0, 0xd3, 0x9b, 0xf7, 0xad, 0xa3, 0x9f, 0xdc, 0xa9, 0x1b, 0x71,
+    0x20, 0xf8, 0x7b, 0x1e, 0x31, 0x1b, 0x9a, 0x9a, 0xfb, 0x9f, 0x1c, 0x03, 0xd6, 0x27, 0x6e, 0x04,
+    0x9b, 0x81, 0x1b, 0xe5, 0xb8, 0x43, 0x6b, 0xf3, 0x90, 0xe3, 0x77, 0x30, 0xe4, 0x18, 0x2c, 0x7a,
+    0x02, 0x96, 0x44, 0x1b, 0x04, 0xed, 0x4b, 0xe6, 0xf9, 0xf1, 0x25, 0xd8, 0xdd, 0xbb, 0x00, 0x3c,
+    0x91, 0x97, 0x10, 0x2d, 0x79, 0x30, 0xc7, 0x8f, 0x2f, 0x97, 0x74, 0xbf, 0x7c, 0x8f, 0x52, 0x13,
+    0x88, 0x55, 0xcc, 0x60, 0x16, 0x1b, 0x9a, 0x9a, 0xfb, 0x9f, 0x5f, 0x02, 0x3d, 0xcf, 0x23, 0x5a,
+    0xc4, 0xdb, 0xd9, 0x94, 0x73, 0x66, 0x43, 0x53, 0x73, 0xff, 0x17, 0x6f, 0x2f, 0x90, 0xae, 0xee,
+    0x6f, 0x01, 0x2d, 0xe1, 0x2d, 0x87, 0xa8, 0xc6, 0x86, 0x46, 0x7d, 0xc4, 0xa6, 0x60, 0x7b, 0xad,
+    0x94, 0xd5, 0x09, 0xce, 0xf5, 0x38, 0x9e, 0xa5, 0x2e, 0x70, 0xe8, 0x8a, 0x4f, 0x5d, 0xd8, 0x50,
+    0x40, 0x51, 0x6a, 0x45, 0x28, 0x93, 0xfd, 0xa0, 0x5b, 0x55, 0x8a, 0x5a, 0x47, 0x97, 0xb0, 0xd1,
+    0x33, 0x1b, 0xc3, 0x9d, 0x36, 0xfb, 0xdf, 0xff, 0xf9, 0x37, 0xe0, 0xe6, 0xc5, 0x93, 0x09, 0x98,
+    0x42, 0xee, 0x37, 0x2e, 0xc7, 0x02, 0x86, 0x80, 0x23, 0x96, 0x25, 0xf1, 0x74, 0x8c, 0x83, 0x2d,
+    0x1a, 0xdd, 0x65, 0xd7, 0xb8, 0xef, 0x37, 0x8e, 0xea, 0x00, 0x89, 0x01, 0xb4, 0x0b, 0x03, 0x3a,
+    0x38, 0xa0, 0xb1, 0xa3, 0xd3, 0x3a, 0x7a, 0xc3, 0x93, 0x20, 0x06, 0xe1, 0xeb, 0x3b, 0x4b, 0x7b,
+    0x32, 0x60, 0xf2, 0x14, 0x76, 0x26, 0xe8, 0xc8, 0x4a, 0x1d, 0x2b, 0xe4, 0x2c, 0x6f, 0x4c, 0xa9,
+    0xfb, 0x89, 0x0b, 0x8d, 0x55, 0x0a, 0x8b, 0xd6, 0xfa, 0x0a, 0x5a, 0xeb, 0x36, 0xa7, 0x25, 0x9a,
+    0x6f, 0x6e, 0x09, 0x22, 0x71, 0xa8, 0xed, 0x04, 0xe0, 0x93, 0x66, 0x6e, 0x92, 0x89, 0xa9, 0x70,
+    0x8a, 0xb7, 0xa2, 0x81, 0x89, 0x16, 0x6d, 0x8e, 0x15, 0x80, 0x86, 0x10, 0x2a, 0xc4, 0xc9, 0x1c,
+    0x86, 0x73, 0xda, 0x58, 0x5e, 0x8a, 0x67, 0x46, 0x0d, 0x55, 0x54, 0xeb, 0xf7, 0x46, 0x69, 0xdb,
+    0x28, 0xf4, 0xd3, 0x0d, 0x1e, 0x3c, 0x95, 0x96, 0xa7, 0x07, 0xaa, 0xb5, 0xef, 0xa4, 0x33, 0xa4,
+    0xc0, 0x42, 0x8b, 0xf4, 0x77, 0xd0, 0xa6, 0x2b, 0x7b, 0x5e, 0x99, 0x1d, 0xba, 0xa1, 0x34, 0xd7,
+    0x6e, 0x1a, 0x7a, 0x40, 0x54, 0xb3, 0xd9, 0xd6, 0x6c, 0xb3, 0x5e, 0x08, 0x86, 0xfe, 0x15, 0x42,
+    0x45, 0x8a, 0x80, 0x61, 0xf1, 0x78, 0x58, 0xa5, 0x68, 0x31, 0x35, 0x32, 0xbd, 0x7b, 0x9b, 0x45,
+    0x2d, 0x53, 0x0e, 0x04, 0xb6, 0x8a, 0xff, 0xab, 0x68, 0x99, 0x7a, 0x49, 0x30, 0x05, 0xc9, 0x0a,
+    0x39, 0xee, 0x9a, 0x1f, 0xc0, 0xe8, 0x0d, 0x98, 0x65, 0x1d, 0xd0, 0xb3, 0xa0, 0x6f, 0x0a, 0x2d,
+    0x3f, 0xff, 0x22, 0x5a, 0xf8, 0x27, 0x20, 0x20, 0x36, 0x44, 0xb3, 0x30, 0xd4, 0x3b, 0x5d, 0xe3,
+    0xa6, 0xa3, 0x75, 0x14, 0xb6, 0x3e, 0x13, 0xb8, 0x18, 0xfd, 0x85, 0x0f, 0x7e, 0x1d, 0x4c, 0x38,
+    0x78, 0x12, 0xc6, 0x1b, 0x4a, 0x7c, 0x72, 0xff, 0x1c, 0xbd, 0x73, 0xd5, 0x3e, 0x9c, 0x45, 0x9e,
+    0x52, 0x12, 0xcd, 0xf5, 0x62, 0xf7, 0x1b, 0x40, 0xbf, 0x34, 0x13, 0x7e, 0xe2, 0x80, 0xf9, 0xb1,
+    0x37, 0x03, 0x3d, 0xcf, 0x9c, 0x11, 0xcf, 0xce, 0x42, 0x8e, 0x3f, 0x5f, 0xcc, 0xcf, 0x7d, 0xdb,
+    0xc2, 0xf7, 0x56, 0xdb, 0x21, 0x15, 0x3b, 0xd8, 0x08, 0x86, 0xcc, 0xc6, 0x16, 0x47, 0x78, 0x83,
+    0xec, 0xd1, 0x60, 0xc0, 0xf6, 0x10, 0x58, 0x3a, 0x8e, 0xef, 0x2e, 0xd0, 0x55, 0x3b, 0x43, 0x9f,
+    0xcc, 0xb6, 0x84, 0x13, 0xba, 0xd7, 0xf5, 0x83, 0x51, 0x20, 0x26, 0xb1, 0xda, 0x07, 0x1b, 0x09,
+    0xcf, 0x66, 0x49, 0x74, 0xb0, 0xb1, 0xd8, 0x18, 0xf2, 0xcc, 0x1b, 0xdb, 0xd6, 0xa6, 0x3b, 0x0d,
+    0x36, 0x15, 0x66, 0x56, 0x07, 0x00, 0x4d, 0x38, 0x98, 0x28, 0x08, 0x53, 0xac, 0x37, 0xaf, 0xaf,
+    0xae, 0xad, 0xce, 0x86, 0x90, 0x2b, 0x08, 0x15, 0xee, 0xad, 0x13, 0x21, 0x7e, 0x5d, 0x24, 0x95,
+    0x05, 0x3d, 0xf0, 0xc8, 0x2d, 0xf0, 0xc8, 0x79, 0xde, 0xfc, 0x35, 0x8d, 0x23, 0x6b, 0xd1, 0xa1,
+    0xb3, 0xb9, 0x7d, 0xf6, 0xd3, 0xd5, 0xeb, 0x4b, 0x07, 0x2c, 0x12, 0xa8, 0x2d, 0x78, 0xfe, 0xf6,
+    0x3d, 0xce, 0x0f, 0x81, 0x96, 0x9b, 0xa4, 0xfc, 0x3c, 0xca, 0x68, 0x05, 0xed, 0x45, 0x7b, 0x03,
+    0xfe, 0xdf, 0xc9, 0xc6, 0x3c, 0xb2, 0x13, 0x36, 0x38, 0x62, 0x89, 0x83, 0x40, 0xec, 0xb6, 0x6a,
+    0xf4, 0xb1, 0xf1, 0x9e, 0x96, 0xec, 0x3b, 0x84, 0x23, 0x2e, 0x54, 0xb1, 0xd8, 0x77, 0xe8, 0xd7,
+    0x01, 0xad, 0xbc, 0xb0, 0x19, 0xb0, 0x36, 0xc6, 0x43, 0xd8, 0x37, 0x2a, 0x24, 0xf1, 0x65, 0x80,
+    0xfd, 0xaf, 0x7f, 0x31, 0xeb, 0x3c, 0x22, 0x78, 0x39, 0x5d, 0x16, 0x84, 0x0a, 0x2c, 0x05, 0x68,
+    0x02, 0xbc, 0x81, 0x79, 0xcb, 0xf4, 0x84, 0xb5, 0x47, 0x5c, 0x30, 0x92, 0xc0, 0x58, 0x6d, 0x1a,
+    0x96, 0x73, 0xb7, 0xd4, 0x7f, 0x92, 0x8e, 0x0a, 0x16, 0xf3, 0x70, 0x19, 0x83, 0x35, 0x07, 0x1b,
+    0x51, 0xe1, 0x21, 0x05, 0x63, 0x92, 0xd6, 0x30, 0x10, 0x40, 0x51, 0x2b, 0xe9, 0xdd, 0x05, 0x78,
+    0x78, 0x4e, 0xc2, 0x31, 0xcf, 0x6f, 0x5b, 0xc2, 0x27, 0xb5, 0xaa, 0x88, 0x14, 0xe4, 0x00, 0x1c,
+    0x56, 0x4c, 0x8c, 0x5e, 0x39, 0xc8, 0x57, 0x01, 0x1d, 0xdc, 0x32, 0x1d, 0x74, 0xe3, 0x70, 0xc3,
+    0xaf, 0x37, 0x20, 0x54, 0xf1, 0x0b, 0x63, 0xd7, 0x37, 0x78, 0x54, 0xe0, 0xab, 0x5c, 0x73, 0x8d,
+    0xb5, 0xa8, 0xbd, 0x29, 0xf8, 0xa4, 0x67, 0xa4, 0xab, 0xf6, 0xc3, 0x90, 0x58, 0x77, 0x19, 0x0d,
+    0x54, 0xa8, 0xae, 0x61, 0x2d, 0x0d, 0x95, 0xd8, 0x1b, 0xeb, 0xd3, 0x97, 0x0e, 0xab, 0xc4, 0x06,
+    0x19, 0x33, 0xd8, 0x92, 0x34, 0xaf, 0x0a, 0x0b, 0xa4, 0x9a, 0x44, 0x68, 0x8a, 0x4f, 0xb4, 0x3d,
+    0x15, 0xa4, 0xd0, 0x59, 0xad, 0xbf, 0x91, 0x9a, 0x22, 0xed, 0x1b, 0x08, 0xf9, 0xa3, 0xbb, 0x20,
+    0xf2, 0xe3, 0x3b, 0x87, 0x3a, 0x5c, 0xc5, 0xb3, 0xc4, 0xe3, 0x6d, 0xa6, 0x0c, 0x40, 0x61, 0x06,
+    0xc1, 0xdb, 0xd7, 0x7a, 0x48, 0x8b, 0x20, 0x5e, 0x93, 0x38, 0xd2, 0x2f, 0xa4, 0x26, 0xf5, 0x42,
+    0xda, 0x70, 0x88, 0xc4, 0x6d, 0x4b, 0x58, 0x4d, 0x30, 0x19, 0x5c, 0xa8, 0xa9, 0x10, 0x75, 0xd0,
+    0x59, 0xa1, 0xfc, 0xa4, 0xeb, 0x36, 0x77, 0xc0, 0xae, 0xb8, 0x00, 0x46, 0xbc, 0x45, 0xab, 0x28,
+    0x4d, 0xb2, 0x33, 0x04, 0xec, 0xec, 0xcf, 0x38, 0xf6, 0xb3, 0x03, 0x9a, 0x38, 0x18, 0xa0, 0x4a,
+    0x83, 0x8a, 0x0b, 0x1b, 0xf7, 0x68, 0x52, 0xe0, 0xfa, 0xfa, 0xf6, 0x57, 0xd0, 0x3c, 0x07, 0x38,
+    0x13, 0x8c, 0x22, 0x7b, 0xd2, 0x61, 0x7e, 0x0e, 0xd0, 0xd4, 0xac, 0x8f, 0x33, 0x9e, 0xcc, 0xaf,
+    0xc8, 0xd1, 0x00, 0x15, 0xbc, 0xd1, 0xcf, 0xa4, 0x7e, 0x46, 0x3c, 0xba, 0xb8, 0xf3, 0x3c, 0xbe,
+    0xc7, 0x69, 0x16, 0xad, 0x5f, 0x98, 0x79, 0xf6, 0x73, 0x23, 0x67, 0xe6, 0x61, 0x9b, 0x55, 0x74,
+    0x10, 0x58, 0x2e, 0x78, 0x74, 0x4a, 0x7d, 0xed, 0x09, 0x32, 0xa2, 0xcc, 0x8c, 0x42, 0x60, 0x0d,
+    0x5e, 0xe0, 0x93, 0xa4, 0x22, 0xed, 0x8f, 0x76, 0x5b, 0x27, 0x3f, 0xed, 0x11, 0x8b, 0xb2, 0xc0,
+    0xe4, 0xf2, 0x01, 0x63, 0x75, 0x4b, 0x2d, 0x89, 0x87, 0x86, 0x5a, 0xb3, 0xcb, 0xc7, 0x33, 0x30,
+    0xd9, 0x49, 0xf0, 0x1b, 0x59, 0x62, 0x30, 0xcc, 0xa4, 0x47, 0x0b, 0xd3, 0xb8, 0x0a, 0x8c, 0x12,
+    0x30, 0xca, 0x6e, 0x36, 0x4b, 0x89, 0xdc, 0x3b, 0xbd, 0x3e, 0xc0, 0xcf, 0x15, 0xf0, 0x40, 0x12,
+    0x5c, 0xe0, 0xc4, 0x16, 0x82, 0x0f, 0x89, 0x13, 0x7f, 0x40, 0x2c, 0xe4, 0xbb, 0x84, 0x08, 0x63,
+    0xb7, 0x05, 0x64, 0xfc, 0x2d, 0x80, 0x67, 0xe3, 0x24, 0xbe, 0x13, 0xc2, 0x44, 0xf6, 0xef, 0xe6,
+    0xc7, 0xeb, 0xeb, 0x37, 0xec, 0xf1, 0xbd, 0x9a, 0x70, 0xb1, 0x0f, 0x0f, 0xd8, 0x7d, 0x71, 0x93,
+    0x93, 0x2e, 0x07, 0x29, 0xcc, 0xfe, 0x41, 0xb1, 0x1d, 0x68, 0x96, 0xff, 0x91, 0x5f, 0x08, 0x42,
+    0xb1, 0x9b, 0xfb, 0x8e, 0xfa, 0x0d, 0x82, 0x8e, 0x3b, 0x76, 0x82, 0x2e, 0x72, 0xa2, 0xa9, 0x55,
+    0x61, 0xcf, 0x35, 0xf9, 0x8c, 0x43, 0x99, 0x65, 0xb5, 0xad, 0x0b, 0xa0, 0x72, 0xee, 0x1e, 0x50,
+    0xdb, 0x3e, 0xca, 0x72, 0x5b, 0xec, 0x27, 0xaf, 0x44, 0xd4, 0x6f, 0x5b, 0x2f, 0x81, 0xdb, 0xdc,
+    0xc7, 0x68, 0x35, 0xd4, 0x06, 0xc0, 0xde, 0xc7, 0xbe, 0x67, 0x5c, 0xa5, 0x59, 0x3b, 0xcc, 0xca,
+    0xcd, 0xf7, 0xa2, 0x7d, 0x50, 0xcf, 0x4c, 0xa9, 0xdd, 0xb5, 0x0c, 0x15, 0x11, 0xef, 0x03, 0xb8,
+    0xda, 0xb0, 0x65, 0x9a, 0x1e, 0x0d, 0xec, 0x94, 0xf4, 0xab, 0x86, 0x54, 0xb9, 0xc9, 0xa9, 0x41,
+    0x5b, 0x59, 0xa0, 0x12, 0xc6, 0x22, 0x2b, 0xf1, 0xed, 0x70, 0x6d, 0x36, 0xab, 0x32, 0xd8, 0xd6,
+    0x4c, 0xab, 0xef, 0x88, 0x5c, 0x9a, 0xa3, 0xde, 0xd1, 0x66, 0x0e, 0xb1, 0xb6, 0xb5, 0xc4, 0x3c,
+    0x6b, 0x11, 0x57, 0x1d, 0x28, 0xed, 0x35, 0x79, 0x53, 0x10, 0x65, 0x73, 0xb0, 0x4d, 0xc0, 0xf4,
+    0xe7, 0xf5, 0x9d, 0x80, 0xf9, 0x1d, 0xab, 0x42, 0xb1, 0x92, 0x00, 0xe6, 0x06, 0x91, 0xea, 0x09,
+    0x96, 0xec, 0xfe, 0x5a, 0xe6, 0xc6, 0x92, 0x16, 0x48, 0x59, 0x48, 0xe9, 0xe2, 0xa1, 0xaa, 0xf6,
+    0x68, 0xe3, 0xc0, 0x7d, 0x29, 0x00, 0x37, 0x24, 0xf9, 0xf1, 0xfa, 0xd5, 0x05, 0xee, 0x34, 0x45,
+    0x6a, 0x46, 0xcb, 0xd8, 0xca, 0x84, 0xad, 0x48, 0xd6, 0xa8, 0x5c, 0x8d, 0x4a, 0x7d, 0xcb, 0xcc,
+    0xd9, 0x65, 0x9c, 0xcb, 0xfe, 0x9c, 0x67, 0x0e, 0xc3, 0x18, 0x01, 0x23, 0x4f, 0x08, 0x57, 0xe3,
+    0xbb, 0x47, 0x98, 0x94, 0xb1, 0x74, 0x67, 0xb1, 0x32, 0xb3, 0x42, 0x71, 0xe2, 0x4e, 0x6d, 0xb4,
+    0xc8, 0x81, 0xff, 0xb9, 0xad, 0x6f, 0x03, 0x74, 0x24, 0xa9, 0x99, 0xcd, 0x73, 0x78, 0xb6, 0x27,
+    0x24, 0x87, 0xb9, 0xed, 0xa6, 0xa3, 0x47, 0xad, 0xcf, 0x25, 0x3c, 0x93, 0x61, 0x95, 0x3b, 0x89,
+    0x38, 0x91, 0xaf, 0xb7, 0xbd, 0xd2, 0x74, 0xdc, 0x94, 0xc2, 0x20, 0x65, 0xed, 0x5b, 0xc2, 0x13,
+    0x77, 0x6f, 0x89, 0x34, 0xc9, 0x8c, 0x43, 0x43, 0x61, 0xff, 0x27, 0x64, 0xff, 0x2b, 0x31, 0x94,
+    0x2a, 0x4b, 0x68, 0x1d, 0x3d, 0xbe, 0xc7, 0xbf, 0x8b, 0xba, 0x28, 0xb3, 0xa8, 0x43, 0xa8, 0x07,
+    0x80, 0x8b, 0x42, 0x00, 0xf8, 0x77, 0x09, 0x00, 0xb1, 0x38, 0xec, 0x28, 0x7e, 0x2d, 0x96, 0xa4,
+    0xb4, 0x8c, 0x72, 0x81, 0x86, 0xa4, 0xa7, 0x16, 0x40, 0x71, 0x3f, 0x90, 0xf4, 0xb2, 0x2d, 0xb9,
+    0x56, 0x0b, 0x22, 0x29, 0x4c, 0x2a, 0x36, 0x06, 0xb7, 0x22, 0x71, 0x5a, 0x09, 0x71, 0x7d, 0xd8,
+    0x4a, 0x33, 0x5e, 0x03, 0xec, 0x94, 0x5e, 0x34, 0x04, 0x66, 0x37, 0xa8, 0x1b, 0xce, 0xaf, 0x71,
+    0x10, 0xd9, 0x16, 0x8a, 0x34, 0xb8, 0x68, 0xb3, 0x29, 0xe6, 0x3a, 0x4f, 0x93, 0x78, 0x5a, 0xf2,
+    0x60, 0x4c, 0x01, 0x21, 0xf1, 0x30, 0x64, 0x08, 0xcd, 0xd7, 0xbd, 0x97, 0xcc, 0xa7, 0x59, 0x0c,
+    0x6a, 0xf7, 0x02, 0xac, 0x0e, 0x6c, 0xb3, 0xde, 0x07, 0xf8, 0x7d, 0x05, 0xbf, 0xef, 0xb8, 0x0b,
+    0x96, 0x24, 0x81, 0xa7, 0xbf, 0xc3, 0x93, 0x37, 0x4b, 0x29, 0xeb, 0x68, 0x9d, 0x60, 0x37, 0xe9,
+    0x71, 0x51, 0xcf, 0x45, 0x2e, 0x30, 0x04, 0xf3, 0x67, 0x9c, 0xe7, 0x17, 0x32, 0x1d, 0xaf, 0xac,
+    0x7a, 0x74, 0xa4, 0x2c, 0xca, 0x3d, 0x48, 0x08, 0x2e, 0x29, 0xa2, 0x25, 0x90, 0xb1, 0xd4, 0xa6,
+    0xc4, 0x26, 0x8e, 0x68, 0xc1, 0x11, 0x08, 0x52, 0x3d, 0x5f, 0xcd, 0x27, 0xb7, 0x71, 0x48, 0x93,
+    0x9c, 0x88, 0x21, 0x07, 0x15, 0x58, 0xb4, 0x16, 0x1d, 0x54, 0x94, 0x03, 0xc9, 0x02, 0x2a, 0x90,
+    0xc4, 0xe1, 0x57, 0xd4, 0xab, 0x3a, 0x5a, 0xae, 0x5e, 0x1f, 0x1f, 0xc6, 0x22, 0x1a, 0xa3, 0x71,
+    0x7f, 0x97, 0xef, 0xab, 0x23, 0x05, 0xa5, 0x8c, 0x81, 0x74, 0x00, 0x4c, 0xc8, 0x8a, 0x77, 0x35,
+    0xc8, 0x4a, 0x8a, 0x16, 0xc3, 0x2c, 0xe5, 0xd6, 0xe6, 0xb6, 0x82, 0xa1, 0x84, 0xd4, 0x53, 0x34,
+    0x57, 0xde, 0x35, 0x68, 0x7a, 0x83, 0xa2, 0xa6, 0x93, 0x71, 0xc1, 0xba, 0xec, 0xf1, 0xe3, 0x7b,
+    0x18, 0x24, 0xcc, 0x37, 0x20, 0xda, 0x03, 0x17, 0x24, 0x7e, 0x89, 0xf5, 0x06, 0xf6, 0x56, 0x7b,
+    0x71, 0xb3, 0x92, 0xb8, 0x04, 0x53, 0x50, 0xf5, 0x21, 0xd0, 0x2a, 0xc4, 0xbe, 0x21, 0x00, 0x58,
+    0xd7, 0xc2, 0x13, 0x70, 0x70, 0x92, 0x32, 0x98, 0x7e, 0x7b, 0x71, 0x82, 0xf3, 0xe0, 0x4a, 0xe2,
+    0xc8, 0x0f, 0x72, 0xb6, 0xbc, 0x8b, 0x3e, 0x44, 0xf1, 0x1d, 0xc4, 0xca, 0x37, 0xab, 0x19, 0x73,
+    0xb3, 0x0c, 0x4b, 0x82, 0x3d, 0x8b, 0x20, 0xba, 0x47, 0xb0, 0x04, 0x4f, 0x31, 0xc6, 0x38, 0xd7,
+    0x92, 0xc6, 0xda, 0x94, 0xf4, 0x92, 0x52, 0x16, 0x4a, 0x87, 0xc7, 0x99, 0x8d, 0x3e, 0xf5, 0x71,
+    0x18, 0xda, 0x96, 0xee, 0x56, 0xd3, 0x96, 0x85, 0x43, 0xf0, 0xf4, 0xfc, 0xcc, 0x05, 0x27, 0x81,
+    0x4e, 0x26, 0x85, 0xf7, 0x86, 0xa5, 0x60, 0xd5, 0xb8, 0x01, 0x2d, 0x33, 0x05, 0x2e, 0xa0, 0xa5,
+    0x63, 0xd8, 0x52, 0x41, 0x34, 0xa0, 0xe5, 0x0a, 0x5b, 0x24, 0xb0, 0x86, 0x41, 0x78, 0x94, 0x6a,
+    0x8c, 0x79, 0x0d, 0x0d, 0xcb, 0x86, 0xc4, 0x53, 0xad, 0x7b, 0x3c, 0x5d, 0x0e, 0x1d, 0xb6, 0x6f,
+    0x03, 0xf8, 0x59, 0xe4, 0x57, 0xdd, 0xa2, 0x12, 0xbe, 0x36, 0x59, 0x2b, 0x33, 0xe9, 0x93, 0x8d,
+    0x83, 0xf4, 0x60, 0x03, 0xff, 0x2d, 0xc7, 0xa2, 0xaa, 0x2a, 0x8e, 0xa2, 0x2a, 0x8a, 0x8b, 0xae,
+    0xa9, 0x4a, 0x92, 0x27, 0x0e, 0x1f, 0x0e, 0x81, 0xbe, 0x40, 0xdd, 0xf8, 0x8e, 0x63, 0x04, 0x65,
+    0x61, 0xec, 0x69, 0x35, 0x4c, 0x8d, 0xcb, 0x16, 0x33, 0x73, 0x67, 0x9a, 0x50, 0x24, 0x71, 0xca,
+    0x87, 0xee, 0x2c, 0xcc, 0xec, 0x2a, 0x64, 0xa4, 0xc2, 0x19, 0x41, 0xd7, 0xc0, 0x0a, 0x56, 0xbb,
+    0x43, 0x70, 0x13, 0xa4, 0x2f, 0x22, 0xb6, 0x59, 0x84, 0x7e, 0xac, 0xb5, 0xda, 0xb4, 0x0c, 0x88,
+    0xe4, 0xe0, 0xf7, 0x25, 0x04, 0xb9, 0xe0, 0x1f, 0xc3, 0xa2, 0xb0, 0xac, 0xf8, 0xbd, 0x74, 0x55,
+    0x4c, 0x18, 0x22, 0x9c, 0xa1, 0x48, 0xde, 0x1c, 0xe8, 0xb8, 0xd3, 0x29, 0x10, 0xf8, 0x04, 0x0f,
+    0xb7, 0x6d, 0x8d, 0x5e, 0x7a, 0xb6, 0xa6, 0x3c, 0x24, 0x88, 0x52, 0x9e, 0x64, 0x2f, 0x38, 0x08,
+    0x16, 0xd7, 0xc7, 0x74, 0x0c, 0xc4, 0xdb, 0xa5, 0xe0, 0xa9, 0x60, 0xb7, 0x22, 0x11, 0xc6, 0x65,
+    0x6f, 0xe0, 0xd9, 0x1d, 0x91, 0x36, 0xd8, 0x85, 0xf7, 0x30, 0x74, 0x61, 0xe6, 0x06, 0x22, 0x03,
+    0xfb, 0x05, 0x80, 0x12, 0x27, 0x55, 0x5a, 0x40, 0x67, 0x66, 0x91, 0xb2, 0x7c, 0x8d, 0xe7, 0x78,
+    0xd5, 0x2d, 0xae, 0x42, 0xd7, 0xfc, 0x40, 0xbb, 0xc3, 0xe6, 0x85, 0xee, 0xe5, 0x3e, 0x8b, 0xec,
+    0x46, 0xd9, 0x48, 0xc7, 0x29, 0xca, 0xcc, 0x57, 0x28, 0xe3, 0x7e, 0x14, 0x67, 0x76, 0x5e, 0x7c,
+    0xd9, 0xb6, 0xda, 0xbf, 0xe4, 0x4b, 0xad, 0x80, 0x86, 0x85, 0xf8, 0x33, 0x08, 0xf7, 0x6d, 0x0a,
+    0x49, 0xd3, 0x0c, 0xb6, 0x4f, 0x64, 0x8e, 0xe1, 0xc4, 0xdd, 0xc6, 0x10, 0x9e, 0x8b, 0x76, 0x74,
+    0x5b, 0x5f, 0xe0, 0x01, 0x14, 0x00, 0x3e, 0x21, 0x09, 0x78, 0x0b, 0x38, 0xd8, 0xb9, 0xb3, 0x16,
+    0x0f, 0x87, 0x60, 0x51, 0xa0, 0xf7, 0x1c, 0x6c, 0x1e, 0x8c, 0x03, 0x3b, 0x35, 0x95, 0xbf, 0x44,
+    0x49, 0x02, 0xdb, 0x64, 0x5b, 0x42, 0x64, 0x64, 0xd7, 0x43, 0xd6, 0x63, 0x4f, 0x9e, 0xa8, 0x81,
+    0x47, 0x4c, 0xe2, 0xe1, 0x88, 0x06, 0x2d, 0xe2, 0xbc, 0x17, 0x2d, 0xfb, 0xb2, 0x2b, 0xc8, 0xa0,
+    0x58, 0xc2, 0xbe, 0xc0, 0x6c, 0xa1, 0x89, 0x90, 0x1c, 0x21, 0x41, 0x91, 0x64, 0x74, 0x8a, 0xf1,
+    0x97, 0xb3, 0xc9, 0x2d, 0xd0, 0xf0, 0xf2, 0xec, 0xaf, 0xc7, 0xd7, 0xe7, 0x7f, 0x3b, 0xfb, 0xe7,
+    0xf9, 0xe5, 0xcb, 0xf3, 0xcb, 0xf3, 0xeb, 0xf7, 0xe0, 0xac, 0x48, 0x90, 0xa6, 0x85, 0x2c, 0x73,
+    0xf5, 0x6b, 0x6c, 0xa4, 0xa4, 0x12, 0x1d, 0xf3, 0x0e, 0xd8, 0x71, 0x92, 0xb8, 0x73, 0x07, 0x6b,
+    0x03, 0xc8, 0x5c, 0xa6, 0x6d, 0xf2, 0xa3, 0x95, 0xe5, 0x24, 0x23, 0x05, 0xf4, 0x3e, 0xce, 0xb2,
+    0x24, 0x00, 0x0f, 0x0b, 0xa5, 0x4d, 0x38, 0xaf, 0x94, 0x73, 0xac, 0x49, 0x07, 0x6c, 0x12, 0xe0,
+    0x55, 0xd9, 0xdb, 0xda, 0x18, 0xad, 0xc3, 0xbe, 0x22, 0xab, 0x2b, 0x8b, 0x7a, 0xe8, 0xcf, 0x97,
+    0x65, 0x73, 0x65, 0x5d, 0x92, 0x4a, 0x5c, 0xe7, 0xe1, 0xb6, 0xcc, 0xb6, 0x0b, 0x42, 0xcd, 0xa6,
+    0x98, 0x94, 0x46, 0xb3, 0x6c, 0xc9, 0xfe, 0xe5, 0x54, 0x2d, 0x57, 0x99, 0xda, 0x9a, 0x78, 0x5d,
+    0x8c, 0x66, 0x8a, 0x34, 0x56, 0x6d, 0xd6, 0xb6, 0x26, 0x16, 0xce, 0xd9, 0x4c, 0xe5, 0xac, 0xab,
+    0x23, 0x37, 0x11, 0xba, 0x03, 0x58, 0xec, 0x5f, 0x13, 0x24, 0x11, 0x58, 0x62, 0x30, 0xa5, 0x4a,
+    0x6e, 0xea, 0x9c, 0x7b, 0x84, 0xa1, 0xf9, 0xdd, 0x31, 0x18, 0x4b, 0x88, 0xc8, 0x0a, 0xc7, 0x3b,
+    0x53, 0x8e, 0xb7, 0x31, 0x58, 0x05, 0x2b, 0x99, 0xd3, 0x14, 0xae, 0xa8, 0x68, 0x24, 0x73, 0x8c,
+    0x78, 0x44, 0xfc, 0xb9, 0xd1, 0x9d, 0x74, 0x8d, 0x26, 0xe6, 0xec, 0xb9, 0x4f, 0x5e, 0x3a, 0x0e,
+    0xb9, 0xa7, 0xb2, 0x56, 0x3a, 0xcb, 0xc7, 0xf0, 0x6f, 0x1f, 0xec, 0x5c, 0x84, 0x9e, 0x90, 0xd4,
+    0x19, 0x20, 0x10, 0x8d, 0x5c, 0x2c, 0x09, 0xcc, 0xb5, 0x53, 0x2a, 0x08, 0xcc, 0xcd, 0x84, 0x9b,
+    0x85, 0x11, 0x29, 0x26, 0x59, 0x74, 0x22, 0x52, 0xca, 0x90, 0xa8, 0x98, 0xa9, 0x94, 0x21, 0x4d,
+    0x42, 0xab, 0x33, 0x13, 0x1b, 0x2f, 0xe3, 0x64, 0x62, 0xcb, 0x70, 0x73, 0x15, 0x07, 0x09, 0x8f,
+    0x6a, 0xee, 0x58, 0x14, 0x99, 0x96, 0x88, 0xa3, 0x45, 0x57, 0xe2, 0x38, 0xa2, 0x4c, 0x17, 0x23,
+    0xbd, 0x49, 0xfa, 0x3c, 0x51, 0xb8, 0x16, 0xc9, 0x4d, 0x63, 0x50, 0x91, 0xdf, 0x12, 0x72, 0x87,
+    0x58, 0x5f, 0x8a, 0xd8, 0x78, 0xc5, 0xe2, 0x0d, 0x30, 0x22, 0xb8, 0x7e, 0x9e, 0xc7, 0x10, 0x52,
+    0x97, 0xac, 0x87, 0x32, 0x80, 0xaa, 0x50, 0x90, 0x03, 0x0a, 0x9f, 0x1a, 0x02, 0x57, 0x11, 0xe8,
+    0x98, 0x48, 0x7d, 0x63, 0xea, 0xd7, 0xcb, 0x58, 0x71, 0xce, 0xf2, 0x19, 0x86, 0xe3, 0xbd, 0x03,
+    0x9d, 0x0d, 0x21, 0xec, 0xbb, 0x8a, 0x11, 0xb9, 0xa7, 0x2d, 0xc4, 0x46, 0x24, 0x58, 0xf2, 0x4d,
+    0x92, 0xde, 0x7e, 0xcf, 0xac, 0x7f, 0xe2, 0xaa, 0x4f, 0x61, 0x1a, 0x07, 0x1c, 0x75, 0xbb, 0xd9,
+    0x60, 0xe4, 0x32, 0xd6, 0xa1, 0xec, 0x02, 0x2a, 0xc5, 0xa2, 0x40, 0x06, 0x4f, 0x4f, 0x57, 0x98,
+    0x0f, 0x79, 0xf8, 0xaa, 0xf2, 0x3e, 0x35, 0x01, 0xd1, 0xfd, 0x06, 0x76, 0x30, 0xac, 0xca, 0xcd,
+    0xca, 0x52, 0x84, 0x2b, 0x3a, 0x9f, 0x64, 0x22, 0xec, 0xf4, 0xaa, 0x05, 0x2d, 0xda, 0xf0, 0x72,
+    0x49, 0x67, 0xab, 0xb9, 0x32, 0x8d, 0xa0, 0x75, 0xc5, 0x80, 0x52, 0x05, 0x9a, 0x98, 0x10, 0x3c,
+    0x15, 0xb4, 0x61, 0x34, 0x5c, 0x41, 0x16, 0x38, 0x08, 0x3f, 0x92, 0xc2, 0x98, 0xdc, 0x86, 0x69,
+    0x30, 0x65, 0x99, 0x68, 0xab, 0x84, 0x54, 0xde, 0x2c, 0x53, 0x5c, 0xaa, 0x7e, 0x0e, 0x6b, 0x21,
+    0x2b, 0x35, 0x40, 0xeb, 0x15, 0x69, 0x08, 0x74, 0xd8, 0xf9, 0xa9, 0x46, 0x8d, 0x65, 0xcb, 0x3d,
+    0xf7, 0x5b, 0xaa, 0xb6, 0xe1, 0xf1, 0x3d, 0xf2, 0xd8, 0x51, 0xed, 0x32, 0xe6, 0x6a, 0x81, 0x40,
+    0xb8, 0x7e, 0x1c, 0x85, 0xf3, 0xb5, 0x71, 0x10, 0x11, 0xed, 0x9a, 0x08, 0x88, 0xce, 0xf5, 0x48,
+    0x68, 0x19, 0x86, 0x07, 0x21, 0x82, 0x3a, 0xbd, 0x26, 0x1a, 0xd8, 0xb5, 0x1e, 0x09, 0x95, 0xf6,
+    0x78, 0x18, 0x0a, 0xa7, 0xdc, 0x0b, 0x26, 0x6e, 0xc8, 0xde, 0xa0, 0x34, 0xa5, 0x0d, 0xc8, 0x44,
+    0xe4, 0xb7, 0x09, 0x74, 0x7c, 0x31, 0x20, 0x2d, 0x23, 0xa3, 0xda, 0xab, 0x19, 0x5c, 0xe3, 0x2d,
+    0x7a, 0x37, 0x33, 0x50, 0x2c, 0xc0, 0x75, 0x12, 0x44, 0x83, 0x56, 0x8f, 0x0a, 0x2b, 0x07, 0xad,
+    0x67, 0x25, 0x81, 0xc6, 0x4e, 0x88, 0xa5, 0x2c, 0x28, 0x34, 0xab, 0xdf, 0x9e, 0x3d, 0x7b, 0x66,
+    0x96, 0xbe, 0xf5, 0x29, 0xa5, 0x7a, 0xc1, 0xb1, 0x56, 0xe5, 0x36, 0x74, 0xa3, 0x0f, 0xa8, 0xfb,
+    0x54, 0x96, 0xcc, 0xec, 0x17, 0xd7, 0x27, 0xfb, 0xac, 0xd7, 0x61, 0x67, 0xd7, 0x3f, 0xd2, 0xdf,
+    0xc3, 0xc7, 0xfd, 0x7d, 0xb6, 0xd3, 0xdd, 0x6b, 0x1f, 0x6e, 0x12, 0xf0, 0x62, 0x37, 0xce, 0xfd,
+    0x58, 0xd3, 0x14, 0xa8, 0x34, 0xc6, 0xd7, 0x58, 0x02, 0xca, 0x20, 0x7d, 0xad, 0x01, 0x20, 0x44,
+    0x96, 0xe9, 0x3f, 0x13, 0xd9, 0x95, 0x3a, 0x33, 0x40, 0x08, 0x34, 0x59, 0x01, 0x01, 0xf8, 0x8f,
+    0x33, 0x02, 0xd7, 0x22, 0xb5, 0xb6, 0xa6, 0x1e, 0x8a, 0x45, 0x95, 0xe5, 0x4d, 0x4b, 0xcf, 0xa1,
+    0x30, 0x19, 0xd4, 0x38, 0x3e, 0x7e, 0x73, 0xd1, 0x5a, 0xdf, 0x24, 0xc5, 0x93, 0xa9, 0x1b, 0xcd,
+    0xd9, 0x5a, 0xda, 0x48, 0xa4, 0xaa, 0x53, 0xc6, 0x48, 0x57, 0x43, 0x13, 0x1b, 0xbc, 0x16, 0xcd,
+    0xce, 0x23, 0xcf, 0x69, 0xfd, 0xbf, 0x5a, 0xe6, 0x6a, 0x79, 0xf4, 0xb8, 0xdf, 0xeb, 0x91, 0x42,
+    0xa2, 0xca, 0xed, 0xb3, 0xad, 0xb5, 0xf5, 0xb1, 0x48, 0x04, 0x7e, 0x8d, 0x46, 0x5e, 0xc8, 0x44,
+    0xed, 0x4a, 0x8e, 0xcb, 0xe9, 0x1a, 0xf4, 0x8e, 0x0a, 0xd7, 0x60, 0x08, 0xfa, 0x3c, 0x78, 0xcd,
+    0x92, 0xce, 0x54, 0xea, 0x14, 0x50, 0xe6, 0x82, 0x0d, 0x15, 0x24, 0x52, 0x78, 0x20, 0x7e, 0x98,
+    0xcb, 0x87, 0xa0, 0x63, 0x38, 0xd4, 0xb5, 0x52, 0x4d, 0xbc, 0x4c, 0x01, 0x8d, 0xab, 0x19, 0xfd,
+    0xdd, 0xf2, 0xcd, 0x0c, 0x79, 0x31, 0x43, 0x44, 0x89, 0xe5, 0x9b, 0x1f, 0x5a, 0xe5, 0xb1, 0xa8,
+    0x86, 0xfe, 0x32, 0x25, 0x16, 0xd1, 0x36, 0xc8, 0xd2, 0xda, 0x94, 0x54, 0xb9, 0xf1, 0xb2, 0x8c,
+    0x1a, 0x39, 0x73, 0x7d, 0x17, 0x53, 0x2b, 0xd6, 0xee, 0x6e, 0xc8, 0xab, 0x1b, 0x9a, 0x26, 0xe9,
+    0x73, 0xc9, 0x12, 0x71, 0x31, 0x1b, 0xc0, 0xcc, 0x66, 0x7e, 0x45, 0x51, 0x55, 0x3b, 0xa5, 0x73,
+    0x17, 0xad, 0x65, 0x10, 0x62, 0x88, 0xb2, 0x6b, 0x41, 0xa8, 0x17, 0x39, 0x8c, 0x26, 0x59, 0xcd,
+    0xd3, 0xc9, 0x0f, 0x12, 0xd5, 0x0b, 0xfc, 0x77, 0x35, 0x59, 0xf1, 0x6d, 0x75, 0x95, 0xea, 0x38,
+    0xa1, 0x62, 0x8f, 0x5e, 0xcd, 0xd9, 0x2b, 0x9e, 0x25, 0x81, 0x67, 0xdc, 0x69, 0x10, 0xa5, 0x9b,
+    0xeb, 0xb1, 0xfe, 0x6f, 0x38, 0xd5, 0x0a, 0xa3, 0x94, 0x66, 0x7c, 0x0a, 0x76, 0xc4, 0xe9, 0xf5,
+    0x05, 0x96, 0x84, 0x5e, 0x19, 0xcb, 0x22, 0xaf, 0xbe, 0x58, 0x7f, 0xf6, 0x77, 0x51, 0x90, 0xad,
+    0x24, 0x0a, 0x66, 0xe5, 0xcb, 0xb3, 0x69, 0x99, 0xfa, 0x12, 0x49, 0xf0, 0x4d, 0x6a, 0x90, 0xa3,
+    0xaf, 0x91, 0xa3, 0x89, 0xb9, 0x1f, 0x67, 0xae, 0x4f, 0xac, 0x2d, 0x4a, 0x18, 0x5f, 0x4f, 0xc5,
+    0xe5, 0x35, 0x3c, 0x19, 0x2e, 0x17, 0x16, 0x77, 0xbb, 0x8c, 0x6a, 0x8b, 0xbb, 0xdd, 0xbc, 0x2a,
+    0xd7, 0xca, 0x2b, 0x2a, 0xf2, 0xec, 0xfd, 0xa4, 0x48, 0xd2, 0xc8, 0x68, 0xe9, 0x51, 0x3e, 0x17,
+    0xa6, 0xeb, 0xf4, 0x46, 0xed, 0x40, 0xe8, 0x7e, 0xd5, 0x91, 0xae, 0x89, 0xdf, 0xf7, 0x20, 0x7e,
+    0x25, 0x04, 0xf3, 0x53, 0xd9, 0xfc, 0xe8, 0x54, 0x22, 0x79, 0x23, 0x32, 0x3e, 0x07, 0x0f, 0x91,
+    0xe0, 0xeb, 0x78, 0xca, 0x2e, 0xf8, 0x30, 0x93, 0xe5, 0xaf, 0xf5, 0x05, 0xd9, 0x69, 0x18, 0x67,
+    0x7d, 0x9c, 0xd7, 0xc0, 0x71, 0xf1, 0xe5, 0x05, 0xe0, 0x30, 0xd9, 0x5b, 0x4a, 0x75, 0xae, 0x9a,
+    0x6d, 0xeb, 0x1b, 0xcc, 0xf6, 0x82, 0xae, 0x58, 0xac, 0xb7, 0xba, 0xed, 0x6f, 0x37, 0xdf, 0x7a,
+    0x0b, 0xdc, 0x59, 0x63, 0x42, 0x79, 0xfa, 0x45, 0xaa, 0x41, 0x2c, 0x68, 0x37, 0x87, 0xca, 0xf4,
+    0x5e, 0xaf, 0xdd, 0xc8, 0x07, 0x95, 0x80, 0x6c, 0xad, 0x00, 0xb2, 0x55, 0x07, 0x64, 0xab, 0x04,
+    0x64, 0x7b, 0x05, 0x90, 0xed, 0x3a, 0x20, 0xdb, 0x25, 0x20, 0x3b, 0x2b, 0x80, 0xec, 0xd4, 0x01,
+    0xd9, 0x29, 0x1d, 0x66, 0x18, 0x31, 0x34, 0x25, 0x99, 0x49, 0xd5, 0x42, 0x68, 0x96, 0xd5, 0xc7,
+    0xb6, 0x51, 0x8b, 0x2c, 0xf3, 0x08, 0xd4, 0x53, 0x55, 0x8f, 0x1c, 0x82, 0x6f, 0xb3, 0xb4, 0xca,
+    0xc6, 0x88, 0xc1, 0x01, 0x2b, 0xda, 0xf5, 0x1c, 0xb9, 0xcd, 0xa3, 0x29, 0xc1, 0x9d, 0xde, 0xa8,
+    0x06, 0x11, 0xba, 0xae, 0x2e, 0x77, 0x2e, 0x2b, 0x5d, 0x2e, 0xc1, 0x46, 0x20, 0xf4, 0xb3, 0x54,
+    0xc5, 0x52, 0x8d, 0x47, 0xa8, 0x88, 0x43, 0x3a, 0x4b, 0x60, 0x63, 0xc0, 0xa5, 0x11, 0x62, 0x63,
+    0x15, 0x20, 0x2a, 0x78, 0xd2, 0x9d, 0x65, 0xac, 0x1c, 0x2d, 0x95, 0x67, 0x83, 0x9d, 0x52, 0xd4,
+    0xb2, 0xe5, 0xf9, 0x86, 0xc8, 0xa1, 0xdf, 0x8c, 0xb3, 0x6c, 0x9a, 0xee, 0x6f, 0x62, 0x2a, 0xdd,
+    0xf1, 0x62, 0x98, 0x87, 0x7b, 0x1f, 0x62, 0xf8, 0x35, 0x11, 0x55, 0xd1, 0xdb, 0x9b, 0x02, 0xd4,
+    0x73, 0x22, 0xe8, 0xe0, 0xf1, 0x3d, 0x8f, 0xb0, 0xd4, 0xf3, 0xdd, 0xdb, 0x73, 0x74, 0xda, 0x81,
+    0x2a, 0x51, 0x26, 0xb9, 0xb2, 0xb8, 0x59, 0x27, 0xf5, 0x5d, 0xb7, 0x78, 0x9f, 0x26, 0x86, 0xd5,
+    0x84, 0x78, 0x1d, 0xa1, 0xd7, 0xd9, 0x15, 0x67, 0x01, 0xd8, 0x58, 0xcd, 0x16, 0xeb, 0xc4, 0xd1,
+    0x2a, 0xe6, 0x49, 0xb1, 0xa4, 0x94, 0x58, 0x8f, 0xef, 0x71, 0x2c, 0xe5, 0x8b, 0x3b, 0x4c, 0x3d,
+    0xa5, 0xe2, 0x14, 0x5d, 0x6b, 0x21, 0x47, 0x31, 0xe1, 0xb4, 0x0f, 0xd9, 0x9b, 0xd6, 0xe6, 0xa8,
+    0xc3, 0x5a, 0xff, 0xf8, 0x87, 0xd5, 0x6a, 0x8b, 0x34, 0xb3, 0xec, 0x95, 0x8d, 0x61, 0x3f, 0x05,
+    0x77, 0xfd, 0xe6, 0x10, 0xef, 0x9a, 0xa6, 0x89, 0x87, 0x86, 0xba, 0x78, 0x03, 0xe6, 0xfa, 0x06,
+    0x9d, 0x77, 0x6b, 0xb1, 0xa1, 0x81, 0x5d, 0x30, 0xdb, 0x98, 0xd6, 0xc9, 0xe2, 0x77, 0xd3, 0x29,
+    0x4f, 0x4e, 0x5c, 0xac, 0x7d, 0x5c, 0xb4, 0x6b, 0xf2, 0xcf, 0xb4, 0x2f, 0x36, 0x8a, 0xc1, 0x65,
+    0xac, 0x84, 0x2d, 0x17, 0x82, 0x72, 0xb5, 0xf6, 0x97, 0xc9, 0x15, 0x95, 0x28, 0x4a, 0xed, 0x02,
+    0xae, 0x4b, 0xa8, 0x98, 0xe8, 0xeb, 0xb0, 0xed, 0x5e, 0xaf, 0x54, 0xd7, 0xa9, 0x93, 0x37, 0xf0,
+    0x3b, 0x4c, 0xac, 0xaa, 0x43, 0x9b, 0xdd, 0x1a, 0xaa, 0x75, 0xee, 0x6b, 0xaa, 0x8e, 0xd5, 0x11,
+    0x2b, 0xfa, 0x8b, 0xb8, 0x54, 0x1b, 0x53, 0x47, 0xc5, 0x95, 0x50, 0x70, 0xe7, 0xd5, 0x60, 0x88,
+    0x04, 0xf9, 0x2a, 0x45, 0x15, 0x14, 0x29, 0x95, 0x32, 0x7f, 0xbd, 0xe5, 0xa8, 0x58, 0x34, 0x91,
+    0x0e, 0x78, 0xb0, 0x41, 0xeb, 0x2f, 0xa5, 0xba, 0x91, 0x4e, 0xf8, 0xb6, 0xf6, 0xac, 0x04, 0xfa,
+    0xcf, 0x66, 0xce, 0xc8, 0x6a, 0xe9, 0x69, 0x9a, 0xe7, 0x1f, 0xbf, 0xde, 0x68, 0x89, 0xf3, 0xba,
+    0x8f, 0xb3, 0x38, 0xe3, 0x29, 0x7a, 0x80, 0xea, 0xb7, 0x62, 0xc7, 0x91, 0xa8, 0x4d, 0xac, 0xb7,
+    0x6d, 0xb2, 0xab, 0x4c, 0xc2, 0x7f, 0x44, 0x88, 0x1f, 0x45, 0xe3, 0x75, 0xee, 0xc7, 0x9e, 0xfd,
+    0xf7, 0xbb, 0xf3, 0xeb, 0xf7, 0x16, 0x9a, 0x80, 0xea, 0xbb, 0xeb, 0x97, 0xc8, 0x41, 0xd3, 0x36,
+    0x7e, 0xfc, 0x32, 0xc3, 0x28, 0x84, 0x0d, 0xec, 0xde, 0x47, 0xd3, 0x0c, 0xda, 0xf0, 0x3c, 0x8e,
+    0x93, 0x4c, 0xa5, 0x4e, 0x3e, 0x52, 0x60, 0x55, 0x3c, 0x89, 0xce, 0xed, 0xa5, 0x46, 0x72, 0x2d,
+    0x10, 0x64, 0x0f, 0xf3, 0x87, 0x26, 0xf3, 0x77, 0xf3, 0xe5, 0xeb, 0x21, 0xad, 0x30, 0x8d, 0xab,
+    0x58, 0x5a, 0xed, 0x1b, 0xbc, 0xec, 0x0d, 0x41, 0x44, 0xab, 0xfe, 0x75, 0x8b, 0xb9, 0xa9, 0x4c,
+    0xe0, 0x15, 0x55, 0x7c, 0xc5, 0xb9, 0x7a, 0x95, 0xb9, 0x7f, 0x46, 0x7c, 0x2b, 0xdb, 0x82, 0x8a,
+    0x4b, 0x64, 0xba, 0x6e, 0xc0, 0x6a, 0x40, 0x1d, 0x7c, 0xa3, 0xe5, 0xc9, 0xda, 0x32, 0xb1, 0x22,
+    0xf5, 0x50, 0x2c, 0x42, 0xb6, 0xd4, 0xe2, 0xbd, 0x74, 0xe7, 0x91, 0xb9, 0x53, 0x1a, 0xb2, 0xc6,
+    0xa6, 0x23, 0x3a, 0x6a, 0x36, 0x5c, 0x66, 0x65, 0xd7, 0xdd, 0x3e, 0xf2, 0x14, 0xe3, 0xfa, 0xbb,
+    0x87, 0x6e, 0x72, 0xd6, 0xdd, 0x3c, 0xd6, 0xb5, 0xd2, 0x95, 0xbd, 0x43, 0x65, 0xb2, 0x7e, 0x27,
+    0x77, 0xb8, 0x94, 0xf6, 0xfa, 0xb6, 0xfb, 0x47, 0x05, 0xf8, 0x9f, 0xd5, 0x21, 0x1e, 0xf1, 0x18,
+    0x36, 0x0d, 0x98, 0xa7, 0x8b, 0xae, 0x31, 0x16, 0x04, 0x74, 0x27, 0x3c, 0xe3, 0xc2, 0x37, 0xfe,
+    0xd4, 0x57, 0x7e, 0x31, 0x7d, 0x0f, 0x74, 0xd9, 0x0e, 0xf3, 0xc4, 0x8b, 0x67, 0x51, 0x36, 0xd8,
+    0x7d, 0x12, 0xba, 0xd1, 0x68, 0xe6, 0x8e, 0xf8, 0x80, 0x47, 0x4f, 0x30, 0xbc, 0x74, 0xb3, 0x01,
+    0xee, 0x36, 0x0f, 0x76, 0x9b, 0x61, 0x4b, 0x52, 0xf4, 0xa6, 0x5b, 0x0d, 0xd2, 0x6b, 0xc6, 0x14,
+    0xe8, 0x17, 0x6d, 0x0e, 0x4a, 0x9a, 0xd0, 0x2d, 0x86, 0xc1, 0xcb, 0xdc, 0xe2, 0x0e, 0x93, 0x7d,
+    0x54, 0x0a, 0x6f, 0x51, 0xb4, 0xa8, 0x8c, 0xdc, 0x42, 0xfa, 0xce, 0x0a, 0xd4, 0x42, 0xfe, 0x76,
+    0xfd, 0x49, 0x10, 0xf5, 0xc1, 0x91, 0x46, 0xeb, 0xc0, 0xbe, 0x67, 0x7a, 0x23, 0xf9, 0xcf, 0xb2,
+    0x1f, 0x91, 0x2b, 0x99, 0x63, 0x47, 0x66, 0xe7, 0x1d, 0x55, 0xeb, 0xf7, 0xcc, 0x6a, 0x5b, 0xd2,
+    0xdf, 0xfe, 0x4f, 0xf4, 0xa1, 0x15, 0xb1, 0x55, 0xc6, 0xb5, 0xc3, 0x80, 0x94, 0xf0, 0x4f, 0x1c,
+    0xad, 0xb8, 0xa6, 0x28, 0xba, 0x6b, 0xa6, 0x45, 0x35, 0x2d, 0xbb, 0xd6, 0x27, 0xb9, 0xa4, 0x8f,
+    0x72, 0xb3, 0xa5, 0xf7, 0x00, 0x25, 0x13, 0x8d, 0x79, 0x96, 0x4d, 0x61, 0xe6, 0xe6, 0xd7, 0xb5,
+    0x7c, 0xeb, 0x5b, 0x98, 0xda, 0x62, 0x34, 0xad, 0x40, 0x49, 0xe4, 0x02, 0x6b, 0xaa, 0x40, 0x54,
+    0x25, 0x49, 0x90, 0xe2, 0xb7, 0x3c, 0x06, 0xec, 0xd1, 0x92, 0xa2, 0x14, 0x73, 0x34, 0x95, 0xa8,
+    0xd0, 0x4d, 0x66, 0x59, 0xd0, 0x80, 0x95, 0x3d, 0xe5, 0x2e, 0x1d, 0x56, 0xd4, 0xfe, 0x2c, 0x96,
+    0x94, 0x2e, 0x98, 0x07, 0xe6, 0x2b, 0xf3, 0x04, 0x45, 0xa0, 0x74, 0xb0, 0x51, 0x3d, 0xe6, 0x5e,
+    0x39, 0xdc, 0x8c, 0x9b, 0x0c, 0x10, 0xb2, 0x9a, 0xe6, 0x0b, 0x42, 0xa6, 0xe2, 0x12, 0x8a, 0x38,
+    0xa2, 0x3a, 0xa7, 0x34, 0xef, 0x12, 0x10, 0xaa, 0xa3, 0x79, 0x53, 0xdb, 0x1c, 0x4e, 0x59, 0x53,
+    0x4a, 0xa3, 0xd6, 0xb4, 0xd3, 0x01, 0x58, 0x4e, 0xb5, 0xfc, 0x68, 0x6c, 0x50, 0x5c, 0x9a, 0x36,
+    0x06, 0x91, 0x7e, 0x89, 0xfb, 0x71, 0x3a, 0x95, 0xf1, 0x3e, 0x9f, 0x51, 0x0f, 0xf7, 0x06, 0x76,
+    0x47, 0x70, 0x40, 0x84, 0x88, 0x32, 0xfc, 0x3e, 0x85, 0xcc, 0xd5, 0xb9, 0xcc, 0x33, 0xea, 0x43,
+    0xb4, 0x12, 0x39, 0x75, 0x11, 0x10, 0xef, 0x00, 0xae, 0x38, 0x93, 0xd6, 0x0f, 0x43, 0x97, 0x50,
+    0xc7, 0x74, 0x4a, 0x24, 0x6f, 0xa2, 0x15, 0x5c, 0xa9, 0x78, 0x22, 0xff, 0x69, 0x4c, 0x11, 0xab,
+    0x6e, 0x62, 0x89, 0xf8, 0xd6, 0x96, 0xab, 0x7c, 0x53, 0x11, 0x1e, 0x7c, 0x09, 0x17, 0xf4, 0x93,
+    0x48, 0xf3, 0x24, 0x6b, 0xe9, 0x65, 0x73, 0xd3, 0x98, 0x4a, 0x5e, 0xe4, 0xc7, 0x52, 0x72, 0x69,
+    0x2f, 0xc3, 0xd8, 0x85, 0xc5, 0xad, 0x6b, 0x5c, 0xdb, 0x0a, 0x4c, 0x7e, 0x34, 0xb5, 0x26, 0x9c,
+    0xb2, 0xcd, 0x55, 0x05, 0x72, 0x95, 0x93, 0xb9, 0x12, 0x96, 0x78, 0x25, 0xae, 0x68, 0x2e, 0x66,
+    0x55, 0x57, 0xe5, 0xd6, 0xd5, 0x81, 0x9c, 0x1c, 0xfa, 0x15, 0xce, 0xc2, 0xb3, 0x5b, 0x75, 0xaa,
+    0xa6, 0x1d, 0x76, 0x2d, 0xa3, 0x39, 0x76, 0x28, 0x11, 0x5c, 0x6d, 0x15, 0xeb, 0x50, 0x89, 0xfa,
+    0xe6, 0x14, 0xa2, 0x03, 0x2b, 0x09, 0x85, 0xce, 0x94, 0x96, 0xcc, 0x8c, 0xef, 0x4d, 0xe1, 0x7f,
+    0x54, 0xa0, 0xbc, 0x4a, 0x30, 0x05, 0xda, 0x5f, 0x20, 0x90, 0xf9, 0x89, 0x54, 0x91, 0x9f, 0x5f,
+    0xaa, 0xdf, 0x7a, 0x56, 0xff, 0xa0, 0x18, 0xb4, 0xb5, 0x6a, 0xd0, 0x56, 0xcd, 0xa0, 0xed, 0x55,
+    0x83, 0xb6, 0x6b, 0x06, 0xed, 0xac, 0x1a, 0xb4, 0x53, 0x0c, 0x52, 0x6e, 0xfe, 0x2c, 0x41, 0x5e,
+    0x8b, 0x9d, 0x15, 0xdc, 0x34, 0xe3, 0x56, 0x36, 0xfa, 0x66, 0x46, 0x5d, 0xb6, 0xa8, 0x41, 0xb6,
+    0x54, 0xd1, 0x36, 0x8c, 0xfd, 0xa3, 0x6b, 0xb4, 0xe9, 0xfa, 0xfd, 0x03, 0x2a, 0xb3, 0x49, 0xb9,
+    0x1c, 0x59, 0xe2, 0xaa, 0x7d, 0xd5, 0xe5, 0xa0, 0xfc, 0xf9, 0x02, 0x5d, 0x82, 0x72, 0xaa, 0xc8,
+    0x6a, 0x58, 0xd7, 0xf7, 0x39, 0x28, 0x9b, 0x80, 0x38, 0x9c, 0x85, 0xe1, 0x9c, 0x48, 0x24, 0xdf,
+    0xca, 0xf2, 0x6e, 0xf3, 0x7d, 0xa9, 0xd6, 0x5b, 0xff, 0x94, 0x87, 0x9a, 0x45, 0xff, 0x8e, 0x47,
+    0x51, 0xee, 0x8d, 0x1e, 0x12, 0xcb, 0xbf, 0x49, 0xa0, 0xdd, 0xc7, 0x5e, 0xb3, 0x5c, 0xbc, 0x7e,
+    0xbc, 0xe9, 0xc6, 0x1a, 0xf7, 0x21, 0x05, 0x6d, 0x44, 0x39, 0x2f, 0x5e, 0xb7, 0x4a, 0x26, 0xb6,
+    0x75, 0x9c, 0x70, 0x36, 0x8f, 0x67, 0xb0, 0x24, 0xf9, 0xe3, 0xce, 0x8d, 0xe8, 0x53, 0x6e, 0x62,
+    0x24, 0x5d, 0x0e, 0x92, 0x93, 0x3c, 0x07, 0xe0, 0x79, 0xe1, 0x6f, 0x5d, 0x4d, 0xbf, 0x18, 0xf2,
+    0xc7, 0x17, 0xf5, 0xa3, 0xc7, 0x17, 0xf8, 0x0f, 0x2e, 0xe7, 0x5f, 0x22, 0x1e, 0x8a, 0xf1, 0x62,
+    0x65, 0xfe, 0xc3, 0x79, 0x2d, 0xa9, 0xf9, 0x15, 0xdc, 0x6e, 0x82, 0xd0, 0xae, 0x78, 0xdd, 0xe5,
+    0x6f, 0x52, 0x15, 0xdf, 0xed, 0x51, 0x57, 0xd0, 0x97, 0x39, 0x96, 0xa5, 0x2b, 0xec, 0x79, 0x89,
+    0xb7, 0x76, 0x9d, 0x7c, 0x99, 0xdb, 0x54, 0xbd, 0xb9, 0x7e, 0xd0, 0x70, 0x17, 0xff, 0x8f, 0x95,
+    0x11, 0x71, 0x2b, 0x1e, 0x60, 0xe7, 0xd5, 0xc5, 0x39, 0x39, 0x3a, 0xfa, 0xe2, 0xf6, 0xf5, 0x87,
+    0xc5, 0x7a, 0x32, 0x65, 0x70, 0x2c, 0xff, 0x56, 0x27, 0xb2, 0xc2, 0x94, 0x98, 0xf5, 0xb5, 0x3a,
+    0x2f, 0x54, 0x68, 0xbe, 0x05, 0x62, 0x7c, 0x13, 0xac, 0xa2, 0xd6, 0xea, 0x13, 0x61, 0x62, 0xd9,
+    0xcf, 0xd9, 0x35, 0xaa, 0xf1, 0x5d, 0x80, 0x57, 0xa6, 0x83, 0xd4, 0x13, 0x1f, 0x06, 0x42, 0x75,
+    0x77, 0x9a, 0x74, 0x5a, 0x4e, 0xf0, 0x20, 0x46, 0x2d, 0x0a, 0xa2, 0xa9, 0x6c, 0x8d, 0xb1, 0x58,
+    0xf9, 0x99, 0x43, 0x39, 0x85, 0xc8, 0x0d, 0x95, 0x54, 0x4b, 0x4b, 0xf8, 0x88, 0x8f, 0x7d, 0x74,
+    0xf0, 0x3b, 0xba, 0xbd, 0xea, 0x57, 0x32, 0x1a, 0xa8, 0x58, 0xa0, 0x5f, 0x4f, 0x3f, 0xf3, 0x53,
+    0x68, 0x15, 0xf2, 0xa9, 0x2f, 0xa3, 0x25, 0xf8, 0x5e, 0xa7, 0x1e, 0x4f, 0xd0, 0xdf, 0x38, 0xbe,
+    0xb8, 0xc8, 0x59, 0x44, 0xde, 0x19, 0xee, 0x59, 0x8f, 0x74, 0x52, 0xd6, 0x1b, 0xd9, 0xe3, 0x17,
+    0x57, 0xaf, 0x2f, 0xde, 0x5d, 0x9f, 0x5d, 0xbc, 0x27, 0x7b, 0x2b, 0x01, 0x7b, 0x6e, 0x14, 0xc5,
+    0x19, 0xbb, 0xe5, 0x58, 0x6f, 0x08, 0x71, 0xf4, 0xa3, 0x26, 0x9e, 0x48, 0xa4, 0xbb, 0x84, 0xd5,
+    0xef, 0xc2, 0x19, 0x63, 0xdd, 0x4c, 0xfc, 0x0f, 0xe2, 0x80, 0xdd, 0xfb, 0x5d, 0xf8, 0xc3, 0x9b,
+    0xb9, 0xa3, 0x6f, 0xdf, 0xcb, 0xf2, 0x2c, 0x8d, 0xf7, 0x31, 0xd4, 0x9d, 0xc7, 0xe2, 0x4a, 0x46,
+    0xfd, 0xb7, 0xd1, 0x4a, 0x1f, 0xa1, 0x52, 0x88, 0x4e, 0xd2, 0x51, 0x47, 0xe5, 0x2a, 0x8a, 0x55,
+    0xaf, 0xf9, 0x71, 0x2c, 0xf9, 0x85, 0x95, 0xd5, 0x1f, 0xc6, 0x92, 0x31, 0xfe, 0x8d, 0xfa, 0x5e,
+    0xeb, 0x63, 0xba, 0xa0, 0x84, 0x97, 0xa2, 0x57, 0x7c, 0x3a, 0xab, 0x92, 0x0d, 0x35, 0xfa, 0x1b,
+    0x5f, 0x91, 0xea, 0xe0, 0x27, 0xbb, 0x45, 0x6a, 0xeb, 0x70, 0x53, 0x7d, 0x76, 0xee, 0x70, 0x53,
+    0x7e, 0xb0, 0x78, 0x93, 0xfe, 0x17, 0x93, 0xfe, 0x0f, 0x49, 0x21, 0x74, 0x47, 0x48, 0x69, 0x00,
+    0x00,
+};
+
+#endif // WEB_ASSETS_H
@@ -0,0 +1,109 @@
+"""
+Web UI asset build step
+
+Minifies and gzips the pages in web/ into include/web_assets.h as PROGMEM
+byte arrays, each with a strong ETag derived from its compressed content.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and can
+also be run by hand:  python scripts/build_web_assets.py
+The header is only rewritten when its content changes, so unchanged assets
+don't trigger a rebuild.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# (source file in web/, C symbol prefix)
+ASSETS = [
+    ("portal.html", "PORTAL_HTML"),
+    ("settings.html", "SETTINGS_HTML"),
+]
+
+OUTPUT = os.path.join(PROJECT_DIR, "include", "web_assets.h")
+
+
+def minify_html(text):
+    """Conservative minify: drop indentation, blank lines and comments.
+
+    Newlines are kept so JavaScript statement boundaries never change.
+    Whole-line // comments are only dropped inside <script> and outside
+    template literals.
+    """
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+
+    out = []
+    in_script = False
+    in_template = False
+    for line in text.splitlines():
+        stripped = line.strip()
+        lower = stripped.lower()
+        if "<script" in lower:
+            in_script = True
+        if in_script and not in_template and stripped.startswith("//"):
+            continue
+        if stripped:
+            out.append(stripped)
+        in_template ^= (stripped.replace("\\`", "").count("`") % 2 == 1)
+        if "</script>" in lower:
+            in_script = False
+    return "\n".join(out)
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def build():
+    parts = [
+        "// Generated by scripts/build_web_assets.py from web/ - do not edit",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+    ]
+
+    for filename, symbol in ASSETS:
+        with open(os.path.join(PROJECT_DIR, "web", filename), "r", encoding="utf-8") as f:
+            source = f.read()
+
+        minified = minify_html(source).encode("utf-8")
+        compressed = gzip.compress(minified, compresslevel=9, mtime=0)  # mtime=0: reproducible
+        etag = hashlib.sha256(compressed).hexdigest()[:16]
+
+        parts += [
+            "// web/%s: %d bytes, %d minified, %d gzipped" % (filename, len(source.encode("utf-8")),
+                                                            len(minified), len(compressed)),
+            '#define %s_ETAG "\\"%s\\""' % (symbol, etag),
+            "#define %s_GZ_LEN %d" % (symbol, len(compressed)),
+            "const uint8_t %s_GZ[] PROGMEM = {" % symbol,
+            c_array(compressed),
+            "};",
+            "",
+        ]
+
+    parts.append("#endif // WEB_ASSETS_H")
+    header = "\n".join(parts) + "\n"
+
+    existing = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r", encoding="utf-8") as f:
+            existing = f.read()
+    if header != existing:
+        with open(OUTPUT, "w", encoding="utf-8") as f:
+            f.write(header)
+        print("Web assets: wrote %s" % os.path.relpath(OUTPUT, PROJECT_DIR))
+
+
+build()
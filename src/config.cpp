@@ -1,12 +1,20 @@
 #include "config.h"
+#include "time_sync.h"
+#include "readings_store.h"
+#include "config_journal.h"
+
+// Live readings and the config journal (initialized in main)
+extern ReadingsStore readings;
+extern ConfigJournal configJournal;
 
 // Global configuration document (StaticJsonDocument allocated in .bss, not heap)
 // Increased to 8KB to support 15-20 dynamic module instances
 StaticJsonDocument<8192> config;
 
-// Track last save time to reduce flash wear
-static unsigned long lastSaveTime = 0;
-#define MIN_SAVE_INTERVAL 30000  // Minimum 30s between saves
+// Write-behind: saves mark the config dirty, maintainConfiguration() writes it
+static bool configDirty = false;
+static unsigned long dirtySince = 0;    // millis() of the first unwritten change
+static unsigned long lastChangeAt = 0;  // millis() of the latest save request
 
 bool initStorage() {
     Serial.println("Initializing LittleFS...");
@@ -24,22 +32,15 @@ bool initStorage() {
 
     Serial.println("LittleFS mounted successfully");
 
-    // Create config file if it doesn't exist
-    if (!LittleFS.exists(CONFIG_FILE)) {
-        Serial.println("Creating default config file...");
-        File file = LittleFS.open(CONFIG_FILE, "w");
-        if (file) {
-            file.print("{}");  // Empty JSON object
-            file.close();
-            Serial.println("Default config file created");
-        }
-    }
-
     return true;
 }
 
 bool loadConfiguration() {
-    File file = LittleFS.open(CONFIG_FILE, "r");
+    unsigned long startUs = micros();
+
+    // MessagePack snapshot, or the JSON one older firmware left (converted below)
+    bool legacy = !LittleFS.exists(CONFIG_FILE) && LittleFS.exists(CONFIG_LEGACY_FILE);
+    File file = LittleFS.open(legacy ? CONFIG_LEGACY_FILE : CONFIG_FILE, "r");
     if (!file) {
         Serial.println("Config file not found, creating default config");
         setDefaultConfig();
@@ -47,9 +48,22 @@ bool loadConfiguration() {
         return false;
     }
 
-    DeserializationError error = deserializeJson(config, file);
+    // One read into RAM, then parse from the buffer (per-byte LittleFS reads are slow)
+    size_t fileSize = file.size();
+    char* buffer = (char*)malloc(fileSize + 1);
+    bool complete = buffer && file.read((uint8_t*)buffer, fileSize) == fileSize;
     file.close();
 
+    // The snapshot header holds its generation (journal records older than it are skipped)
+    DeserializationError error = DeserializationError::NoMemory;
+    if (complete && legacy) {
+        error = deserializeJson(config, (const char*)buffer, fileSize);
+    } else if (complete) {
+        size_t start = configJournal.openSnapshot((const uint8_t*)buffer, fileSize);
+        error = deserializeMsgPack(config, (const char*)buffer + start, fileSize - start);
+    }
+    free(buffer);
+
     if (error) {
         Serial.print("Failed to parse config: ");
         Serial.println(error.c_str());
@@ -58,59 +72,30 @@ bool loadConfiguration() {
         return false;
     }
 
-    Serial.println("Configuration loaded successfully");
-
-    // Check if essential fields exist, populate defaults if missing
-    bool needsDefaults = false;
-    if (!config.containsKey("device") || !config.containsKey("modules")) {
-        Serial.println("Config missing essential fields, populating defaults...");
-        needsDefaults = true;
+    // Edits since the last snapshot, then drop the pool copies they replaced
+    configJournal.replay(config);
+    config.garbageCollect();
+    configJournal.begin(config);
+    if (legacy) {
+        configJournal.compact(config);  // Rewrite as MessagePack; the JSON file goes once it's on flash
     }
 
-    // Check if crypto modules have required fields
-    if (config.containsKey("modules")) {
-        JsonObject bitcoin = config["modules"]["bitcoin"];
-        if (!bitcoin.containsKey("cryptoId")) {
-            Serial.println("Bitcoin module missing crypto fields");
-            needsDefaults = true;
-        }
-    } else {
-        needsDefaults = true;
-    }
+    unsigned long loadUs = micros() - startUs;
+    Serial.print("Configuration loaded: ");
+    Serial.print(fileSize);
+    Serial.print(legacy ? " bytes JSON (converting)" : " bytes MessagePack");
+    Serial.print(" in ");
+    Serial.print(loadUs);
+    Serial.println(" us");
 
-    if (needsDefaults) {
+    // Only the overall shape is checked; missing settings fall back at their use sites
+    if (!config["device"].is<JsonObject>() || !config["modules"].is<JsonObject>()) {
+        Serial.println("Config missing essential fields, populating defaults...");
         setDefaultConfig();
         saveConfiguration(true);  // Force save
         Serial.println("Default config populated and saved");
     }
 
-    // Debug: Show what was loaded for crypto and weather modules
-    Serial.println("=== Loaded Config (Modules) ===");
-    JsonObject bitcoin = config["modules"]["bitcoin"];
-    Serial.print("Bitcoin - ID: ");
-    Serial.print(bitcoin["cryptoId"] | "NOT SET");
-    Serial.print(", Name: ");
-    Serial.print(bitcoin["cryptoName"] | "NOT SET");
-    Serial.print(", Symbol: ");
-    Serial.println(bitcoin["cryptoSymbol"] | "NOT SET");
-
-    JsonObject ethereum = config["modules"]["ethereum"];
-    Serial.print("Ethereum - ID: ");
-    Serial.print(ethereum["cryptoId"] | "NOT SET");
-    Serial.print(", Name: ");
-    Serial.print(ethereum["cryptoName"] | "NOT SET");
-    Serial.print(", Symbol: ");
-    Serial.println(ethereum["cryptoSymbol"] | "NOT SET");
-
-    JsonObject weather = config["modules"]["weather"];
-    Serial.print("Weather - Location: ");
-    Serial.print(weather["location"] | "NOT SET");
-    Serial.print(", Lat: ");
-    Serial.print(weather["latitude"] | 0.0, 6);
-    Serial.print(", Lon: ");
-    Serial.println(weather["longitude"] | 0.0, 6);
-    Serial.println("=======================================");
-
     // Check if config is overflowing
     Serial.print("Config memory usage: ");
     Serial.print(config.memoryUsage());
@@ -124,61 +109,17 @@ bool loadConfiguration() {
     return true;
 }
 
-bool saveConfiguration(bool force) {
-    // Throttle saves to reduce flash wear (unless forced)
-    unsigned long now = millis();
-    if (!force && now - lastSaveTime < MIN_SAVE_INTERVAL) {
-        Serial.println("Skipping save (too soon since last save)");
-        return true;  // Not an error, just throttled
-    }
-
-    if (force) {
-        Serial.println("FORCED SAVE - bypassing throttle");
-    }
-
-    File file = LittleFS.open(CONFIG_FILE, "w");
-    if (!file) {
-        Serial.println("ERROR: Failed to open config file for writing");
-        return false;
-    }
-
-    if (serializeJson(config, file) == 0) {
+static bool writeConfiguration() {
+    // Changed sections go to the journal; the first save (or a long journal) rewrites the snapshot
+    if (!configJournal.commit(config)) {
         Serial.println("ERROR: Failed to write config");
-        file.close();
+        dirtySince = lastChangeAt = millis();  // Stay dirty, retry after CONFIG_WRITE_DELAY
         return false;
     }
 
-    file.close();
-    lastSaveTime = now;
+    configDirty = false;
     Serial.println("Configuration saved successfully");
 
-    // Debug: Show what was saved for crypto and weather modules
-    Serial.println("=== Saved Config (Modules) ===");
-    JsonObject bitcoin = config["modules"]["bitcoin"];
-    Serial.print("Bitcoin - ID: ");
-    Serial.print(bitcoin["cryptoId"] | "NOT SET");
-    Serial.print(", Name: ");
-    Serial.print(bitcoin["cryptoName"] | "NOT SET");
-    Serial.print(", Symbol: ");
-    Serial.println(bitcoin["cryptoSymbol"] | "NOT SET");
-
-    JsonObject ethereum = config["modules"]["ethereum"];
-    Serial.print("Ethereum - ID: ");
-    Serial.print(ethereum["cryptoId"] | "NOT SET");
-    Serial.print(", Name: ");
-    Serial.print(ethereum["cryptoName"] | "NOT SET");
-    Serial.print(", Symbol: ");
-    Serial.println(ethereum["cryptoSymbol"] | "NOT SET");
-
-    JsonObject weather = config["modules"]["weather"];
-    Serial.print("Weather - Location: ");
-    Serial.print(weather["location"] | "NOT SET");
-    Serial.print(", Lat: ");
-    Serial.print(weather["latitude"] | 0.0, 6);
-    Serial.print(", Lon: ");
-    Serial.println(weather["longitude"] | 0.0, 6);
-    Serial.println("======================================");
-
     // Check if config is overflowing
     Serial.print("Config memory usage: ");
     Serial.print(config.memoryUsage());
@@ -192,6 +133,44 @@ bool saveConfiguration(bool force) {
     return true;
 }
 
+bool saveConfiguration(bool force) {
+    configJournal.countRequest();
+
+    unsigned long now = millis();
+    if (!configDirty) {
+        configDirty = true;
+        dirtySince = now;
+    }
+    lastChangeAt = now;
+
+    if (!force) {
+        return true;  // Coalesced with later changes, written by maintainConfiguration()
+    }
+
+    Serial.println("FORCED SAVE - writing now");
+    return writeConfiguration();
+}
+
+void maintainConfiguration() {
+    // A queued write that failed on flash: write again (the journal compacts)
+    if (!configDirty && configJournal.hasWriteFailed()) {
+        configDirty = true;
+        dirtySince = lastChangeAt = millis();
+    }
+    if (!configDirty) return;
+
+    // Quiet for a moment, or dirty for too long while edits keep coming
+    unsigned long now = millis();
+    if (now - lastChangeAt >= CONFIG_WRITE_DELAY || now - dirtySince >= CONFIG_WRITE_MAX_DELAY) {
+        writeConfiguration();
+    }
+}
+
+bool flushConfiguration() {
+    bool written = !configDirty || writeConfiguration();
+    return configJournal.flush() && written;
+}
+
 void setDefaultConfig() {
     // Clear existing config
     config.clear();
@@ -199,12 +178,17 @@ void setDefaultConfig() {
     // WiFi settings
     config["wifi"]["ssid"] = "";
     config["wifi"]["password"] = "";
+    config["wifi"]["reuseLease"] = false;  // Reapply the last DHCP lease on connect (see rememberAP)
 
     // Device settings
     config["device"]["activeModule"] = "bitcoin";
     config["device"]["enableButton"] = true;
     config["device"]["refreshInterval"] = 300;  // 5 minutes default
     config["device"]["currency"] = "USD";        // Default currency for all modules
+    config["device"]["backgroundRefresh"] = true;  // Keep all modules fresh, not just the active one
+    config["device"]["adaptiveRefresh"] = false;    // Scale intervals with how fast values move
+    config["device"]["maxRefreshInterval"] = 1800;  // Adaptive ceiling (30 minutes)
+    config["device"]["adaptiveTarget"] = 0.1;       // Percent move expected between fetches
 
     // Module display order (array of module IDs in display order)
     JsonArray moduleOrder = config["device"]["moduleOrder"].to<JsonArray>();
@@ -215,102 +199,65 @@ void setDefaultConfig() {
     moduleOrder.add("custom");
     moduleOrder.add("settings");
 
-    // Initialize empty module data
+    // Module settings only - live readings are kept in the readings store
     JsonObject bitcoin = config["modules"]["bitcoin"].to<JsonObject>();
     bitcoin["type"] = "crypto";              // Module type for future dynamic creation
     bitcoin["cryptoId"] = "bitcoin";
     bitcoin["cryptoSymbol"] = "BTC";
     bitcoin["cryptoName"] = "Bitcoin";
-    bitcoin["value"] = 0.0;
-    bitcoin["change24h"] = 0.0;
-    bitcoin["lastUpdate"] = 0;
-    bitcoin["lastSuccess"] = false;
 
     JsonObject ethereum = config["modules"]["ethereum"].to<JsonObject>();
     ethereum["type"] = "crypto";             // Module type for future dynamic creation
     ethereum["cryptoId"] = "ethereum";
     ethereum["cryptoSymbol"] = "ETH";
     ethereum["cryptoName"] = "Ethereum";
-    ethereum["value"] = 0.0;
-    ethereum["change24h"] = 0.0;
-    ethereum["lastUpdate"] = 0;
-    ethereum["lastSuccess"] = false;
 
     JsonObject stock = config["modules"]["stock"].to<JsonObject>();
     stock["type"] = "stock";                 // Module type for future dynamic creation
     stock["ticker"] = "AAPL";
     stock["name"] = "Apple Inc.";
-    stock["value"] = 0.0;
-    stock["change"] = 0.0;
-    stock["lastUpdate"] = 0;
-    stock["lastSuccess"] = false;
 
     JsonObject weather = config["modules"]["weather"].to<JsonObject>();
     weather["type"] = "weather";             // Module type for future dynamic creation
     weather["latitude"] = 37.7749;
     weather["longitude"] = -122.4194;
     weather["location"] = "San Francisco";
-    weather["temperature"] = 0.0;
-    weather["condition"] = "Unknown";
-    weather["lastUpdate"] = 0;
-    weather["lastSuccess"] = false;
 
     JsonObject custom = config["modules"]["custom"].to<JsonObject>();
     custom["type"] = "custom";               // Module type for future dynamic creation
     custom["value"] = 0.0;
     custom["label"] = "My Metric";
     custom["unit"] = "units";
-    custom["lastUpdate"] = 0;
-    custom["lastSuccess"] = true;
 
     JsonObject settings = config["modules"]["settings"].to<JsonObject>();
     settings["type"] = "settings";           // Module type for future dynamic creation
-    settings["securityCode"] = 0;            // Will be generated by SecurityManager on first display
-    settings["codeTimeRemaining"] = 0;
-    settings["lastUpdate"] = 0;
-    settings["lastSuccess"] = true;
 
     Serial.println("Default configuration created");
 }
 
-void updateModuleCache(const char* moduleId, JsonObject data) {
-    JsonObject module = config["modules"][moduleId];
-
-    // Update timestamp
-    module["lastUpdate"] = millis() / 1000;
-    module["lastSuccess"] = true;
-
-    // Copy all data fields
-    for (JsonPair kv : data) {
-        module[kv.key()] = kv.value();
-    }
-
-    // Request save (will be throttled if too frequent)
-    saveConfiguration();
-}
-
 bool isCacheStale(const char* moduleId) {
-    JsonObject module = config["modules"][moduleId];
-    unsigned long lastUpdate = module["lastUpdate"] | 0;
-    unsigned long now = millis() / 1000;
+    unsigned long lastUpdate = readings.getLastUpdate(moduleId);
+    unsigned long age = timestampAge(lastUpdate);
     uint16_t refreshInterval = config["device"]["refreshInterval"] | 300;
 
+    // Unknown age (clock not synced yet) counts as stale only once SNTP had its chance
+    if (age == AGE_UNKNOWN) {
+        return lastUpdate == 0 || millis() / 1000 >= TIME_SYNC_GRACE;
+    }
+
     // Cache is stale if older than 2× refresh interval
-    return (now - lastUpdate) > (refreshInterval * 2);
+    return age > (unsigned long)refreshInterval * 2;
 }
 
 unsigned long getCacheAge(const char* moduleId) {
-    JsonObject module = config["modules"][moduleId];
-    unsigned long lastUpdate = module["lastUpdate"] | 0;
-    unsigned long now = millis() / 1000;
-    return now - lastUpdate;
+    return timestampAge(readings.getLastUpdate(moduleId));
 }
 
 String getTimeAgo(unsigned long timestamp) {
     if (timestamp == 0) return "Never";
 
-    unsigned long now = millis() / 1000;
-    unsigned long diff = now - timestamp;
+    unsigned long diff = timestampAge(timestamp);
+    if (diff == AGE_UNKNOWN) return "?";
 
     if (diff < 60) return String(diff) + "s ago";
     if (diff < 3600) return String(diff / 60) + "m ago";
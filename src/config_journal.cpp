@@ -0,0 +1,538 @@
+#include "config_journal.h"
+#include "config.h"
+#include <LittleFS.h>
+#include <vector>
+
+// Record framing: length (uint16 LE), FNV-1a of the payload (uint32 LE), payload
+// Payload (MessagePack): {"g":7,"p":"modules/bitcoin","v":{...}} sets a section,
+// {"g":7,"p":...,"d":true} deletes it. "g" is the snapshot generation (absent = 0)
+#define RECORD_HEADER_SIZE 6
+
+// Print sink that hashes instead of storing (FNV-1a, same as the event bus dedupe)
+class HashPrint : public Print {
+public:
+    uint32_t hash = 2166136261u;
+    using Print::write;
+    size_t write(uint8_t c) override {
+        hash = (hash ^ c) * 16777619u;
+        return 1;
+    }
+};
+
+static uint32_t hashBytes(const char* data, size_t length) {
+    HashPrint hasher;
+    hasher.write((const uint8_t*)data, length);
+    return hasher.hash;
+}
+
+// MessagePack str (fixstr, str8 or str16 header, then the bytes)
+static void appendMsgPackString(std::vector<uint8_t>& out, const char* text, size_t length) {
+    if (length < 32) {
+        out.push_back(0xA0 | length);
+    } else if (length < 256) {
+        out.push_back(0xD9);
+        out.push_back(length);
+    } else {
+        out.push_back(0xDA);
+        out.push_back(length >> 8);
+        out.push_back(length & 0xFF);
+    }
+    out.insert(out.end(), (const uint8_t*)text, (const uint8_t*)text + length);
+}
+
+// Section path -> its value in doc ("device/currency" or a top-level key)
+static JsonVariantConst sectionValue(JsonDocument& doc, const String& path) {
+    int slash = path.indexOf('/');
+    if (slash < 0) {
+        return doc[path].as<JsonVariantConst>();
+    }
+    return doc[path.substring(0, slash)][path.substring(slash + 1)].as<JsonVariantConst>();
+}
+
+// Deletes one section ("device/currency" or a top-level key) if present
+static void removeSection(JsonDocument& doc, const String& path) {
+    int slash = path.indexOf('/');
+    if (slash < 0) {
+        doc.remove(path);
+        return;
+    }
+    JsonObject parent = doc[path.substring(0, slash)];
+    if (!parent.isNull()) parent.remove(path.substring(slash + 1));
+}
+
+// Nulls one section if present, keeping its key where it is in its parent
+static void clearSection(JsonDocument& doc, const String& path) {
+    int slash = path.indexOf('/');
+    JsonObject parent = slash < 0 ? doc.as<JsonObject>() : doc[path.substring(0, slash)];
+    String key = slash < 0 ? path : path.substring(slash + 1);
+    if (!parent.isNull()) parent[key].clear();
+}
+
+// Rebuilds doc in a fresh pool so values that later records replaced stop taking space
+static bool reclaimPool(JsonDocument& doc) {
+    DynamicJsonDocument copy(doc.capacity());
+    if (copy.capacity() == 0 || !copy.set(doc)) {
+        return false;  // No memory for the copy: leave doc as it is
+    }
+    return doc.set(copy);
+}
+
+ConfigJournal::ConfigJournal()
+    : generation(0), ready(false), journalSize(0), writeQueue(nullptr), flushDone(nullptr), task(nullptr),
+      writeFailed(false), appendsHeld(false), stopped(false), saveRequests(0), records(0), writes(0),
+      compactions(0), bytesWritten(0), replayed(0), skipped(0), tornAtBoot(false) {
+}
+
+bool ConfigJournal::init() {
+    if (task) return true;  // Already running
+
+    writeQueue = xQueueCreate(CONFIG_WRITE_QUEUE_LENGTH, sizeof(WriteJob*));
+    flushDone = xSemaphoreCreateBinary();
+    if (!writeQueue || !flushDone) {
+        Serial.println("ERROR: Config writer allocation failed, writing inline");
+        return false;
+    }
+
+    if (xTaskCreate(taskMain, "configWriter", CONFIG_WRITER_STACK, this,
+                    CONFIG_WRITER_PRIORITY, &task) != pdPASS) {
+        Serial.println("ERROR: Config writer task creation failed, writing inline");
+        task = nullptr;
+        return false;
+    }
+
+    Serial.println("Config writer started");
+    return true;
+}
+
+uint32_t ConfigJournal::hashValue(JsonVariantConst value) {
+    HashPrint hasher;
+    serializeMsgPack(value, hasher);
+    return hasher.hash;
+}
+
+void ConfigJournal::collectSections(JsonDocument& doc, std::map<String, uint32_t>& out) {
+    out.clear();
+    for (JsonPairConst top : doc.as<JsonObjectConst>()) {
+        JsonObjectConst object = top.value().as<JsonObjectConst>();
+        if (object.isNull() || object.size() == 0) {
+            out[top.key().c_str()] = hashValue(top.value());
+            continue;
+        }
+        for (JsonPairConst child : object) {
+            out[String(top.key().c_str()) + "/" + child.key().c_str()] = hashValue(child.value());
+        }
+    }
+}
+
+bool ConfigJournal::applyRecord(JsonDocument& doc, JsonObjectConst record) {
+    const char* pathText = record["p"];
+    if (!pathText || pathText[0] == '\0') return false;
+
+    String path = pathText;
+    if (record["d"] | false) {
+        removeSection(doc, path);
+        return true;
+    }
+
+    int slash = path.indexOf('/');
+    String top = slash < 0 ? path : path.substring(0, slash);
+    String key = slash < 0 ? String() : path.substring(slash + 1);
+
+    if (slash < 0) {
+        doc[top] = record["v"];
+    } else {
+        JsonObject parent = doc[top].is<JsonObject>() ? doc[top].as<JsonObject>() : doc[top].to<JsonObject>();
+        parent[key] = record["v"];
+    }
+    return !doc.overflowed();
+}
+
+bool ConfigJournal::appendRecord(std::vector<uint8_t>& out, const String& path, JsonVariantConst value, bool remove) {
+    size_t valueSize = remove ? 1 : measureMsgPack(value);
+    if (valueSize + path.length() > CONFIG_RECORD_MAX - 16) return false;
+
+    // Map of three: the value is serialized in place, no copy into a temporary document
+    std::vector<uint8_t> payload;
+    payload.reserve(valueSize + path.length() + 16);
+    payload.push_back(0x83);
+    appendMsgPackString(payload, "g", 1);
+    payload.push_back(0xCE);  // uint32
+    payload.push_back(generation >> 24);
+    payload.push_back(generation >> 16);
+    payload.push_back(generation >> 8);
+    payload.push_back(generation & 0xFF);
+    appendMsgPackString(payload, "p", 1);
+    appendMsgPackString(payload, path.c_str(), path.length());
+    if (remove) {
+        appendMsgPackString(payload, "d", 1);
+        payload.push_back(0xC3);  // true
+    } else {
+        appendMsgPackString(payload, "v", 1);
+        size_t at = payload.size();
+        payload.resize(at + valueSize + 1);
+        payload.resize(at + serializeMsgPack(value, &payload[at], valueSize + 1));
+    }
+
+    uint16_t length = payload.size();
+    uint32_t checksum = hashBytes((const char*)payload.data(), length);
+    uint8_t header[RECORD_HEADER_SIZE] = {
+        (uint8_t)(length & 0xFF), (uint8_t)(length >> 8),
+        (uint8_t)(checksum & 0xFF), (uint8_t)(checksum >> 8),
+        (uint8_t)(checksum >> 16), (uint8_t)(checksum >> 24)
+    };
+    out.insert(out.end(), header, header + RECORD_HEADER_SIZE);
+    out.insert(out.end(), payload.begin(), payload.end());
+    records++;
+    return true;
+}
+
+size_t ConfigJournal::openSnapshot(const uint8_t* data, size_t length) {
+    generation = 0;
+    if (length < CONFIG_SNAPSHOT_HEADER_SIZE || data[0] != CONFIG_SNAPSHOT_MAGIC) {
+        return 0;  // Written by earlier firmware
+    }
+    generation = (uint32_t)data[1] | ((uint32_t)data[2] << 8) |
+                 ((uint32_t)data[3] << 16) | ((uint32_t)data[4] << 24);
+    return CONFIG_SNAPSHOT_HEADER_SIZE;
+}
+
+bool ConfigJournal::replay(JsonDocument& doc) {
+    replayed = 0;
+    skipped = 0;
+    tornAtBoot = false;
+    journalSize = 0;
+
+    File file = LittleFS.open(CONFIG_JOURNAL_FILE, "r");
+    if (!file) {
+        return true;  // No edits since the last snapshot
+    }
+    journalSize = file.size();
+
+    char* payload = (char*)malloc(CONFIG_RECORD_MAX);
+    DynamicJsonDocument record(CONFIG_RECORD_MAX * 2);
+    if (!payload) {
+        Serial.println("ERROR: No memory to replay config journal");
+        file.close();
+        return false;
+    }
+
+    // Stop at the first record that is cut short or fails its checksum
+    while (true) {
+        uint8_t header[RECORD_HEADER_SIZE];
+        size_t got = file.read(header, RECORD_HEADER_SIZE);
+        if (got == 0) break;  // Clean end
+        if (got != RECORD_HEADER_SIZE) {
+            tornAtBoot = true;
+            break;
+        }
+
+        uint16_t length = header[0] | (header[1] << 8);
+        uint32_t checksum = (uint32_t)header[2] | ((uint32_t)header[3] << 8) |
+                            ((uint32_t)header[4] << 16) | ((uint32_t)header[5] << 24);
+        if (length == 0 || length > CONFIG_RECORD_MAX ||
+            file.read((uint8_t*)payload, length) != length ||
+            hashBytes(payload, length) != checksum) {
+            tornAtBoot = true;
+            break;
+        }
+
+        // '{' can't start a MessagePack map: a JSON record from earlier firmware
+        DeserializationError error = payload[0] == '{'
+            ? deserializeJson(record, (const char*)payload, length)
+            : deserializeMsgPack(record, (const char*)payload, length);
+        if (error) {
+            // Its checksum matched, so this is no torn write: skip it, keep the rest
+            Serial.print("WARNING: Unreadable config journal record skipped: ");
+            Serial.println(error.c_str());
+            continue;
+        }
+
+        // Written before the snapshot was: already in it, or superseded by it
+        if ((record["g"] | 0UL) < generation) {
+            skipped++;
+            continue;
+        }
+
+        // Pool full of the values earlier records replaced: null the half-copied
+        // section (it keeps its place), rebuild the pool and apply the record again
+        JsonObjectConst fields = record.as<JsonObjectConst>();
+        String path = fields["p"] | "";
+        bool applied = applyRecord(doc, fields);
+        if (!applied && doc.overflowed()) {
+            clearSection(doc, path);
+            applied = reclaimPool(doc) && applyRecord(doc, fields);
+            if (!applied) removeSection(doc, path);
+        }
+        if (!applied) {
+            Serial.print("WARNING: Config journal record not applied: ");
+            Serial.println(path);
+            continue;
+        }
+        replayed++;
+    }
+    file.close();
+    free(payload);
+
+    Serial.print("Config journal: replayed ");
+    Serial.print(replayed);
+    Serial.print(" record(s), skipped ");
+    Serial.print(skipped);
+    Serial.print(" older than the snapshot, from ");
+    Serial.print(journalSize);
+    Serial.println(" bytes");
+    if (tornAtBoot) {
+        Serial.println("WARNING: Config journal ends in a torn record, later edits dropped");
+    }
+    return !tornAtBoot;
+}
+
+void ConfigJournal::begin(JsonDocument& doc) {
+    if (LittleFS.exists(CONFIG_TEMP_FILE)) {
+        LittleFS.remove(CONFIG_TEMP_FILE);  // Compaction interrupted before its rename
+    }
+
+    collectSections(doc, sections);
+    ready = true;
+
+    // Fold the journal into the snapshot so appends never follow a torn tail
+    if (tornAtBoot || journalSize > CONFIG_JOURNAL_MAX) {
+        compact(doc);
+    }
+}
+
+bool ConfigJournal::commit(JsonDocument& doc) {
+    if (stopped) return false;
+    if (writeFailed) {
+        writeFailed = false;
+        ready = false;  // The journal on flash may end mid-record
+    }
+    if (!ready) {
+        return compact(doc);  // Nothing known to be on flash yet
+    }
+
+    std::map<String, uint32_t> current;
+    collectSections(doc, current);
+
+    // Deletes first: a section replaced by its parent or children replays in order
+    std::vector<String> removed;
+    std::vector<String> changed;
+    for (const auto& pair : sections) {
+        if (current.find(pair.first) == current.end()) {
+            removed.push_back(pair.first);
+        }
+    }
+    for (const auto& pair : current) {
+        auto it = sections.find(pair.first);
+        if (it == sections.end() || it->second != pair.second) {
+            changed.push_back(pair.first);
+        }
+    }
+    if (removed.empty() && changed.empty()) {
+        return true;  // Nothing changed
+    }
+
+    WriteJob* job = new WriteJob();
+    if (!job) return false;
+    job->kind = WRITE_APPEND;
+
+    bool ok = true;
+    for (size_t i = 0; ok && i < removed.size(); i++) {
+        ok = appendRecord(job->data, removed[i], JsonVariantConst(), true);
+    }
+    for (size_t i = 0; ok && i < changed.size(); i++) {
+        ok = appendRecord(job->data, changed[i], sectionValue(doc, changed[i]), false);
+    }
+
+    // Oversized section or a long journal: the snapshot replaces the journal
+    if (!ok || journalSize + job->data.size() > CONFIG_JOURNAL_MAX) {
+        delete job;
+        return compact(doc);
+    }
+
+    journalSize += job->data.size();
+    sections.swap(current);
+    Serial.print("Config journaled: ");
+    Serial.print(removed.size() + changed.size());
+    Serial.print(" section(s), ");
+    Serial.print(job->data.size());
+    Serial.println(" bytes");
+
+    submit(job);
+    return true;
+}
+
+bool ConfigJournal::compact(JsonDocument& doc) {
+    if (stopped) return false;
+    WriteJob* job = new WriteJob();
+    if (!job) return false;
+    job->kind = WRITE_SNAPSHOT;
+
+    // New generation: records already in (or queued for) the journal predate it
+    uint32_t next = generation + 1;
+    size_t size = measureMsgPack(doc);
+    job->data.resize(CONFIG_SNAPSHOT_HEADER_SIZE + size + 1);
+    job->data[0] = CONFIG_SNAPSHOT_MAGIC;
+    job->data[1] = next & 0xFF;
+    job->data[2] = (next >> 8) & 0xFF;
+    job->data[3] = (next >> 16) & 0xFF;
+    job->data[4] = next >> 24;
+    size_t written = serializeMsgPack(doc, job->data.data() + CONFIG_SNAPSHOT_HEADER_SIZE, size + 1);
+    if (written == 0) {
+        Serial.println("ERROR: Failed to serialize config snapshot");
+        delete job;
+        ready = false;
+        return false;
+    }
+    job->data.resize(CONFIG_SNAPSHOT_HEADER_SIZE + written);
+
+    generation = next;
+    journalSize = 0;
+    collectSections(doc, sections);
+    ready = true;
+
+    submit(job);
+    return true;
+}
+
+void ConfigJournal::submit(WriteJob* job) {
+    if (!task) {
+        execute(*job);  // Writer not running (boot, or it failed to start)
+        delete job;
+        return;
+    }
+
+    // In order; only blocks when CONFIG_WRITE_QUEUE_LENGTH writes are still pending
+    xQueueSend(writeQueue, &job, portMAX_DELAY);
+}
+
+void ConfigJournal::execute(WriteJob& job) {
+    if (job.kind == WRITE_BARRIER) {
+        xSemaphoreGive(flushDone);
+        return;
+    }
+
+    if (job.kind == WRITE_APPEND) {
+        // The journal may end mid-record: replay would stop there and drop this
+        if (appendsHeld) {
+            Serial.println("WARNING: Config journal append dropped until the next snapshot");
+            return;
+        }
+
+        File file = LittleFS.open(CONFIG_JOURNAL_FILE, "a");
+        bool ok = file && file.write(job.data.data(), job.data.size()) == job.data.size();
+        if (file) file.close();
+        if (!ok) {
+            Serial.println("ERROR: Failed to append to config journal");
+            writeFailed = true;
+            appendsHeld = true;
+            return;
+        }
+        bytesWritten += job.data.size();
+        writes++;
+        return;
+    }
+
+    // Temp file + rename: the snapshot is always either the old or the new one
+    File file = LittleFS.open(CONFIG_TEMP_FILE, "w");
+    bool ok = file && file.write(job.data.data(), job.data.size()) == job.data.size();
+    if (file) file.close();
+    if (!ok || !LittleFS.rename(CONFIG_TEMP_FILE, CONFIG_FILE)) {
+        Serial.println("ERROR: Failed to write config snapshot");
+        LittleFS.remove(CONFIG_TEMP_FILE);
+        writeFailed = true;
+        appendsHeld = true;  // Queued appends were built against this snapshot
+        return;
+    }
+    appendsHeld = false;
+
+    // Everything in the journal is in the snapshot now. A power cut before this
+    // leaves it behind, but its records are an older generation and replay skips them
+    if (LittleFS.exists(CONFIG_JOURNAL_FILE)) {
+        LittleFS.remove(CONFIG_JOURNAL_FILE);
+    }
+    if (LittleFS.exists(CONFIG_LEGACY_FILE)) {
+        LittleFS.remove(CONFIG_LEGACY_FILE);  // Converted from JSON, now safely replaced
+    }
+
+    bytesWritten += job.data.size();
+    writes++;
+    compactions++;
+    Serial.print("Config snapshot written: ");
+    Serial.print(job.data.size());
+    Serial.println(" bytes");
+}
+
+void ConfigJournal::taskMain(void* param) {
+    ConfigJournal* self = static_cast<ConfigJournal*>(param);
+    WriteJob* job = nullptr;
+
+    for (;;) {
+        if (xQueueReceive(self->writeQueue, &job, portMAX_DELAY) == pdTRUE) {
+            if (job->kind == WRITE_STOP) {
+                delete job;
+                xSemaphoreGive(self->flushDone);
+                vTaskDelete(nullptr);
+            }
+            self->execute(*job);
+            delete job;
+        }
+    }
+}
+
+bool ConfigJournal::flush() {
+    if (task) {
+        WriteJob* job = new WriteJob();
+        if (!job) return false;
+        job->kind = WRITE_BARRIER;
+
+        xSemaphoreTake(flushDone, 0);  // Clear a give left over from a timed-out flush
+        xQueueSend(writeQueue, &job, portMAX_DELAY);
+        if (xSemaphoreTake(flushDone, pdMS_TO_TICKS(CONFIG_FLUSH_TIMEOUT)) != pdTRUE) {
+            Serial.println("WARNING: Config writer still busy after flush timeout");
+            return false;
+        }
+    }
+    return !writeFailed;
+}
+
+bool ConfigJournal::stop() {
+    stopped = true;
+    if (!task) return true;
+
+    // Queued writes would only land on a filesystem that is about to be wiped
+    WriteJob* job = nullptr;
+    while (xQueueReceive(writeQueue, &job, 0) == pdTRUE) {
+        delete job;
+    }
+
+    job = new WriteJob();
+    if (!job) return false;
+    job->kind = WRITE_STOP;
+
+    // The writer finishes the write it is in, then takes this and exits
+    xSemaphoreTake(flushDone, 0);
+    xQueueSend(writeQueue, &job, portMAX_DELAY);
+    if (xSemaphoreTake(flushDone, pdMS_TO_TICKS(CONFIG_FLUSH_TIMEOUT)) != pdTRUE) {
+        Serial.println("WARNING: Config writer still busy after stop timeout");
+        return false;
+    }
+    task = nullptr;
+    Serial.println("Config writer stopped");
+    return true;
+}
+
+void ConfigJournal::toJson(JsonObject out) {
+    out["journalBytes"] = journalSize;
+    out["journalMax"] = CONFIG_JOURNAL_MAX;
+    out["sections"] = sections.size();
+    out["saveRequests"] = saveRequests;
+    out["writes"] = writes;
+    out["records"] = records;
+    out["compactions"] = compactions;
+    out["bytesWritten"] = bytesWritten;
+    out["generation"] = generation;
+    out["replayedAtBoot"] = replayed;
+    out["skippedAtBoot"] = skipped;
+    out["tornAtBoot"] = tornAtBoot;
+    out["pending"] = writeQueue ? uxQueueMessagesWaiting(writeQueue) : 0;
+}
@@ -0,0 +1,160 @@
+#include "connection_pool.h"
+
+ConnectionPool::ConnectionPool()
+    : reused(0), handshakes(0), handshakeUsTotal(0), staleRetries(0) {
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        entries[i].port = 0;
+        entries[i].client = nullptr;
+        entries[i].lastUsed = 0;
+        entries[i].inUse = false;
+    }
+    lock = xSemaphoreCreateMutex();
+}
+
+void ConnectionPool::closeEntry(Entry& entry) {
+    if (entry.client) {
+        entry.client->stop();
+        delete entry.client;
+    }
+    entry.client = nullptr;
+    entry.host = "";
+    entry.port = 0;
+    entry.inUse = false;
+}
+
+WiFiClientSecure* ConnectionPool::acquire(const String& host, uint16_t port, bool& reused) {
+    reused = false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    // Idle connection to the same host
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        Entry& entry = entries[i];
+        if (entry.client && !entry.inUse && entry.port == port && entry.host == host) {
+            if (entry.client->connected() && (millis() - entry.lastUsed) < POOL_IDLE_TIMEOUT) {
+                entry.inUse = true;
+                reused = true;
+                this->reused++;
+                xSemaphoreGive(lock);
+                return entry.client;
+            }
+            closeEntry(entry);  // Server closed it or it sat too long
+        }
+    }
+
+    // Free slot, otherwise evict the least recently used idle connection
+    Entry* slot = nullptr;
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        Entry& entry = entries[i];
+        if (!entry.client) {
+            slot = &entry;
+            break;
+        }
+        if (!entry.inUse && (!slot || entry.lastUsed < slot->lastUsed)) {
+            slot = &entry;
+        }
+    }
+
+    WiFiClientSecure* client = new WiFiClientSecure;
+    if (client && slot) {
+        closeEntry(*slot);
+        slot->host = host;
+        slot->port = port;
+        slot->client = client;
+        slot->inUse = true;
+    }
+    // No slot (all busy): caller gets an unpooled client, deleted on release
+
+    xSemaphoreGive(lock);
+    return client;
+}
+
+void ConnectionPool::release(WiFiClientSecure* client, bool keepAlive) {
+    if (!client) return;
+
+    if (keepAlive && ESP.getFreeHeap() < POOL_MIN_FREE_HEAP) {
+        keepAlive = false;  // TLS buffers are the first thing to give back
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        Entry& entry = entries[i];
+        if (entry.client == client) {
+            if (keepAlive && client->connected()) {
+                entry.inUse = false;
+                entry.lastUsed = millis();
+            } else {
+                closeEntry(entry);
+            }
+            xSemaphoreGive(lock);
+            return;
+        }
+    }
+    xSemaphoreGive(lock);
+
+    // Not pooled
+    client->stop();
+    delete client;
+}
+
+void ConnectionPool::closeIdle() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        Entry& entry = entries[i];
+        if (entry.client && !entry.inUse &&
+            ((millis() - entry.lastUsed) >= POOL_IDLE_TIMEOUT || !entry.client->connected())) {
+            closeEntry(entry);
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
+void ConnectionPool::recordHandshake(uint32_t us) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    handshakes++;
+    handshakeUsTotal += us;
+    xSemaphoreGive(lock);
+}
+
+void ConnectionPool::toJson(JsonObject out) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t avgHandshakeUs = handshakes ? handshakeUsTotal / handshakes : 0;
+    out["reused"] = reused;
+    out["handshakes"] = handshakes;
+    out["staleRetries"] = staleRetries;
+    out["avgHandshakeMs"] = avgHandshakeUs / 1000;
+    out["savedMs"] = (uint64_t)reused * avgHandshakeUs / 1000;  // Estimate
+
+    JsonArray open = out.createNestedArray("open");
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        if (entries[i].client) {
+            JsonObject conn = open.createNestedObject();
+            conn["host"] = entries[i].host;
+            conn["inUse"] = entries[i].inUse;
+            conn["idleMs"] = entries[i].inUse ? 0 : millis() - entries[i].lastUsed;
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
+void ConnectionPool::print() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t avgHandshakeUs = handshakes ? handshakeUsTotal / handshakes : 0;
+    Serial.printf("Reused: %u, new handshakes: %u (avg %ums), stale retries: %u\n",
+                  (unsigned)reused, (unsigned)handshakes, (unsigned)(avgHandshakeUs / 1000), (unsigned)staleRetries);
+    Serial.printf("Handshake time saved: ~%lums\n", (unsigned long)((uint64_t)reused * avgHandshakeUs / 1000));
+
+    for (uint8_t i = 0; i < POOL_MAX_CONNECTIONS; i++) {
+        if (entries[i].client) {
+            Serial.print("  ");
+            Serial.print(entries[i].host);
+            if (entries[i].inUse) {
+                Serial.println(" - in use");
+            } else {
+                Serial.print(" - idle ");
+                Serial.print((millis() - entries[i].lastUsed) / 1000);
+                Serial.println("s");
+            }
+        }
+    }
+    xSemaphoreGive(lock);
+}
@@ -1,7 +1,11 @@
 #include "display.h"
 #include "config.h"
+#include "readings_store.h"
 #include <WiFi.h>
 
+// Live readings (initialized in main)
+extern ReadingsStore readings;
+
 DisplayManager::DisplayManager()
     : u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE), currentState(SPLASH),
       currentBrightness(255), brightnessIncreasing(false) {
@@ -410,7 +414,8 @@ void DisplayManager::showCustom(float value, const char* label, const char* unit
 
 void DisplayManager::showModule(const char* moduleId) {
     JsonObject module = config["modules"][moduleId];
-    unsigned long lastUpdate = module["lastUpdate"] | 0;
+    const ModuleReading& reading = readings.read(moduleId);
+    unsigned long lastUpdate = reading.lastUpdate;
     bool stale = isCacheStale(moduleId);
 
     // Get module type to support dynamic module IDs
@@ -418,8 +423,8 @@ void DisplayManager::showModule(const char* moduleId) {
 
     if (moduleType == "crypto") {
         // Support both old hardcoded IDs and new dynamic IDs
-        float price = module["value"] | 0.0;
-        float change = module["change24h"] | 0.0;
+        float price = reading.value;
+        float change = reading.change;
         const char* cryptoName = module["cryptoName"] | "Crypto";
         const char* cryptoSymbol = module["cryptoSymbol"] | "???";
 
@@ -435,13 +440,13 @@ void DisplayManager::showModule(const char* moduleId) {
     }
     else if (moduleType == "stock") {
         const char* ticker = module["ticker"] | "STOCK";
-        float price = module["value"] | 0.0;
-        float change = module["change"] | 0.0;
+        float price = reading.value;
+        float change = reading.change;
         showStock(ticker, price, change, lastUpdate, stale);
     }
     else if (moduleType == "weather") {
-        float temp = module["temperature"] | 0.0;
-        const char* condition = module["condition"] | "Unknown";
+        float temp = reading.temperature;
+        const char* condition = reading.condition;
         const char* location = module["location"] | "Unknown";
         showWeather(temp, condition, location, lastUpdate, stale);
     }
@@ -452,9 +457,8 @@ void DisplayManager::showModule(const char* moduleId) {
         showCustom(value, label, unit, lastUpdate);
     }
     else if (moduleType == "settings") {
-        uint32_t code = module["securityCode"] | 0;
-        unsigned long timeRemaining = module["codeTimeRemaining"] | 0;
-        unsigned long lastUpdate = module["lastUpdate"] | 0;
+        uint32_t code = reading.securityCode;
+        unsigned long timeRemaining = reading.codeTimeRemaining;
         String ip = WiFi.localIP().toString();
 
         Serial.print("Showing settings module - Code: ");
@@ -695,7 +699,7 @@ void DisplayManager::showQuadScreen(const char* slot1, const char* slot2, const
 
         if (type == "crypto") {
             String symbol = module["cryptoSymbol"] | "?";
-            float value = module["value"] | 0.0;
+            float value = readings.read(moduleId).value;
             int decimals = module["decimals"] | -1;
 
             String valueStr;
@@ -721,7 +725,7 @@ void DisplayManager::showQuadScreen(const char* slot1, const char* slot2, const
             return {symbol, valueStr, true};  // hasCurrency = true
         } else if (type == "stock") {
             String ticker = module["ticker"] | "?";
-            float value = module["value"] | 0.0;
+            float value = readings.read(moduleId).value;
             int decimals = module["decimals"] | -1;
 
             String valueStr;
@@ -746,7 +750,7 @@ void DisplayManager::showQuadScreen(const char* slot1, const char* slot2, const
             }
             return {ticker, valueStr, true};  // hasCurrency = true
         } else if (type == "weather") {
-            float temp = module["temperature"] | 0.0;
+            float temp = readings.read(moduleId).temperature;
             String location = module["location"] | "";
             String unit = module["unit"] | "C";
             // Apply abbreviations (e.g., "San Francisco" -> "SF", or truncate if too long)
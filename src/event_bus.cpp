@@ -0,0 +1,32 @@
+#include "event_bus.h"
+
+EventBus::EventBus() : nextId(1), published(0) {
+}
+
+int EventBus::subscribe(EventListener callback) {
+    if (listeners.size() >= EVENT_BUS_MAX_LISTENERS) {
+        return -1;
+    }
+    int id = nextId++;
+    listeners.push_back({id, callback});
+    return id;
+}
+
+void EventBus::unsubscribe(int id) {
+    for (auto it = listeners.begin(); it != listeners.end(); ++it) {
+        if (it->id == id) {
+            listeners.erase(it);
+            return;
+        }
+    }
+}
+
+void EventBus::publish(const char* event, const String& data) {
+    published++;
+
+    // Copy first - a listener may unsubscribe while being called
+    std::vector<Listener> targets = listeners;
+    for (Listener& listener : targets) {
+        listener.callback(event, data);
+    }
+}
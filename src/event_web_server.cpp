@@ -0,0 +1,876 @@
+#include "event_web_server.h"
+#include <lwip/sockets.h>
+
+// Handles stay unique across server restarts, so a late fetch callback
+// can't answer a request on a newer server
+static ResponseHandle nextHandle = 1;
+
+// Print that frames its output as HTTP/1.1 chunks (raw for HTTP/1.0 clients)
+// into the connection's outgoing queue
+class ChunkedPrint : public Print {
+public:
+    ChunkedPrint(std::vector<uint8_t>& out, bool framed)
+        : out(out), framed(framed), len(0), total(0) {}
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+
+    size_t write(const uint8_t* data, size_t size) override {
+        size_t done = 0;
+        while (done < size) {
+            size_t n = size - done;
+            if (n > sizeof(buf) - len) n = sizeof(buf) - len;
+            memcpy(buf + len, data + done, n);
+            len += n;
+            done += n;
+            if (len == sizeof(buf)) sendChunk();
+        }
+        total += size;
+        return size;
+    }
+
+    void sendChunk() {
+        if (len > 0) {
+            if (framed) {
+                char size[12];
+                int n = snprintf(size, sizeof(size), "%X\r\n", (unsigned)len);
+                out.insert(out.end(), size, size + n);
+            }
+            out.insert(out.end(), buf, buf + len);
+            if (framed) {
+                out.insert(out.end(), {'\r', '\n'});
+            }
+        }
+        len = 0;
+    }
+
+    void end() {
+        sendChunk();
+        if (framed) {
+            static const char last[] = "0\r\n\r\n";  // Last chunk
+            out.insert(out.end(), last, last + 5);
+        }
+    }
+
+    size_t getBytesOut() { return total; }
+
+private:
+    std::vector<uint8_t>& out;
+    bool framed;
+    uint8_t buf[HTTP_CHUNK_SIZE];
+    size_t len;
+    size_t total;
+};
+
+EventWebServer::EventWebServer(uint16_t port)
+    : listener(port, HTTP_MAX_CONNECTIONS), current(nullptr), responded(false),
+      requests(0), keepAliveReuses(0), rejected(0), deferredCount(0),
+      deferredTimeouts(0), maxHandlerUs(0), streamed(0), lastTtfbUs(0), maxTtfbUs(0),
+      eventsSent(0) {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        conns[i].state = CONN_FREE;
+        conns[i].body = nullptr;
+        conns[i].payload = nullptr;
+        conns[i].stream = nullptr;
+        resetRequest(conns[i]);
+    }
+}
+
+EventWebServer::~EventWebServer() {
+    stop();
+}
+
+void EventWebServer::on(const String& uri, RequestHandler handler) {
+    on(uri, HTTP_ANY, handler);
+}
+
+void EventWebServer::on(const String& uri, HTTPMethod method, RequestHandler handler) {
+    routes.push_back({uri, method, handler});
+}
+
+void EventWebServer::begin() {
+    listener.begin();
+    listener.setNoDelay(true);
+}
+
+void EventWebServer::stop() {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        if (conns[i].state != CONN_FREE) {
+            close(conns[i]);
+        }
+    }
+    listener.end();
+}
+
+void EventWebServer::handleClient() {
+    accept();
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        poll(conns[i]);
+    }
+}
+
+void EventWebServer::accept() {
+    while (listener.hasClient()) {
+        WiFiClient client = listener.available();
+        if (!client) break;
+
+        // Free slot, otherwise the longest idle keep-alive connection
+        Connection* slot = nullptr;
+        for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+            Connection& conn = conns[i];
+            if (conn.state == CONN_FREE) {
+                slot = &conn;
+                break;
+            }
+            bool idle = conn.state == CONN_READ_REQUEST && conn.requestStart == 0 && conn.served > 0;
+            if (idle && (!slot || conn.lastActivity < slot->lastActivity)) {
+                slot = &conn;
+            }
+        }
+
+        if (!slot) {
+            client.print("HTTP/1.1 503 Service Unavailable\r\nConnection: close\r\nContent-Length: 0\r\n\r\n");
+            client.stop();
+            rejected++;
+            continue;
+        }
+        if (slot->state != CONN_FREE) {
+            close(*slot);
+        }
+
+        slot->client = client;
+        slot->client.setNoDelay(true);
+        resetRequest(*slot);
+        slot->served = 0;
+        slot->state = CONN_READ_REQUEST;
+        slot->lastActivity = millis();
+    }
+}
+
+void EventWebServer::poll(Connection& conn) {
+    unsigned long now = millis();
+
+    switch (conn.state) {
+        case CONN_FREE:
+            return;
+
+        case CONN_READ_REQUEST:
+        case CONN_READ_HEADERS:
+        case CONN_READ_BODY:
+            if (readRequest(conn)) {
+                dispatch(conn);
+                return;
+            }
+            if (conn.state == CONN_WRITING || conn.state == CONN_FREE) {
+                return;  // Malformed request answered, or closed
+            }
+            if (!conn.client.connected() && !conn.client.available()) {
+                close(conn);
+            } else if (conn.requestStart == 0) {
+                if (now - conn.lastActivity > HTTP_KEEPALIVE_TIMEOUT) {
+                    close(conn);
+                }
+            } else if (now - conn.requestStart > HTTP_REQUEST_TIMEOUT) {
+                sendError(conn, 408, "Request timeout");
+            }
+            return;
+
+        case CONN_DEFERRED:
+            if (!conn.client.connected()) {
+                close(conn);  // Client gave up - a late sendDeferred() finds nothing
+            } else if (now - conn.deferredAt > HTTP_DEFERRED_TIMEOUT) {
+                deferredTimeouts++;
+                sendError(conn, 504, "Timed out waiting for data");
+            }
+            return;
+
+        case CONN_WRITING:
+            writeSome(conn);  // Moves lastActivity on progress
+            if (conn.state == CONN_WRITING && millis() - conn.lastActivity > HTTP_WRITE_TIMEOUT) {
+                close(conn);  // Client stopped reading
+            }
+            return;
+
+        case CONN_EVENT_STREAM:
+            while (conn.client.available()) {
+                conn.client.read();  // Clients don't send on an event stream
+            }
+            if (!conn.client.connected()) {
+                close(conn);
+                return;
+            }
+            if (!flushPending(conn)) {
+                return;  // Closed
+            }
+            // Measured after the flush, which moves lastActivity on progress
+            if (conn.pendingPos < conn.pending.size()) {
+                if (millis() - conn.lastActivity > HTTP_WRITE_TIMEOUT) {
+                    close(conn);  // Client stopped reading
+                }
+            } else if (millis() - conn.lastActivity > HTTP_EVENT_HEARTBEAT) {
+                writeEvent(conn, ":\n\n");
+            }
+            return;
+    }
+}
+
+bool EventWebServer::readRequest(Connection& conn) {
+    size_t budget = HTTP_READ_PER_POLL;
+
+    while (budget > 0 && conn.client.available()) {
+        if (conn.state == CONN_READ_BODY) {
+            uint8_t buf[128];
+            size_t want = conn.contentLength - conn.body->length();
+            if (want > sizeof(buf)) want = sizeof(buf);
+            if (want > budget) want = budget;
+            int n = conn.client.read(buf, want);
+            if (n <= 0) break;
+            for (int i = 0; i < n; i++) {
+                *conn.body += (char)buf[i];
+            }
+            budget -= n;
+            conn.lastActivity = millis();
+            if (conn.body->length() >= conn.contentLength) {
+                return true;
+            }
+            continue;
+        }
+
+        int c = conn.client.read();
+        if (c < 0) break;
+        budget--;
+        conn.lastActivity = millis();
+        if (conn.requestStart == 0) {
+            conn.requestStart = conn.lastActivity;
+        }
+
+        if (c == '\r') continue;
+        if (c != '\n') {
+            if (conn.line.length() >= HTTP_MAX_LINE) {
+                sendError(conn, 431, "Request line or header too long");
+                return false;
+            }
+            conn.line += (char)c;
+            continue;
+        }
+
+        if (!processLine(conn)) {
+            return false;
+        }
+        if (conn.state == CONN_READ_BODY && conn.contentLength == 0) {
+            return true;  // Headers done, no body
+        }
+    }
+    return false;
+}
+
+bool EventWebServer::processLine(Connection& conn) {
+    String line = conn.line;
+    conn.line = "";
+
+    if (conn.state == CONN_READ_REQUEST) {
+        if (line.length() == 0) {
+            conn.requestStart = 0;  // Stray CRLF between keep-alive requests
+            return true;
+        }
+
+        // METHOD SP target SP version
+        int sp1 = line.indexOf(' ');
+        int sp2 = line.indexOf(' ', sp1 + 1);
+        if (sp1 <= 0 || sp2 < 0) {
+            sendError(conn, 400, "Bad request line");
+            return false;
+        }
+        conn.method = parseMethod(line.substring(0, sp1));
+        String target = line.substring(sp1 + 1, sp2);
+        conn.http11 = line.substring(sp2 + 1) == "HTTP/1.1";
+        conn.keepAlive = conn.http11;  // 1.0 closes unless asked
+
+        int q = target.indexOf('?');
+        if (q >= 0) {
+            conn.uri = urlDecode(target.substring(0, q));
+            conn.query = target.substring(q + 1);
+        } else {
+            conn.uri = urlDecode(target);
+        }
+        conn.state = CONN_READ_HEADERS;
+        return true;
+    }
+
+    // Blank line ends the headers
+    if (line.length() == 0) {
+        if (conn.contentLength > 0) {
+            conn.body = new String();
+            if (!conn.body || !conn.body->reserve(conn.contentLength)) {
+                sendError(conn, 413, "Body too large");
+                return false;
+            }
+        }
+        conn.state = CONN_READ_BODY;
+        return true;
+    }
+
+    int colon = line.indexOf(':');
+    if (colon <= 0) {
+        return true;  // Not a header - ignore
+    }
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+
+    if (name.equalsIgnoreCase("Content-Length")) {
+        long length = value.toInt();
+        if (length < 0 || length > HTTP_MAX_BODY) {
+            sendError(conn, 413, "Body too large");
+            return false;
+        }
+        conn.contentLength = length;
+    } else if (name.equalsIgnoreCase("Transfer-Encoding")) {
+        sendError(conn, 411, "Content-Length required");
+        return false;
+    } else if (name.equalsIgnoreCase("Connection")) {
+        value.toLowerCase();
+        if (value.indexOf("close") >= 0) {
+            conn.keepAlive = false;
+        } else if (value.indexOf("keep-alive") >= 0) {
+            conn.keepAlive = true;
+        }
+    }
+
+    if (conn.headers.size() < HTTP_MAX_HEADERS) {
+        conn.headers.push_back({name, value});
+    }
+    return true;
+}
+
+void EventWebServer::dispatch(Connection& conn) {
+    requests++;
+    if (conn.served > 0) {
+        keepAliveReuses++;
+    }
+
+    args.clear();
+    responseHeaders.clear();
+    responded = false;
+    parseArgs(conn.query);
+    if (conn.body && conn.method == HTTP_POST) {
+        for (auto& h : conn.headers) {
+            if (h.first.equalsIgnoreCase("Content-Type") &&
+                h.second.startsWith("application/x-www-form-urlencoded")) {
+                parseArgs(*conn.body);
+            }
+        }
+    }
+
+    // HEAD runs the GET handler; respond() leaves out the body
+    HTTPMethod match = conn.method == HTTP_HEAD ? HTTP_GET : conn.method;
+    Route* route = nullptr;
+    for (Route& r : routes) {
+        if (r.uri == conn.uri && (r.method == HTTP_ANY || r.method == match)) {
+            route = &r;
+            break;
+        }
+    }
+
+    current = &conn;
+    conn.dispatchedUs = micros() | 1;  // Never 0 (= not dispatched)
+    if (conn.method == HTTP_ANY) {
+        sendError(conn, 501, "Method not supported");
+    } else if (!route) {
+        send(404, "text/plain", "Not found: " + conn.uri);
+    } else {
+        uint32_t start = micros();
+        route->handler();
+        uint32_t elapsed = micros() - start;
+        if (elapsed > maxHandlerUs) {
+            maxHandlerUs = elapsed;
+        }
+        if (!responded && conn.state != CONN_FREE) {
+            sendError(conn, 500, "Handler sent no response");
+        }
+    }
+    current = nullptr;
+}
+
+void EventWebServer::buildHead(Connection& conn, int code, const char* contentType, long length,
+                               const std::vector<std::pair<String, String>>* extraHeaders) {
+    conn.head = "HTTP/1.1 ";
+    conn.head += code;
+    conn.head += " ";
+    conn.head += statusText(code);
+    if (code != 304) {  // 304 is headers only - the client reuses its cached body
+        conn.head += "\r\nContent-Type: ";
+        conn.head += contentType;
+        if (length >= 0) {
+            conn.head += "\r\nContent-Length: ";
+            conn.head += length;
+        } else if (length == LENGTH_CHUNKED && conn.http11) {
+            conn.head += "\r\nTransfer-Encoding: chunked";
+        }
+    }
+    conn.head += conn.keepAlive ? "\r\nConnection: keep-alive" : "\r\nConnection: close";
+    if (extraHeaders) {
+        for (auto& h : *extraHeaders) {
+            conn.head += "\r\n" + h.first + ": " + h.second;
+        }
+    }
+    conn.head += "\r\n\r\n";
+    conn.headPos = 0;
+}
+
+void EventWebServer::respond(Connection& conn, int code, const char* contentType,
+                             const uint8_t* data, size_t length, String* owned,
+                             const std::vector<std::pair<String, String>>* extraHeaders) {
+    if (code == 304) {
+        length = 0;
+    }
+    buildHead(conn, code, contentType, length, extraHeaders);
+
+    delete conn.payload;
+    conn.payload = owned;
+    conn.bodyData = data;
+    conn.bodyLen = conn.method == HTTP_HEAD ? 0 : length;  // HEAD: Content-Length only
+    conn.bodyPos = 0;
+    conn.deferred = 0;
+    conn.state = CONN_WRITING;
+
+    // Small responses go out right away, large ones continue on later polls
+    writeSome(conn);
+}
+
+long EventWebServer::writeNow(Connection& conn, const uint8_t* data, size_t length) {
+    // MSG_DONTWAIT: WiFiClient::write() would wait (up to 10s) for the client to read
+    ssize_t n = lwip_send(conn.client.fd(), data, length, MSG_DONTWAIT);
+    if (n >= 0) {
+        return n;
+    }
+    return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+}
+
+bool EventWebServer::flushPending(Connection& conn) {
+    while (conn.pendingPos < conn.pending.size()) {
+        long n = writeNow(conn, conn.pending.data() + conn.pendingPos, conn.pending.size() - conn.pendingPos);
+        if (n < 0) {
+            close(conn);
+            return false;
+        }
+        if (n == 0) {
+            return true;  // Send buffer full - the rest on a later poll
+        }
+        conn.pendingPos += n;
+        conn.lastActivity = millis();
+    }
+    conn.pending.clear();
+    conn.pendingPos = 0;
+    return true;
+}
+
+void EventWebServer::writeSome(Connection& conn) {
+    size_t budget = HTTP_WRITE_PER_POLL;
+
+    // Head, then queued chunks (refilled from the producer), then the body -
+    // each only as far as the socket takes it without waiting
+    while (budget > 0) {
+        const uint8_t* data;
+        size_t length;
+        size_t* pos;
+        if (conn.headPos < conn.head.length()) {
+            data = (const uint8_t*)conn.head.c_str();
+            length = conn.head.length();
+            pos = &conn.headPos;
+        } else if (conn.pendingPos < conn.pending.size()) {
+            data = conn.pending.data();
+            length = conn.pending.size();
+            pos = &conn.pendingPos;
+        } else if (conn.stream) {
+            // Pull from the producer until a poll's share is framed
+            conn.pending.clear();
+            conn.pendingPos = 0;
+            bool more = true;
+            while (more && conn.pending.size() < HTTP_WRITE_PER_POLL) {
+                more = conn.producer(*conn.stream);
+            }
+            if (more) {
+                conn.stream->sendChunk();
+            } else {
+                conn.stream->end();
+                delete conn.stream;
+                conn.stream = nullptr;
+                conn.producer = nullptr;
+            }
+            continue;
+        } else if (conn.bodyPos < conn.bodyLen) {
+            data = conn.bodyData;
+            length = conn.bodyLen;
+            pos = &conn.bodyPos;
+        } else {
+            finishResponse(conn);
+            return;
+        }
+
+        size_t n = length - *pos;
+        if (n > budget) n = budget;
+        long written = writeNow(conn, data + *pos, n);
+        if (written < 0) {
+            close(conn);  // Socket error - client went away
+            return;
+        }
+        if (written == 0) {
+            return;  // Send buffer full - the rest on a later poll
+        }
+        if (pos == &conn.headPos && conn.headPos == 0 && conn.dispatchedUs) {
+            lastTtfbUs = micros() - conn.dispatchedUs;
+            if (lastTtfbUs > maxTtfbUs) {
+                maxTtfbUs = lastTtfbUs;
+            }
+        }
+        *pos += written;
+        budget -= written;
+        conn.lastActivity = millis();
+    }
+}
+
+void EventWebServer::finishResponse(Connection& conn) {
+    conn.served++;
+    if (conn.keepAlive && conn.client.connected()) {
+        resetRequest(conn);
+        conn.state = CONN_READ_REQUEST;
+    } else {
+        close(conn);
+    }
+}
+
+void EventWebServer::resetRequest(Connection& conn) {
+    conn.requestStart = 0;
+    conn.line = "";
+    conn.method = HTTP_GET;
+    conn.uri = "";
+    conn.query = "";
+    conn.headers.clear();
+    delete conn.body;
+    conn.body = nullptr;
+    conn.contentLength = 0;
+    conn.keepAlive = false;
+    conn.http11 = false;
+    conn.dispatchedUs = 0;
+
+    conn.head = "";
+    conn.headPos = 0;
+    delete conn.payload;
+    conn.payload = nullptr;
+    conn.bodyData = nullptr;
+    conn.bodyLen = 0;
+    conn.bodyPos = 0;
+    conn.producer = nullptr;
+    delete conn.stream;
+    conn.stream = nullptr;
+    conn.pending.clear();
+    conn.pending.shrink_to_fit();
+    conn.pendingPos = 0;
+    conn.deferred = 0;
+    conn.deferredAt = 0;
+}
+
+void EventWebServer::close(Connection& conn) {
+    conn.client.stop();
+    resetRequest(conn);
+    conn.state = CONN_FREE;
+    if (current == &conn) {
+        current = nullptr;
+    }
+}
+
+void EventWebServer::sendError(Connection& conn, int code, const char* message) {
+    // The rest of the stream can't be trusted after a bad request
+    conn.keepAlive = false;
+    String* text = new String(message);
+    respond(conn, code, "text/plain", (const uint8_t*)text->c_str(), text->length(), text, nullptr);
+}
+
+void EventWebServer::parseArgs(const String& encoded) {
+    int start = 0;
+    while (start < (int)encoded.length()) {
+        int end = encoded.indexOf('&', start);
+        if (end < 0) end = encoded.length();
+        String pair = encoded.substring(start, end);
+        if (pair.length() > 0) {
+            int eq = pair.indexOf('=');
+            if (eq >= 0) {
+                args.push_back({urlDecode(pair.substring(0, eq)), urlDecode(pair.substring(eq + 1))});
+            } else {
+                args.push_back({urlDecode(pair), String()});
+            }
+        }
+        start = end + 1;
+    }
+}
+
+String EventWebServer::arg(const String& name) {
+    if (!current) return "";
+    if (name == "plain") {
+        return current->body ? *current->body : String();
+    }
+    for (auto& a : args) {
+        if (a.first == name) return a.second;
+    }
+    return "";
+}
+
+bool EventWebServer::hasArg(const String& name) {
+    if (!current) return false;
+    if (name == "plain") {
+        return current->body != nullptr;
+    }
+    for (auto& a : args) {
+        if (a.first == name) return true;
+    }
+    return false;
+}
+
+String EventWebServer::header(const String& name) {
+    if (!current) return "";
+    for (auto& h : current->headers) {
+        if (h.first.equalsIgnoreCase(name)) return h.second;
+    }
+    return "";
+}
+
+String EventWebServer::uri() {
+    return current ? current->uri : String();
+}
+
+HTTPMethod EventWebServer::method() {
+    return current ? current->method : HTTP_ANY;
+}
+
+void EventWebServer::sendHeader(const String& name, const String& value) {
+    responseHeaders.push_back({name, value});
+}
+
+void EventWebServer::send(int code, const char* contentType, const String& content) {
+    if (!current || current->state != CONN_READ_BODY) return;  // No request, or already answered
+
+    String* body = new String(content);
+    if (!body) {
+        close(*current);
+        return;
+    }
+    responded = true;
+    respond(*current, code, contentType, (const uint8_t*)body->c_str(), body->length(), body, &responseHeaders);
+    responseHeaders.clear();
+}
+
+void EventWebServer::send_P(int code, PGM_P contentType, PGM_P content) {
+    send_P(code, contentType, content, strlen_P(content));
+}
+
+void EventWebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t length) {
+    if (!current || current->state != CONN_READ_BODY) return;
+
+    // Flash is memory-mapped on ESP32 - the body streams straight from it
+    responded = true;
+    respond(*current, code, contentType, (const uint8_t*)content, length, nullptr, &responseHeaders);
+    responseHeaders.clear();
+}
+
+void EventWebServer::sendChunked(int code, const char* contentType, ChunkProducer producer) {
+    if (!current || current->state != CONN_READ_BODY) return;
+
+    Connection& conn = *current;
+    if (conn.method != HTTP_HEAD) {  // HEAD: headers only, the producer never runs
+        conn.stream = new ChunkedPrint(conn.pending, conn.http11);
+        if (!conn.stream) {
+            close(conn);
+            return;
+        }
+        conn.producer = producer;
+    }
+    if (!conn.http11) {
+        conn.keepAlive = false;  // HTTP/1.0: the body ends when the connection closes
+    }
+    responded = true;
+    streamed++;
+    buildHead(conn, code, contentType, LENGTH_CHUNKED, &responseHeaders);
+    responseHeaders.clear();
+    conn.state = CONN_WRITING;
+    writeSome(conn);
+}
+
+bool EventWebServer::beginEventStream() {
+    if (!current || current->state != CONN_READ_BODY) return false;
+    if (getEventStreamCount() >= HTTP_MAX_EVENT_STREAMS) return false;
+
+    Connection& conn = *current;
+    conn.keepAlive = false;  // The stream ends when either side closes
+    responseHeaders.push_back({"Cache-Control", "no-cache"});
+    buildHead(conn, 200, "text/event-stream", LENGTH_UNTIL_CLOSE, &responseHeaders);
+    responseHeaders.clear();
+    responded = true;
+
+    if (conn.method == HTTP_HEAD) {
+        conn.state = CONN_WRITING;  // Headers, then close - no stream behind them
+        writeSome(conn);
+        return true;
+    }
+
+    // Small enough to go out in one write; retry tells the browser how soon to reconnect
+    conn.head += "retry: 3000\n\n";
+    conn.state = CONN_EVENT_STREAM;
+    writeEvent(conn, conn.head);
+    conn.head = "";
+    return true;
+}
+
+uint8_t EventWebServer::broadcastEvent(const char* event, const String& data) {
+    uint8_t reached = 0;
+    String text;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        Connection& conn = conns[i];
+        if (conn.state != CONN_EVENT_STREAM) continue;
+        if (text.length() == 0) {
+            text = "event: ";
+            text += event;
+            text += "\ndata: ";
+            text += data;  // Single-line JSON - no embedded newlines to split
+            text += "\n\n";
+        }
+        if (writeEvent(conn, text)) {
+            reached++;
+            eventsSent++;
+        }
+    }
+    return reached;
+}
+
+bool EventWebServer::writeEvent(Connection& conn, const String& text) {
+    // Queued behind whatever the client hasn't taken yet
+    if (conn.pending.size() - conn.pendingPos + text.length() > HTTP_EVENT_BACKLOG) {
+        close(conn);  // Too slow to keep up
+        return false;
+    }
+    conn.pending.erase(conn.pending.begin(), conn.pending.begin() + conn.pendingPos);
+    conn.pendingPos = 0;
+    conn.pending.insert(conn.pending.end(), text.c_str(), text.c_str() + text.length());
+    return flushPending(conn);
+}
+
+uint8_t EventWebServer::getEventStreamCount() {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        if (conns[i].state == CONN_EVENT_STREAM) count++;
+    }
+    return count;
+}
+
+ResponseHandle EventWebServer::defer() {
+    if (!current || current->state != CONN_READ_BODY) return 0;
+
+    ResponseHandle handle = nextHandle++;
+    if (nextHandle == 0) nextHandle = 1;
+    current->state = CONN_DEFERRED;
+    current->deferred = handle;
+    current->deferredAt = millis();
+    responded = true;
+    deferredCount++;
+    return handle;
+}
+
+bool EventWebServer::sendDeferred(ResponseHandle handle, int code, const char* contentType, const String& content) {
+    if (handle == 0) return false;
+
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        Connection& conn = conns[i];
+        if (conn.state == CONN_DEFERRED && conn.deferred == handle) {
+            String* body = new String(content);
+            if (!body) {
+                close(conn);
+                return false;
+            }
+            respond(conn, code, contentType, (const uint8_t*)body->c_str(), body->length(), body, nullptr);
+            return true;
+        }
+    }
+    return false;  // Timed out or the client disconnected
+}
+
+uint8_t EventWebServer::getOpenConnections() {
+    uint8_t open = 0;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        if (conns[i].state != CONN_FREE) open++;
+    }
+    return open;
+}
+
+bool EventWebServer::isWriting() {
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        if (conns[i].state == CONN_WRITING) return true;
+    }
+    return false;
+}
+
+void EventWebServer::toJson(JsonObject out) {
+    out["open"] = getOpenConnections();
+    out["requests"] = requests;
+    out["keepAliveReuses"] = keepAliveReuses;
+    out["rejected"] = rejected;
+    out["deferred"] = deferredCount;
+    out["deferredTimeouts"] = deferredTimeouts;
+    out["maxHandlerUs"] = maxHandlerUs;
+    out["streamed"] = streamed;
+    out["lastTtfbUs"] = lastTtfbUs;
+    out["maxTtfbUs"] = maxTtfbUs;
+    out["eventStreams"] = getEventStreamCount();
+    out["eventsSent"] = eventsSent;
+}
+
+HTTPMethod EventWebServer::parseMethod(const String& name) {
+    if (name == "GET") return HTTP_GET;
+    if (name == "POST") return HTTP_POST;
+    if (name == "PUT") return HTTP_PUT;
+    if (name == "PATCH") return HTTP_PATCH;
+    if (name == "DELETE") return HTTP_DELETE;
+    if (name == "OPTIONS") return HTTP_OPTIONS;
+    if (name == "HEAD") return HTTP_HEAD;
+    return HTTP_ANY;  // Unsupported
+}
+
+String EventWebServer::urlDecode(const String& text) {
+    String decoded;
+    decoded.reserve(text.length());
+    for (size_t i = 0; i < text.length(); i++) {
+        char c = text[i];
+        if (c == '+') {
+            decoded += ' ';
+        } else if (c == '%' && i + 2 < text.length()) {
+            char hex[3] = {text[i + 1], text[i + 2], 0};
+            decoded += (char)strtol(hex, nullptr, 16);
+            i += 2;
+        } else {
+            decoded += c;
+        }
+    }
+    return decoded;
+}
+
+const char* EventWebServer::statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 401: return "Unauthorized";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 408: return "Request Timeout";
+        case 409: return "Conflict";
+        case 411: return "Length Required";
+        case 413: return "Payload Too Large";
+        case 429: return "Too Many Requests";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        case 504: return "Gateway Timeout";
+        default: return "";
+    }
+}
@@ -0,0 +1,113 @@
+#include "fetch_stats.h"
+
+static const char* PHASE_NAMES[PHASE_COUNT] = {"dns", "connect", "firstByte", "body", "parse"};
+
+void PhaseHistogram::add(uint32_t us) {
+    uint8_t bucket = 0;
+    uint32_t v = us;
+    while (v > 1 && bucket < STATS_BUCKETS - 1) {
+        v >>= 1;
+        bucket++;
+    }
+    if (buckets[bucket] < 0xFFFF) {
+        buckets[bucket]++;
+    }
+    count++;
+    if (us > maxUs) maxUs = us;
+}
+
+uint32_t PhaseHistogram::percentile(uint8_t pct) {
+    if (count == 0) return 0;
+
+    // Bucket counts saturate, so rank against their own total
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < STATS_BUCKETS; i++) total += buckets[i];
+
+    uint32_t rank = (total * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < STATS_BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            uint32_t upper = (1UL << (i + 1)) - 1;
+            return min(upper, maxUs);
+        }
+    }
+    return maxUs;
+}
+
+const char* FetchStats::phaseName(uint8_t phase) {
+    return phase < PHASE_COUNT ? PHASE_NAMES[phase] : "?";
+}
+
+void FetchStats::record(const String& moduleId, const FetchTrace& trace) {
+    ModuleFetchStats& stats = modules[moduleId];
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+        if (trace.us[i] > 0) {
+            stats.phases[i].add(trace.us[i]);
+        }
+    }
+
+    stats.wireBytes += trace.wireBytes;
+    stats.bodyBytes += trace.bodyBytes;
+    stats.inflateUs += trace.inflateUs;
+    if (trace.bodyBytes > trace.wireBytes) {
+        stats.compressedFetches++;
+    }
+}
+
+void FetchStats::forget(const String& moduleId) {
+    modules.erase(moduleId);
+}
+
+void FetchStats::reset() {
+    modules.clear();
+}
+
+void FetchStats::toJson(JsonObject out) {
+    for (auto& pair : modules) {
+        JsonObject module = out.createNestedObject(pair.first);
+        for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+            PhaseHistogram& h = pair.second.phases[i];
+            JsonObject phase = module.createNestedObject(PHASE_NAMES[i]);
+            phase["count"] = h.count;
+            phase["p50"] = h.percentile(50);
+            phase["p95"] = h.percentile(95);
+            phase["max"] = h.maxUs;
+        }
+
+        JsonObject bytes = module.createNestedObject("bytes");
+        bytes["wire"] = pair.second.wireBytes;
+        bytes["decoded"] = pair.second.bodyBytes;
+        bytes["saved"] = pair.second.bodyBytes > pair.second.wireBytes
+                             ? pair.second.bodyBytes - pair.second.wireBytes : 0;
+        bytes["compressedFetches"] = pair.second.compressedFetches;
+        bytes["inflateUs"] = pair.second.inflateUs;
+    }
+}
+
+void FetchStats::print() {
+    if (modules.empty()) {
+        Serial.println("No fetches recorded yet");
+        return;
+    }
+
+    // Times in milliseconds for readability (stored in microseconds)
+    for (auto& pair : modules) {
+        Serial.println(pair.first + ":");
+        for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+            PhaseHistogram& h = pair.second.phases[i];
+            if (h.count == 0) continue;
+
+            Serial.printf("  %-10s n=%-5u p50=%8.1fms p95=%8.1fms max=%8.1fms\n",
+                          PHASE_NAMES[i], (unsigned)h.count,
+                          h.percentile(50) / 1000.0f, h.percentile(95) / 1000.0f, h.maxUs / 1000.0f);
+        }
+
+        ModuleFetchStats& stats = pair.second;
+        if (stats.bodyBytes > 0) {
+            Serial.printf("  bytes      wire=%u decoded=%u (%u compressed fetches, inflate %.1fms total)\n",
+                          (unsigned)stats.wireBytes, (unsigned)stats.bodyBytes,
+                          (unsigned)stats.compressedFetches, stats.inflateUs / 1000.0f);
+        }
+    }
+}
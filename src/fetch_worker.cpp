@@ -0,0 +1,107 @@
+#include "fetch_worker.h"
+#include "network.h"
+
+// External network manager (initialized in main)
+extern NetworkManager network;
+
+FetchWorker::FetchWorker()
+    : jobQueue(nullptr), resultQueue(nullptr), task(nullptr), pending(0) {
+}
+
+bool FetchWorker::init() {
+    if (task) return true;  // Already running
+
+    jobQueue = xQueueCreate(FETCH_QUEUE_LENGTH, sizeof(Job*));
+    // One extra slot for the job the worker is holding, so sends never block
+    resultQueue = xQueueCreate(FETCH_QUEUE_LENGTH + 1, sizeof(Job*));
+    if (!jobQueue || !resultQueue) {
+        Serial.println("ERROR: Fetch worker queue allocation failed");
+        return false;
+    }
+
+    if (xTaskCreate(taskMain, "fetchWorker", FETCH_WORKER_STACK, this,
+                    FETCH_WORKER_PRIORITY, &task) != pdPASS) {
+        Serial.println("ERROR: Fetch worker task creation failed");
+        task = nullptr;
+        return false;
+    }
+
+    Serial.println("Fetch worker started");
+    return true;
+}
+
+bool FetchWorker::submit(FetchRequest&& request, FetchCallback onComplete) {
+    if (!jobQueue) {
+        return false;
+    }
+
+    Job* job = new Job();
+    if (!job) {
+        return false;
+    }
+    job->request = std::move(request);
+    job->result.success = false;
+    job->result.httpCode = 0;
+    job->result.durationMs = 0;
+    job->result.doc = nullptr;
+    job->onComplete = onComplete;
+
+    if (xQueueSend(jobQueue, &job, 0) != pdTRUE) {
+        Serial.println("Fetch worker queue full, request dropped");
+        delete job;
+        return false;
+    }
+
+    pending++;
+    return true;
+}
+
+void FetchWorker::dispatchResults() {
+    if (!resultQueue) return;
+
+    Job* job = nullptr;
+    while (xQueueReceive(resultQueue, &job, 0) == pdTRUE) {
+        pending--;
+        if (job->onComplete) {
+            job->onComplete(job->result);
+        }
+        delete job;
+    }
+}
+
+void FetchWorker::taskMain(void* param) {
+    FetchWorker* self = static_cast<FetchWorker*>(param);
+    Job* job = nullptr;
+
+    for (;;) {
+        // Wake up now and then to close kept-alive connections the servers have dropped
+        if (xQueueReceive(self->jobQueue, &job, pdMS_TO_TICKS(FETCH_IDLE_CHECK_MS)) != pdTRUE) {
+            network.getConnectionPool().closeIdle();
+            continue;
+        }
+
+        // Blocking HTTPS request - only this task waits on the network
+        FetchResult& result = job->result;
+        unsigned long start = millis();
+        if (job->request.docCapacity > 0) {
+            // Parse while reading - the body never sits in RAM as a whole
+            result.doc = new DynamicJsonDocument(job->request.docCapacity);
+            if (!result.doc || result.doc->capacity() == 0) {
+                result.success = false;
+                result.errorMsg = "Out of memory";
+            } else {
+                result.success = network.httpGetJson(job->request, *result.doc, result.errorMsg,
+                                                     &result.httpCode, &result.trace);
+            }
+        } else if (job->request.withHeaders) {
+            result.success = network.httpGetWithHeaders(job->request.url.c_str(), result.body,
+                                                        result.errorMsg, &result.httpCode, &result.trace);
+        } else {
+            result.success = network.httpGet(job->request.url.c_str(), result.body,
+                                             result.errorMsg, &result.httpCode, &result.trace);
+        }
+        result.durationMs = millis() - start;
+
+        xQueueSend(self->resultQueue, &job, portMAX_DELAY);
+    }
+}
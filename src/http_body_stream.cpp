@@ -0,0 +1,126 @@
+#include "http_body_stream.h"
+
+HttpBodyStream::HttpBodyStream(Stream& in, long contentLength, bool chunked)
+    : in(in), remaining(contentLength), chunked(chunked), chunkLeft(0), done(false),
+      bytesRead(0), bufferLen(0), bufferPos(0) {
+    // Underlying reads are already timed; don't add a second wait on top
+    setTimeout(0);
+}
+
+void HttpBodyStream::readLine(char* line, size_t size) {
+    size_t len = 0;
+    char c;
+    while (in.readBytes(&c, 1) == 1 && c != '\n') {
+        if (c != '\r' && len < size - 1) {
+            line[len++] = c;
+        }
+    }
+    line[len] = '\0';
+}
+
+bool HttpBodyStream::readChunkHeader() {
+    // "<hex size>[;extensions]\r\n"
+    char line[24];
+    readLine(line, sizeof(line));
+    if (line[0] == '\0') {
+        return false;
+    }
+
+    chunkLeft = strtol(line, nullptr, 16);
+    if (chunkLeft <= 0) {
+        // Last chunk: skip trailer headers up to the blank line
+        do {
+            readLine(line, sizeof(line));
+        } while (line[0] != '\0');
+        return false;
+    }
+    return true;
+}
+
+bool HttpBodyStream::fill() {
+    bufferPos = 0;
+    bufferLen = 0;
+    if (done) return false;
+
+    size_t want = BODY_STREAM_BUFFER;
+    if (chunked) {
+        if (chunkLeft == 0 && !readChunkHeader()) {
+            done = true;
+            return false;
+        }
+        want = min(want, (size_t)chunkLeft);
+    } else if (remaining >= 0) {
+        if (remaining == 0) {
+            done = true;
+            return false;
+        }
+        want = min(want, (size_t)remaining);
+    } else {
+        // No length: read what's there (at least one byte, waits for more or close)
+        int avail = in.available();
+        want = constrain(avail, 1, (int)BODY_STREAM_BUFFER);
+    }
+
+    size_t got = in.readBytes(buffer, want);
+    if (got == 0) {
+        done = true;  // Timeout or connection closed
+        return false;
+    }
+    bufferLen = got;
+    bytesRead += got;
+
+    if (chunked) {
+        chunkLeft -= got;
+        if (chunkLeft == 0) {
+            char crlf[2];
+            in.readBytes(crlf, 2);
+        }
+    } else if (remaining > 0) {
+        remaining -= got;
+    }
+    return true;
+}
+
+int HttpBodyStream::available() {
+    if (bufferPos < bufferLen) return bufferLen - bufferPos;
+    return done ? 0 : max(in.available(), 0);
+}
+
+int HttpBodyStream::read() {
+    if (bufferPos >= bufferLen && !fill()) {
+        return -1;
+    }
+    return buffer[bufferPos++];
+}
+
+int HttpBodyStream::peek() {
+    if (bufferPos >= bufferLen && !fill()) {
+        return -1;
+    }
+    return buffer[bufferPos];
+}
+
+size_t HttpBodyStream::readBytes(char* out, size_t length) {
+    size_t n = 0;
+    while (n < length) {
+        if (bufferPos >= bufferLen && !fill()) {
+            break;
+        }
+        size_t take = min(length - n, bufferLen - bufferPos);
+        memcpy(out + n, buffer + bufferPos, take);
+        bufferPos += take;
+        n += take;
+    }
+    return n;
+}
+
+void HttpBodyStream::drain() {
+    bufferPos = bufferLen;
+    if (!chunked && remaining < 0) {
+        done = true;  // Body ends at close - the connection can't be reused anyway
+        return;
+    }
+    while (fill()) {
+        bufferPos = bufferLen;
+    }
+}
@@ -0,0 +1,145 @@
+#include "http_cache.h"
+
+// Freshness lifetime in ms from a lowercased Cache-Control and Age (0 = revalidate every time)
+static unsigned long freshnessFrom(const String& cc, const String& age) {
+    if (cc.indexOf("no-cache") >= 0 || cc.indexOf("no-store") >= 0) {
+        return 0;
+    }
+
+    int idx = cc.indexOf("max-age=");
+    if (idx < 0) {
+        return 0;
+    }
+    long maxAge = cc.substring(idx + 8).toInt();
+    long used = age.toInt();
+    return maxAge > used ? (unsigned long)(maxAge - used) * 1000UL : 0;
+}
+
+HttpCache::HttpCache()
+    : freshHits(0), revalidated(0), misses(0), uncacheable(0) {
+    for (uint8_t i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+        entries[i].storedAt = 0;
+        entries[i].freshFor = 0;
+        entries[i].lastUsed = 0;
+        entries[i].hits = 0;
+    }
+    lock = xSemaphoreCreateMutex();
+}
+
+HttpCache::Entry* HttpCache::find(const String& url) {
+    for (uint8_t i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+        if (entries[i].url.length() > 0 && entries[i].url == url) {
+            return &entries[i];
+        }
+    }
+    return nullptr;
+}
+
+bool HttpCache::isFresh(const String& url) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Entry* entry = find(url);
+    bool fresh = entry && entry->freshFor > 0 && (millis() - entry->storedAt) < entry->freshFor;
+    if (fresh) {
+        entry->hits++;
+        entry->lastUsed = millis();
+        freshHits++;
+    }
+    xSemaphoreGive(lock);
+    return fresh;
+}
+
+void HttpCache::getValidators(const String& url, String& etag, String& lastModified) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Entry* entry = find(url);
+    if (entry) {
+        etag = entry->etag;
+        lastModified = entry->lastModified;
+    }
+    xSemaphoreGive(lock);
+}
+
+void HttpCache::storeResponse(const String& url, const String& etag, const String& lastModified,
+                              const String& cacheControl, const String& age) {
+    // Directives are case-insensitive (RFC 9111 5.2)
+    String cc = cacheControl;
+    cc.toLowerCase();
+    unsigned long freshFor = freshnessFrom(cc, age);
+    bool noStore = cc.indexOf("no-store") >= 0;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    misses++;
+
+    Entry* entry = find(url);
+    if (noStore || (etag.length() == 0 && lastModified.length() == 0 && freshFor == 0)) {
+        // Nothing to reuse next time
+        uncacheable++;
+        if (entry) entry->url = "";
+        xSemaphoreGive(lock);
+        return;
+    }
+
+    if (!entry) {
+        // Empty slot, otherwise the least recently used
+        entry = &entries[0];
+        for (uint8_t i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+            if (entries[i].url.length() == 0) {
+                entry = &entries[i];
+                break;
+            }
+            if (entries[i].lastUsed < entry->lastUsed) {
+                entry = &entries[i];
+            }
+        }
+        entry->url = url;
+        entry->hits = 0;
+    }
+
+    entry->etag = etag;
+    entry->lastModified = lastModified;
+    entry->storedAt = millis();
+    entry->lastUsed = entry->storedAt;
+    entry->freshFor = freshFor;
+    xSemaphoreGive(lock);
+}
+
+void HttpCache::recordNotModified(const String& url, const String& cacheControl, const String& age) {
+    String cc = cacheControl;
+    cc.toLowerCase();
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    revalidated++;
+    Entry* entry = find(url);
+    if (entry) {
+        // A 304 renews freshness like a full response would
+        entry->hits++;
+        entry->storedAt = millis();
+        entry->lastUsed = entry->storedAt;
+        entry->freshFor = freshnessFrom(cc, age);
+    }
+    xSemaphoreGive(lock);
+}
+
+void HttpCache::toJson(JsonObject out) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t lookups = freshHits + revalidated + misses;
+    out["freshHits"] = freshHits;
+    out["revalidated"] = revalidated;
+    out["misses"] = misses;
+    out["uncacheable"] = uncacheable;
+    out["hitRate"] = lookups ? (float)(freshHits + revalidated) / lookups : 0.0f;
+
+    JsonArray list = out.createNestedArray("entries");
+    for (uint8_t i = 0; i < HTTP_CACHE_ENTRIES; i++) {
+        Entry& entry = entries[i];
+        if (entry.url.length() == 0) continue;
+
+        JsonObject item = list.createNestedObject();
+        item["url"] = entry.url;
+        item["etag"] = entry.etag;
+        item["lastModified"] = entry.lastModified;
+        unsigned long age = millis() - entry.storedAt;
+        item["freshFor"] = entry.freshFor > age ? (entry.freshFor - age) / 1000 : 0;
+        item["hits"] = entry.hits;
+    }
+    xSemaphoreGive(lock);
+}
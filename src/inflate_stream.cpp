@@ -0,0 +1,137 @@
+#include "inflate_stream.h"
+
+InflateStream::InflateStream(Stream& in, Format format)
+    : in(in), format(format), decomp(nullptr), window(nullptr), inputLen(0), inputPos(0),
+      inputDone(false), flags(0), windowOfs(0), outPos(0), outEnd(0), started(false),
+      finished(false), failed(false), bytesOut(0), inflateUs(0) {
+    setTimeout(0);  // Source reads are already timed
+}
+
+InflateStream::~InflateStream() {
+    free(decomp);
+    free(window);
+}
+
+bool InflateStream::skipGzipHeader() {
+    // RFC 1952: magic, method, flags, mtime, xfl, os - then optional fields
+    uint8_t header[10];
+    if (in.readBytes((char*)header, sizeof(header)) != sizeof(header) ||
+        header[0] != 0x1F || header[1] != 0x8B || header[2] != 8) {
+        return false;
+    }
+
+    uint8_t gzFlags = header[3];
+    if (gzFlags & 0x04) {  // FEXTRA
+        uint8_t len[2];
+        if (in.readBytes((char*)len, 2) != 2) return false;
+        for (uint16_t i = 0; i < (len[0] | (len[1] << 8)); i++) {
+            if (in.read() < 0) return false;
+        }
+    }
+    for (uint8_t bit = 0x08; bit <= 0x10; bit <<= 1) {  // FNAME, FCOMMENT (zero-terminated)
+        if (gzFlags & bit) {
+            int c;
+            while ((c = in.read()) > 0) {}
+            if (c < 0) return false;
+        }
+    }
+    if (gzFlags & 0x02) {  // FHCRC
+        in.read();
+        in.read();
+    }
+    return true;
+}
+
+bool InflateStream::begin() {
+    started = true;
+
+    decomp = (tinfl_decompressor*)malloc(sizeof(tinfl_decompressor));
+    window = (uint8_t*)malloc(TINFL_LZ_DICT_SIZE);
+    if (!decomp || !window) {
+        return false;
+    }
+    tinfl_init(decomp);
+
+    if (format == GZIP) {
+        return skipGzipHeader();  // Raw deflate follows; the CRC/size trailer is left for drain()
+    }
+
+    // HTTP "deflate" is meant to be zlib-wrapped, but some servers send raw deflate
+    inputLen = in.readBytes((char*)input, 2);
+    if (inputLen == 2 && (input[0] & 0x0F) == 8 && ((input[0] << 8) | input[1]) % 31 == 0) {
+        flags |= TINFL_FLAG_PARSE_ZLIB_HEADER;
+    }
+    return true;
+}
+
+bool InflateStream::produce() {
+    if (!started && !begin()) {
+        failed = true;
+        return false;
+    }
+
+    while (!finished && !failed) {
+        if (inputPos >= inputLen && !inputDone) {
+            inputLen = in.readBytes((char*)input, sizeof(input));
+            inputPos = 0;
+            inputDone = inputLen < sizeof(input);
+        }
+
+        size_t inAvail = inputLen - inputPos;
+        size_t outAvail = TINFL_LZ_DICT_SIZE - windowOfs;
+        uint32_t start = micros();
+        tinfl_status status = tinfl_decompress(decomp, input + inputPos, &inAvail, window, window + windowOfs,
+                                               &outAvail, flags | (inputDone ? 0 : TINFL_FLAG_HAS_MORE_INPUT));
+        inflateUs += micros() - start;
+        inputPos += inAvail;
+
+        if (status < TINFL_STATUS_DONE) {
+            failed = true;
+        } else if (status == TINFL_STATUS_DONE) {
+            finished = true;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && inputDone && inputPos >= inputLen) {
+            failed = true;  // Body ended mid-stream
+        }
+
+        if (outAvail > 0) {
+            outPos = windowOfs;
+            outEnd = windowOfs + outAvail;
+            windowOfs = (windowOfs + outAvail) & (TINFL_LZ_DICT_SIZE - 1);
+            bytesOut += outAvail;
+            return true;
+        }
+    }
+    return false;
+}
+
+int InflateStream::available() {
+    return outEnd - outPos;
+}
+
+int InflateStream::read() {
+    if (outPos >= outEnd && !produce()) {
+        return -1;
+    }
+    return window[outPos++];
+}
+
+int InflateStream::peek() {
+    if (outPos >= outEnd && !produce()) {
+        return -1;
+    }
+    return window[outPos];
+}
+
+size_t InflateStream::readBytes(char* buffer, size_t length) {
+    size_t n = 0;
+    while (n < length) {
+        if (outPos >= outEnd && !produce()) {
+            break;
+        }
+        size_t take = min(length - n, outEnd - outPos);
+        memcpy(buffer + n, window + outPos, take);
+        outPos += take;
+        n += take;
+    }
+    return n;
+}
@@ -5,6 +5,12 @@
 #include "scheduler.h"
 #include "button.h"
 #include "security.h"
+#include "fetch_worker.h"
+#include "time_sync.h"
+#include "fetch_stats.h"
+#include "event_bus.h"
+#include "readings_store.h"
+#include "config_journal.h"
 #include "modules/module_interface.h"
 #include "module_factory.h"
 
@@ -13,6 +19,11 @@ DisplayManager display;
 NetworkManager network;
 Scheduler scheduler;
 SecurityManager security;
+FetchWorker fetchWorker;
+FetchStats fetchStats;
+EventBus eventBus;
+ReadingsStore readings;
+ConfigJournal configJournal;
 
 #ifdef ENABLE_BUTTON
 ButtonHandler button(BUTTON_PIN);
@@ -53,9 +64,14 @@ void setup() {
             delay(1000);
         }
     }
+    configJournal.init();  // Config writes leave the loop task from here on
 
-    // Load configuration
+    // Load configuration, then the last readings (kept in their own file)
     loadConfiguration();
+    readings.load();
+    if (readings.migrateFromConfig(config["modules"]) > 0) {
+        saveConfiguration(true);  // One-time: the config no longer carries readings
+    }
 
     // Initialize display
     display.init();
@@ -99,24 +115,22 @@ void setup() {
             // Start settings web server (always available on local network)
             network.startSettingsServer();
 
+            // Wall-clock time for persisted timestamps (cache survives reboots)
+            initTimeSync();
+
+            // Start fetch worker (HTTP requests run off the loop task)
+            fetchWorker.init();
+
             // Initialize scheduler and load modules dynamically from config
             Serial.println("\n=== Initializing Scheduler ===");
             scheduler.init();
             scheduler.loadModulesFromConfig();
 
-            // TEMPORARY DEBUG: Always fetch stock at startup to verify it works
-            Serial.println("\n*** TEMPORARY DEBUG: Force-fetching STOCK module at startup ***");
-            scheduler.requestFetch("stock", true);
-            delay(2000);
-            Serial.println("*** DEBUG: Check if stock lastUpdate changed ***\n");
-
-            // Force initial fetch of active module
+            // No forced fetch here: the scheduler starts after a random offset so a
+            // fleet rebooting together (power blip) doesn't hit the APIs in lockstep
             String activeModule = config["device"]["activeModule"] | "bitcoin";
             Serial.print("Active module: ");
             Serial.println(activeModule);
-            Serial.println("Requesting forced fetch at startup...");
-            scheduler.requestFetch(activeModule.c_str(), true);
-            Serial.println("Startup fetch requested");
         } else {
             Serial.println("WiFi connection failed");
             Serial.println("Starting configuration AP mode...");
@@ -201,17 +215,23 @@ void loop() {
 
     // No auto-timeout - manual exit only with long press
 
-    // Monitor WiFi connection
-    if (!network.isConnected()) {
-        network.reconnect();
-    }
+    // Monitor WiFi connection (link events, reconnect backoff)
+    network.maintainConnection();
 
     // Handle settings web server requests (in normal operation mode)
     network.handleClient();
 
-    // Run scheduler (fetch data if needed)
+    // First SNTP sync: stamps taken so far get converted to wall-clock time
+    checkTimeSync();
+
+    // Hand finished fetches back to their modules, then schedule new ones
+    fetchWorker.dispatchResults();
     scheduler.tick();
 
+    // Write-behind config saves, and an occasional snapshot so readings survive a reboot
+    maintainConfiguration();
+    readings.maybeSave();
+
     // Update display
     if (brightnessMode) {
         // In brightness mode: keep showing brightness screen (no need to update frequently)
@@ -346,7 +366,7 @@ void cycleToNextModule() {
         scheduler.requestFetch(nextModule.c_str(), false);
     }
 
-    // Save active module to config (throttled)
+    // Save active module to config (written behind, coalesced with further presses)
     saveConfiguration();
 }
 
@@ -370,6 +390,12 @@ void handleSerialCommand() {
         Serial.println("restart   - Reboot device");
         Serial.println("modules   - List available modules");
         Serial.println("switch    - Switch to next module");
+        Serial.println("schedule  - Show background refresh queue and data age");
+        Serial.println("limits    - Show per-host API rate limit buckets");
+        Serial.println("stats     - Show fetch phase timings per module");
+        Serial.println("pool      - Show HTTPS connection reuse");
+        Serial.println("httpcache - Show HTTP validator cache and hit rates");
+        Serial.println("storage   - Show config journal and readings snapshot writes");
         Serial.println("button    - Toggle button debug mode (shows on display)");
         Serial.println("==========================\n");
     }
@@ -389,9 +415,31 @@ void handleSerialCommand() {
             Serial.print("RSSI: ");
             Serial.print(WiFi.RSSI());
             Serial.println(" dBm");
+            Serial.print("BSSID: ");
+            Serial.print(WiFi.BSSIDstr());
+            Serial.print(" (channel ");
+            Serial.print(WiFi.channel());
+            Serial.println(")");
         } else {
             Serial.println("Status: DISCONNECTED");
         }
+        const WiFiConnectStats& stats = network.getWiFiStats();
+        Serial.print("Last associate: ");
+        Serial.print(stats.lastAssociateMs);
+        Serial.println(stats.lastFastPath ? "ms (cached AP)" : "ms (scan)");
+        Serial.print("Cached AP connects: ");
+        Serial.print(stats.fastConnects);
+        Serial.print(", fallbacks: ");
+        Serial.print(stats.fastFallbacks);
+        Serial.print(", scan connects: ");
+        Serial.println(stats.fullConnects);
+        Serial.print("Link drops: ");
+        Serial.print(stats.linkDrops);
+        Serial.print(", reconnect attempts: ");
+        Serial.print(stats.reconnectAttempts);
+        Serial.print(", last outage: ");
+        Serial.print(stats.lastOutageMs);
+        Serial.println("ms");
         Serial.println("===================\n");
     }
     else if (cmd == "fetch") {
@@ -416,12 +464,15 @@ void handleSerialCommand() {
         Serial.println("Press Ctrl+C to cancel\n");
         delay(3000);
         Serial.println("Formatting filesystem...");
+        configJournal.stop();  // A queued config write must not land after the format
         LittleFS.format();
         Serial.println("Restarting...");
         ESP.restart();
     }
     else if (cmd == "restart") {
         Serial.println("\nRestarting device...\n");
+        flushConfiguration();
+        readings.save();
         delay(500);
         ESP.restart();
     }
@@ -438,6 +489,42 @@ void handleSerialCommand() {
     else if (cmd == "switch") {
         cycleToNextModule();
     }
+    else if (cmd == "schedule") {
+        Serial.println("\n=== Refresh Schedule ===");
+        scheduler.printRefreshQueue();
+        Serial.println("========================\n");
+    }
+    else if (cmd == "stats") {
+        Serial.println("\n=== Fetch Timings ===");
+        fetchStats.print();
+        Serial.println("=====================\n");
+    }
+    else if (cmd == "pool") {
+        Serial.println("\n=== Connection Pool ===");
+        network.getConnectionPool().print();
+        Serial.println("=======================\n");
+    }
+    else if (cmd == "httpcache") {
+        Serial.println("\n=== HTTP Cache ===");
+        StaticJsonDocument<3072> doc;
+        network.getHttpCache().toJson(doc.to<JsonObject>());
+        serializeJsonPretty(doc, Serial);
+        Serial.println("\n==================\n");
+    }
+    else if (cmd == "storage") {
+        Serial.println("\n=== Storage ===");
+        StaticJsonDocument<384> doc;
+        configJournal.toJson(doc.createNestedObject("config"));
+        doc["readings"]["modules"] = readings.getCount();
+        doc["readings"]["snapshots"] = readings.getSnapshotCount();
+        serializeJsonPretty(doc, Serial);
+        Serial.println("\n===============\n");
+    }
+    else if (cmd == "limits") {
+        Serial.println("\n=== Host Rate Limits ===");
+        scheduler.printHostLimits();
+        Serial.println("========================\n");
+    }
     else if (cmd == "button") {
         if (buttonDebugMode) {
             // Disable debug mode
@@ -2,11 +2,56 @@
 #include "config.h"
 #include "network.h"
 #include "security.h"
+#include "time_sync.h"
+#include "readings_store.h"
 #include <ArduinoJson.h>
 
 // External references
 extern NetworkManager network;
 extern StaticJsonDocument<8192> config;
+extern ReadingsStore readings;
+
+// Extra bytes on top of a computed filter size (allocator alignment, rounding)
+#define FILTER_SLACK 64
+// Extra bytes on top of a computed response capacity: the parser keeps a
+// scratch copy of each key it skips, and Yahoo's meta keys run to ~30 chars
+#define DOC_SLACK 128
+
+// Blocking fetch for network modules - same request/parse path the scheduler
+// runs through the fetch worker (only for callers that can afford to wait)
+static bool fetchBlocking(ModuleInterface* module, String& errorMsg) {
+    FetchRequest request;
+    if (!module->prepareRequest(request, errorMsg)) {
+        return false;
+    }
+
+    if (request.docCapacity > 0) {
+        DynamicJsonDocument doc(request.docCapacity);
+        if (doc.capacity() == 0) {
+            errorMsg = "Out of memory";
+            return false;
+        }
+        int httpCode = 0;
+        if (!network.httpGetJson(request, doc, errorMsg, &httpCode)) {
+            return false;
+        }
+        if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+            readings.setLastUpdate(module->id, nowSeconds());  // Cached values still current
+            return true;
+        }
+        return module->handleDocument(doc, errorMsg);
+    }
+
+    String response;
+    bool ok = request.withHeaders
+        ? network.httpGetWithHeaders(request.url.c_str(), response, errorMsg)
+        : network.httpGet(request.url.c_str(), response, errorMsg);
+    if (!ok) {
+        return false;
+    }
+
+    return module->handleResponse(response, errorMsg);
+}
 
 // ============================================================================
 // Generic Crypto Module (supports any CoinGecko coin)
@@ -14,6 +59,9 @@ extern StaticJsonDocument<8192> config;
 class GenericCryptoModule : public ModuleInterface {
 private:
     String moduleId;  // Unique instance ID
+    int slot;         // Readings store slot
+    String requestedId;        // cryptoId of the request in flight
+    String requestedCurrency;  // Lowercase currency of the request in flight
 
 public:
     GenericCryptoModule(const char* id, JsonObject cfg) {
@@ -22,47 +70,103 @@ public:
         displayName = "Crypto";
         defaultRefreshInterval = 300;  // 5 minutes
         minRefreshInterval = 60;       // 1 minute
+        slot = readings.declare(id, READING_VALUE | READING_CHANGE24H);
     }
 
     bool fetch(String& errorMsg) override {
-        // Get configured crypto ID
-        JsonObject moduleData = config["modules"][moduleId];
-        String cryptoId = moduleData["cryptoId"] | "bitcoin";
+        return fetchBlocking(this, errorMsg);
+    }
+
+    // All crypto modules share CoinGecko's multi-id simple/price endpoint
+    const char* batchGroup() override { return "coingecko"; }
+    const char* upstreamHost() override { return "api.coingecko.com"; }
+
+    bool prepareRequest(FetchRequest& request, String& errorMsg) override {
+        std::vector<ModuleInterface*> members(1, this);
+        return prepareBatchRequest(members, request, errorMsg);
+    }
+
+    bool handleDocument(JsonDocument& doc, String& errorMsg) override {
+        std::vector<ModuleInterface*> members(1, this);
+        std::vector<String> errors(1);
+        handleBatchDocument(doc, members, errors);
+        errorMsg = errors[0];
+        return errorMsg.length() == 0;
+    }
 
-        // Get currency (default USD)
+    bool prepareBatchRequest(const std::vector<ModuleInterface*>& members, FetchRequest& request, String& errorMsg) override {
+        // Get currency (default USD) - shared by every crypto module
         String currency = config["device"]["currency"] | "USD";
         currency.toLowerCase();
 
-        // Build URL with configured crypto and currency
-        String url = "https://api.coingecko.com/api/v3/simple/price?ids=" + cryptoId +
+        // Comma-separated list of unique coin ids for the whole batch
+        String ids;
+        for (ModuleInterface* m : members) {
+            GenericCryptoModule* member = static_cast<GenericCryptoModule*>(m);
+            JsonObject moduleData = config["modules"][member->moduleId];
+            member->requestedId = moduleData["cryptoId"] | "bitcoin";
+            member->requestedCurrency = currency;
+
+            if (("," + ids + ",").indexOf("," + member->requestedId + ",") < 0) {
+                if (ids.length() > 0) ids += ",";
+                ids += member->requestedId;
+            }
+        }
+
+        // Build URL with configured cryptos and currency
+        String url = "https://api.coingecko.com/api/v3/simple/price?ids=" + ids +
                      "&vs_currencies=" + currency + "&include_24hr_change=true";
 
         Serial.print("Crypto fetch: ");
-        Serial.print(moduleId);
-        Serial.print(" (");
-        Serial.print(cryptoId);
+        Serial.print(members.size());
+        Serial.print(" module(s) (");
+        Serial.print(ids);
         Serial.print("/");
         String currUpper = currency;
         currUpper.toUpperCase();
         Serial.print(currUpper);
         Serial.println(")");
 
-        String response;
-        if (!network.httpGet(url.c_str(), response, errorMsg)) {
+        // Parsed on the worker (~100 bytes per coin), keeping only price and change.
+        // The filter is sized for this batch: ten long coin ids overflow the default
+        String changeKey = currency + "_24h_change";
+        size_t filterSize = JSON_OBJECT_SIZE(members.size()) + FILTER_SLACK;
+        for (ModuleInterface* m : members) {
+            GenericCryptoModule* member = static_cast<GenericCryptoModule*>(m);
+            filterSize += JSON_OBJECT_SIZE(2) + member->requestedId.length() + 1 +
+                          currency.length() + 1 + changeKey.length() + 1;
+        }
+        JsonDocument& filter = request.newFilter(filterSize);
+
+        for (ModuleInterface* m : members) {
+            GenericCryptoModule* member = static_cast<GenericCryptoModule*>(m);
+            JsonObject coin = filter[member->requestedId].to<JsonObject>();
+            coin[currency] = true;
+            coin[changeKey] = true;
+        }
+
+        // A clipped filter would silently drop coins from the response
+        if (filter.overflowed()) {
+            errorMsg = "Request filter too large";
             return false;
         }
 
-        return parseResponse(response, errorMsg, cryptoId, currency);
+        request.url = url;
+        request.docCapacity = 128 * MAX_BATCH_SIZE;
+        return true;
     }
 
-    bool parseResponse(String payload, String& errorMsg, String cryptoId, String currency) {
-        StaticJsonDocument<512> doc;
-        DeserializationError error = deserializeJson(doc, payload);
-
-        if (error) {
-            errorMsg = "JSON parse error: " + String(error.c_str());
-            return false;
+    void handleBatchDocument(JsonDocument& doc, const std::vector<ModuleInterface*>& members, std::vector<String>& errors) override {
+        // Parsed once, fan results out to each module
+        for (size_t i = 0; i < members.size(); i++) {
+            GenericCryptoModule* member = static_cast<GenericCryptoModule*>(members[i]);
+            member->applyQuote(doc.as<JsonObject>(), errors[i]);
         }
+    }
+
+    bool applyQuote(JsonObject doc, String& errorMsg) {
+        const String& cryptoId = requestedId;
+        const String& currency = requestedCurrency;
 
         if (!doc.containsKey(cryptoId)) {
             errorMsg = "Invalid response structure";
@@ -79,14 +183,17 @@ public:
         String changeKey = currency + "_24h_change";
         float change = doc[cryptoId][changeKey] | 0.0;
 
-        // Update cache
-        JsonObject data = config["modules"][moduleId];
-        data["value"] = price;
-        data["change24h"] = change;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        ModuleReading* reading = readings.edit(slot);
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->value = price;
+        reading->change = change;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
-        String cryptoName = data["cryptoName"] | cryptoId;
+        String cryptoName = config["modules"][moduleId]["cryptoName"] | cryptoId;
         Serial.print(cryptoName);
         Serial.print(" price: ");
         Serial.print(getCurrencySymbol(currency.c_str()));
@@ -99,9 +206,9 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"][moduleId];
-        float price = data["value"] | 0.0;
-        float change = data["change24h"] | 0.0;
+        const ModuleReading& reading = readings.read(id);
+        float price = reading.value;
+        float change = reading.change;
         String currency = config["device"]["currency"] | "USD";
 
         char buffer[64];
@@ -137,6 +244,8 @@ private:
 class GenericStockModule : public ModuleInterface {
 private:
     String moduleId;
+    int slot;                // Readings store slot
+    String requestedTicker;  // Uppercase ticker of the request in flight
 
 public:
     GenericStockModule(const char* id, JsonObject cfg) {
@@ -145,65 +254,118 @@ public:
         displayName = "Stock";
         defaultRefreshInterval = 300;  // 5 minutes
         minRefreshInterval = 60;       // 1 minute
+        slot = readings.declare(id, READING_VALUE | READING_CHANGE);
     }
 
     bool fetch(String& errorMsg) override {
-        JsonObject stockData = config["modules"][moduleId];
-        String ticker = stockData["ticker"] | "AAPL";
+        return fetchBlocking(this, errorMsg);
+    }
 
-        if (ticker.length() == 0) {
-            errorMsg = "Ticker is empty";
-            return false;
-        }
+    // All stock modules share Yahoo's multi-symbol spark endpoint
+    const char* batchGroup() override { return "yahoo"; }
+    const char* upstreamHost() override { return "query1.finance.yahoo.com"; }
 
-        String url = "https://query1.finance.yahoo.com/v8/finance/chart/" + ticker + "?interval=1d&range=1d";
+    bool prepareRequest(FetchRequest& request, String& errorMsg) override {
+        std::vector<ModuleInterface*> members(1, this);
+        return prepareBatchRequest(members, request, errorMsg);
+    }
 
-        Serial.print("Stock fetch: ");
-        Serial.print(moduleId);
-        Serial.print(" (");
-        Serial.print(ticker);
-        Serial.println(")");
+    bool handleDocument(JsonDocument& doc, String& errorMsg) override {
+        std::vector<ModuleInterface*> members(1, this);
+        std::vector<String> errors(1);
+        handleBatchDocument(doc, members, errors);
+        errorMsg = errors[0];
+        return errorMsg.length() == 0;
+    }
 
-        String response;
-        if (!network.httpGet(url.c_str(), response, errorMsg)) {
-            return false;
+    bool prepareBatchRequest(const std::vector<ModuleInterface*>& members, FetchRequest& request, String& errorMsg) override {
+        // Comma-separated list of unique tickers for the whole batch
+        String symbols;
+        for (ModuleInterface* m : members) {
+            GenericStockModule* member = static_cast<GenericStockModule*>(m);
+            JsonObject stockData = config["modules"][member->moduleId];
+            member->requestedTicker = stockData["ticker"] | "AAPL";
+            member->requestedTicker.toUpperCase();
+
+            if (member->requestedTicker.length() == 0) {
+                continue;  // Reported per member when the response comes back
+            }
+            if (("," + symbols + ",").indexOf("," + member->requestedTicker + ",") < 0) {
+                if (symbols.length() > 0) symbols += ",";
+                symbols += member->requestedTicker;
+            }
         }
 
-        return parseResponse(response, errorMsg);
-    }
-
-    bool parseResponse(String payload, String& errorMsg) {
-        if (payload.length() == 0) {
-            errorMsg = "Empty response";
+        if (symbols.length() == 0) {
+            errorMsg = "Ticker is empty";
             return false;
         }
 
-        StaticJsonDocument<2048> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        // One round-trip for every ticker (meta carries price and previous close)
+        String url = "https://query1.finance.yahoo.com/v7/finance/spark?symbols=" + symbols +
+                     "&range=1d&interval=1d";
 
-        if (error) {
-            errorMsg = "JSON parse error: " + String(error.c_str());
-            return false;
-        }
+        Serial.print("Stock fetch: ");
+        Serial.print(members.size());
+        Serial.print(" module(s) (");
+        Serial.print(symbols);
+        Serial.println(")");
 
-        if (!doc.containsKey("chart")) {
-            errorMsg = "Missing chart data";
-            return false;
+        // Keep only the fields we read so memory stays bounded per symbol,
+        // however large Yahoo's response gets (parsed on the worker)
+        JsonDocument& filter = request.newFilter();
+        filter["spark"]["result"][0]["symbol"] = true;
+        filter["spark"]["result"][0]["response"][0]["meta"]["regularMarketPrice"] = true;
+        filter["spark"]["result"][0]["response"][0]["meta"]["chartPreviousClose"] = true;
+
+        // What survives the filter: spark.result[] with one
+        // {symbol, response[{meta{price, close}}]} per ticker. Key names are stored once
+        size_t keyBytes = sizeof("spark") + sizeof("result") + sizeof("symbol") + sizeof("response") +
+                          sizeof("meta") + sizeof("regularMarketPrice") + sizeof("chartPreviousClose");
+        size_t capacity = 2 * JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(members.size()) + keyBytes + DOC_SLACK;
+        for (ModuleInterface* m : members) {
+            GenericStockModule* member = static_cast<GenericStockModule*>(m);
+            capacity += 2 * JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(1) +
+                        member->requestedTicker.length() + 1;
         }
 
-        JsonObject chart = doc["chart"];
-        if (!chart.containsKey("result") || chart["result"].size() == 0) {
-            errorMsg = "Missing result data";
-            return false;
+        request.url = url;
+        request.docCapacity = capacity;
+        return true;
+    }
+
+    void handleBatchDocument(JsonDocument& doc, const std::vector<ModuleInterface*>& members, std::vector<String>& errors) override {
+        JsonArray results = doc["spark"]["result"];
+        for (size_t i = 0; i < members.size(); i++) {
+            GenericStockModule* member = static_cast<GenericStockModule*>(members[i]);
+
+            if (member->requestedTicker.length() == 0) {
+                errors[i] = "Ticker is empty";
+                continue;
+            }
+            if (results.isNull()) {
+                errors[i] = "Missing result data";
+                continue;
+            }
+
+            // Find this member's symbol in the shared response
+            JsonObject meta;
+            for (JsonObject result : results) {
+                if (member->requestedTicker == (result["symbol"] | "")) {
+                    meta = result["response"][0]["meta"].as<JsonObject>();
+                    break;
+                }
+            }
+            member->applyQuote(meta, errors[i]);
         }
+    }
 
-        JsonObject result = chart["result"][0];
-        if (!result.containsKey("meta")) {
+    bool applyQuote(JsonObject meta, String& errorMsg) {
+        if (meta.isNull()) {
             errorMsg = "Missing meta data";
             return false;
         }
 
-        JsonObject meta = result["meta"];
         if (!meta.containsKey("regularMarketPrice")) {
             errorMsg = "Missing regularMarketPrice";
             return false;
@@ -219,13 +381,15 @@ public:
 
         String ticker = config["modules"][moduleId]["ticker"] | "???";
 
-        // Update cache
-        JsonObject data = config["modules"][moduleId];
-        data["value"] = price;
-        data["change"] = changePercent;
-        data["ticker"] = ticker;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        ModuleReading* reading = readings.edit(slot);
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->value = price;
+        reading->change = changePercent;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
         Serial.print(ticker);
         Serial.print(" price: $");
@@ -238,10 +402,10 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"][moduleId];
-        float price = data["value"] | 0.0;
-        float change = data["change"] | 0.0;
-        String ticker = data["ticker"] | "N/A";
+        const ModuleReading& reading = readings.read(id);
+        float price = reading.value;
+        float change = reading.change;
+        String ticker = config["modules"][moduleId]["ticker"] | "N/A";
 
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "%s: $%.2f | %+.1f%%", ticker.c_str(), price, change);
@@ -255,6 +419,8 @@ public:
 class GenericWeatherModule : public ModuleInterface {
 private:
     String moduleId;
+    int slot;            // Readings store slot
+    int requestedIndex;  // Position of this module's location in the request in flight
 
 public:
     GenericWeatherModule(const char* id, JsonObject cfg) {
@@ -263,73 +429,136 @@ public:
         displayName = "Weather";
         defaultRefreshInterval = 600;   // 10 minutes
         minRefreshInterval = 300;       // 5 minutes
+        requestedIndex = 0;
+        slot = readings.declare(id, READING_TEMPERATURE | READING_CONDITION);
     }
 
     bool fetch(String& errorMsg) override {
-        JsonObject weatherData = config["modules"][moduleId];
-        float lat = weatherData["latitude"] | 37.7749;
-        float lon = weatherData["longitude"] | -122.4194;
+        return fetchBlocking(this, errorMsg);
+    }
+
+    // All weather modules share one Open-Meteo request (comma-separated coordinates)
+    const char* batchGroup() override { return "open-meteo"; }
+    const char* upstreamHost() override { return "api.open-meteo.com"; }
+
+    bool prepareRequest(FetchRequest& request, String& errorMsg) override {
+        std::vector<ModuleInterface*> members(1, this);
+        return prepareBatchRequest(members, request, errorMsg);
+    }
+
+    bool handleDocument(JsonDocument& doc, String& errorMsg) override {
+        std::vector<ModuleInterface*> members(1, this);
+        std::vector<String> errors(1);
+        handleBatchDocument(doc, members, errors);
+        errorMsg = errors[0];
+        return errorMsg.length() == 0;
+    }
+
+    bool prepareBatchRequest(const std::vector<ModuleInterface*>& members, FetchRequest& request, String& errorMsg) override {
+        // Unique locations in request order; members sharing a location share its index
+        std::vector<String> locations;
+        String latitudes;
+        String longitudes;
+
+        for (ModuleInterface* m : members) {
+            GenericWeatherModule* member = static_cast<GenericWeatherModule*>(m);
+            JsonObject weatherData = config["modules"][member->moduleId];
+            float lat = weatherData["latitude"] | 37.7749;
+            float lon = weatherData["longitude"] | -122.4194;
+            String latStr = String(lat, 4);
+            String lonStr = String(lon, 4);
+            String key = latStr + "," + lonStr;
+
+            member->requestedIndex = -1;
+            for (size_t i = 0; i < locations.size(); i++) {
+                if (locations[i] == key) {
+                    member->requestedIndex = i;
+                    break;
+                }
+            }
+            if (member->requestedIndex < 0) {
+                member->requestedIndex = locations.size();
+                locations.push_back(key);
+                if (latitudes.length() > 0) {
+                    latitudes += ",";
+                    longitudes += ",";
+                }
+                latitudes += latStr;
+                longitudes += lonStr;
+            }
+        }
 
         Serial.print("Weather fetch: ");
-        Serial.print(moduleId);
-        Serial.print(" (");
-        Serial.print(lat, 4);
-        Serial.print(", ");
-        Serial.print(lon, 4);
-        Serial.println(")");
+        Serial.print(members.size());
+        Serial.print(" module(s), ");
+        Serial.print(locations.size());
+        Serial.println(" location(s)");
 
         // Use Open-Meteo API (free, no auth)
-        String url = "https://api.open-meteo.com/v1/forecast?latitude=" +
-                     String(lat, 4) + "&longitude=" + String(lon, 4) +
-                     "&current_weather=true";
-
-        String response;
-        if (!network.httpGet(url.c_str(), response, errorMsg)) {
-            return false;
+        String url = "https://api.open-meteo.com/v1/forecast?latitude=" + latitudes +
+                     "&longitude=" + longitudes + "&current_weather=true";
+
+        // One location returns an object, several return an array in request order.
+        // Keep only current_weather so memory stays bounded per location
+        JsonDocument& filter = request.newFilter();
+        if (locations.size() > 1) {
+            filter[0]["current_weather"]["temperature"] = true;
+            filter[0]["current_weather"]["weathercode"] = true;
+        } else {
+            filter["current_weather"]["temperature"] = true;
+            filter["current_weather"]["weathercode"] = true;
         }
 
-        return parseResponse(response, errorMsg);
+        request.url = url;
+        request.docCapacity = 96 * MAX_BATCH_SIZE;
+        return true;
     }
 
-    bool parseResponse(String payload, String& errorMsg) {
-        StaticJsonDocument<1024> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+    void handleBatchDocument(JsonDocument& doc, const std::vector<ModuleInterface*>& members, std::vector<String>& errors) override {
+        bool isArray = doc.is<JsonArray>();
 
-        if (error) {
-            errorMsg = "JSON parse error";
-            return false;
+        for (size_t i = 0; i < members.size(); i++) {
+            GenericWeatherModule* member = static_cast<GenericWeatherModule*>(members[i]);
+            JsonObject location = isArray ? doc[member->requestedIndex].as<JsonObject>()
+                                          : (member->requestedIndex == 0 ? doc.as<JsonObject>() : JsonObject());
+            member->applyWeather(location, errors[i]);
         }
+    }
 
-        if (!doc.containsKey("current_weather")) {
+    bool applyWeather(JsonObject location, String& errorMsg) {
+        if (location.isNull() || !location.containsKey("current_weather")) {
             errorMsg = "Missing weather data";
             return false;
         }
 
-        JsonObject current = doc["current_weather"];
+        JsonObject current = location["current_weather"];
         float temp = current["temperature"];
         int weatherCode = current["weathercode"];
 
-        // Update cache
-        JsonObject data = config["modules"][moduleId];
-        data["temperature"] = temp;
-        data["condition"] = getWeatherCondition(weatherCode);
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        ModuleReading* reading = readings.edit(slot);
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->temperature = temp;
+        strlcpy(reading->condition, getWeatherCondition(weatherCode), sizeof(reading->condition));
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
-        String location = data["location"] | "Unknown";
-        Serial.print(location);
+        String locationName = config["modules"][moduleId]["location"] | "Unknown";
+        Serial.print(locationName);
         Serial.print(" weather: ");
         Serial.print(temp, 1);
         Serial.print("°C, ");
-        Serial.println(data["condition"].as<const char*>());
+        Serial.println(reading->condition);
 
         return true;
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"][moduleId];
-        float temp = data["temperature"] | 0.0;
-        String condition = data["condition"] | "Unknown";
+        const ModuleReading& reading = readings.read(id);
+        float temp = reading.temperature;
+        String condition = reading.condition;
 
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "%.1f°C | %s", temp, condition.c_str());
@@ -365,6 +594,8 @@ public:
         minRefreshInterval = 60;        // 1 minute
     }
 
+    bool needsNetwork() override { return false; }
+
     bool fetch(String& errorMsg) override {
         // Custom module doesn't fetch - it's manually updated via API
         // Just return true (data already in config)
@@ -397,8 +628,11 @@ public:
         displayName = "Settings";
         defaultRefreshInterval = 30;   // 30 seconds
         minRefreshInterval = 10;       // 10 seconds
+        readings.declare("settings", READING_CODE, false);  // The web login code never goes to flash
     }
 
+    bool needsNetwork() override { return false; }
+
     bool fetch(String& errorMsg) override {
         // Use SecurityManager to generate code (keeps display and validation in sync)
         extern SecurityManager security;
@@ -410,12 +644,14 @@ public:
         unsigned long expiresAt = generatedAt + 300000;  // 5 minutes
         unsigned long timeRemaining = expiresAt - now;
 
-        // Store in config for display
-        JsonObject data = config["modules"]["settings"];
-        data["securityCode"] = code;
-        data["codeTimeRemaining"] = timeRemaining;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        // Store for display
+        ModuleReading* reading = readings.edit("settings");
+        if (reading) {
+            reading->securityCode = code;
+            reading->codeTimeRemaining = timeRemaining;
+            reading->lastUpdate = nowSeconds();
+            reading->lastSuccess = true;
+        }
 
         Serial.print("Settings: Generated code via SecurityManager: ");
         Serial.println(code);
@@ -424,8 +660,7 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"]["settings"];
-        uint32_t code = data["securityCode"] | 0;
+        uint32_t code = readings.read("settings").securityCode;
 
         char buffer[16];
         snprintf(buffer, sizeof(buffer), "Code: %06u", code);
@@ -447,14 +682,19 @@ public:
         displayName = "Quad Screen";
         defaultRefreshInterval = 60;   // 1 minute
         minRefreshInterval = 30;       // 30 seconds
+        readings.declare(this->id, 0, false);  // Only an activity stamp, rewritten every minute
     }
 
+    bool needsNetwork() override { return false; }
+
     bool fetch(String& errorMsg) override {
         // Quad module doesn't fetch - it aggregates data from other modules
         // Update timestamp to show it's active
-        JsonObject data = config["modules"][moduleId];
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        ModuleReading* reading = readings.edit(id);
+        if (reading) {
+            reading->lastUpdate = nowSeconds();
+            reading->lastSuccess = true;
+        }
         return true;
     }
 
@@ -489,14 +729,14 @@ private:
 
         if (type == "crypto") {
             String symbol = module["cryptoSymbol"] | "?";
-            float value = module["value"] | 0.0;
+            float value = readings.read(moduleId.c_str()).value;
             return symbol + ":" + String(value, 0);
         } else if (type == "stock") {
             String ticker = module["ticker"] | "?";
-            float value = module["value"] | 0.0;
+            float value = readings.read(moduleId.c_str()).value;
             return ticker + ":" + String(value, 0);
         } else if (type == "weather") {
-            float temp = module["temperature"] | 0.0;
+            float temp = readings.read(moduleId.c_str()).temperature;
             return String(temp, 0) + "°C";
         } else if (type == "custom") {
             float value = module["value"] | 0.0;
@@ -1,10 +1,13 @@
 #include "module_interface.h"
 #include "config.h"
 #include "network.h"
+#include "time_sync.h"
+#include "readings_store.h"
 #include <ArduinoJson.h>
 
 // External network manager (will be initialized in main)
 extern NetworkManager network;
+extern ReadingsStore readings;
 
 class BitcoinModule : public ModuleInterface {
 public:
@@ -49,14 +52,19 @@ public:
         float price = doc[cryptoId]["usd"];
         float change = doc[cryptoId]["usd_24h_change"];
 
-        // Update cache (preserve existing fields like cryptoId/cryptoSymbol/cryptoName)
-        JsonObject data = config["modules"]["bitcoin"];
-        data["value"] = price;
-        data["change24h"] = change;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        // Update reading (config keeps only cryptoId/cryptoSymbol/cryptoName)
+        ModuleReading* reading = readings.edit("bitcoin");
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->value = price;
+        reading->change = change;
+        reading->fields |= READING_VALUE | READING_CHANGE24H;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
-        String cryptoName = data["cryptoName"] | "Bitcoin";
+        String cryptoName = config["modules"]["bitcoin"]["cryptoName"] | "Bitcoin";
         Serial.print(cryptoName);
         Serial.print(" price: $");
         Serial.print(price, 2);
@@ -68,9 +76,9 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"]["bitcoin"];
-        float price = data["value"] | 0.0;
-        float change = data["change24h"] | 0.0;
+        const ModuleReading& reading = readings.read("bitcoin");
+        float price = reading.value;
+        float change = reading.change;
 
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "$%.2f | %+.1f%%", price, change);
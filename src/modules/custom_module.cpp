@@ -1,7 +1,11 @@
 #include "module_interface.h"
 #include "config.h"
+#include "time_sync.h"
+#include "readings_store.h"
 #include <ArduinoJson.h>
 
+extern ReadingsStore readings;
+
 class CustomModule : public ModuleInterface {
 public:
     CustomModule() {
@@ -15,9 +19,11 @@ public:
         // Custom module doesn't fetch from external API
         // Value is set directly by user via config portal
 
-        JsonObject data = config["modules"]["custom"].to<JsonObject>();
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        ModuleReading* reading = readings.edit("custom");
+        if (reading) {
+            reading->lastUpdate = nowSeconds();
+            reading->lastSuccess = true;
+        }
 
         Serial.println("Custom module: No fetch needed (manual entry)");
         return true;
@@ -1,9 +1,12 @@
 #include "module_interface.h"
 #include "config.h"
 #include "network.h"
+#include "time_sync.h"
+#include "readings_store.h"
 #include <ArduinoJson.h>
 
 extern NetworkManager network;
+extern ReadingsStore readings;
 
 class EthereumModule : public ModuleInterface {
 public:
@@ -48,14 +51,19 @@ public:
         float price = doc[cryptoId]["usd"];
         float change = doc[cryptoId]["usd_24h_change"];
 
-        // Update cache (preserve existing fields like cryptoId/cryptoSymbol/cryptoName)
-        JsonObject data = config["modules"]["ethereum"];
-        data["value"] = price;
-        data["change24h"] = change;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        // Update reading (config keeps only cryptoId/cryptoSymbol/cryptoName)
+        ModuleReading* reading = readings.edit("ethereum");
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->value = price;
+        reading->change = change;
+        reading->fields |= READING_VALUE | READING_CHANGE24H;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
-        String cryptoName = data["cryptoName"] | "Ethereum";
+        String cryptoName = config["modules"]["ethereum"]["cryptoName"] | "Ethereum";
         Serial.print(cryptoName);
         Serial.print(" price: $");
         Serial.print(price, 2);
@@ -67,9 +75,9 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"]["ethereum"];
-        float price = data["value"] | 0.0;
-        float change = data["change24h"] | 0.0;
+        const ModuleReading& reading = readings.read("ethereum");
+        float price = reading.value;
+        float change = reading.change;
 
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "$%.2f | %+.1f%%", price, change);
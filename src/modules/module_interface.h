@@ -3,6 +3,11 @@
 
 #include <Arduino.h>
 #include <ArduinoJson.h>
+#include <vector>
+#include "fetch_worker.h"
+
+// Upper bound on modules sharing one batched request
+#define MAX_BATCH_SIZE 10
 
 // Base interface for all metric modules
 class ModuleInterface {
@@ -21,6 +26,36 @@ public:
     virtual bool fetch(String& errorMsg) = 0;
     virtual String formatDisplay() = 0;
 
+    // Whether the module pulls data from the network (background refresh candidates)
+    virtual bool needsNetwork() { return true; }
+
+    // Upstream host for per-host rate limiting (nullptr = not limited)
+    virtual const char* upstreamHost() { return nullptr; }
+
+    // Asynchronous fetch for network modules: prepareRequest() builds the HTTP
+    // request on the loop task, the fetch worker performs it, and handleResponse()
+    // parses the body back on the loop task (safe to update config there)
+    virtual bool prepareRequest(FetchRequest& request, String& errorMsg) {
+        errorMsg = "Async fetch not supported";
+        return false;
+    }
+    virtual bool handleResponse(const String& payload, String& errorMsg) { return false; }
+
+    // Batched fetch: modules returning the same batchGroup() share one request.
+    // The scheduler calls these on one member (the lead) with every member of
+    // the batch; errors receives one message per member ("" = success).
+    virtual const char* batchGroup() { return nullptr; }
+    virtual bool prepareBatchRequest(const std::vector<ModuleInterface*>& members, FetchRequest& request, String& errorMsg) {
+        errorMsg = "Batch fetch not supported";
+        return false;
+    }
+    virtual void handleBatchResponse(const String& payload, const std::vector<ModuleInterface*>& members, std::vector<String>& errors) {}
+
+    // Streaming variants: when the request sets docCapacity (and usually a filter),
+    // the body is parsed on the worker and these receive the document instead
+    virtual bool handleDocument(JsonDocument& doc, String& errorMsg) { return false; }
+    virtual void handleBatchDocument(JsonDocument& doc, const std::vector<ModuleInterface*>& members, std::vector<String>& errors) {}
+
     // Optional configuration functions
     virtual bool parseConfig(JsonObject cfg) { return true; }
     virtual JsonObject getConfig() { return JsonObject(); }
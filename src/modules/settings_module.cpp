@@ -1,9 +1,12 @@
 #include "module_interface.h"
 #include "config.h"
 #include "security.h"
+#include "time_sync.h"
+#include "readings_store.h"
 
-// External security manager (will be initialized in main)
+// External security manager and readings (will be initialized in main)
 extern SecurityManager security;
+extern ReadingsStore readings;
 
 class SettingsModule : public ModuleInterface {
 public:
@@ -20,12 +23,15 @@ public:
 
         uint32_t code = security.generateNewCode();
 
-        // Store code in config for display
-        JsonObject data = config["modules"]["settings"].to<JsonObject>();
-        data["securityCode"] = code;
-        data["codeTimeRemaining"] = security.getCodeTimeRemaining();
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        // Store code for display
+        ModuleReading* reading = readings.edit("settings");
+        if (reading) {
+            reading->securityCode = code;
+            reading->codeTimeRemaining = security.getCodeTimeRemaining();
+            reading->fields |= READING_CODE;
+            reading->lastUpdate = nowSeconds();
+            reading->lastSuccess = true;
+        }
 
         Serial.print("Settings module: New security code generated: ");
         Serial.println(code);
@@ -39,8 +45,7 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"]["settings"];
-        uint32_t code = data["securityCode"] | 0;
+        uint32_t code = readings.read("settings").securityCode;
 
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "Code: %06u", code);
@@ -1,9 +1,12 @@
 #include "module_interface.h"
 #include "config.h"
 #include "network.h"
+#include "time_sync.h"
+#include "readings_store.h"
 #include <ArduinoJson.h>
 
 extern NetworkManager network;
+extern ReadingsStore readings;
 
 class StockModule : public ModuleInterface {
 public:
@@ -134,13 +137,17 @@ public:
         Serial.print(", Change: ");
         Serial.println(changePercent, 2);
 
-        // Update cache
-        JsonObject data = config["modules"]["stock"].to<JsonObject>();
-        data["value"] = price;
-        data["change"] = changePercent;
-        data["ticker"] = ticker;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        // Update reading
+        ModuleReading* reading = readings.edit("stock");
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->value = price;
+        reading->change = changePercent;
+        reading->fields |= READING_VALUE | READING_CHANGE;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
         Serial.print(ticker);
         Serial.print(" price: $");
@@ -153,10 +160,10 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"]["stock"];
-        float price = data["value"] | 0.0;
-        float change = data["change"] | 0.0;
-        String ticker = data["ticker"] | "N/A";
+        const ModuleReading& reading = readings.read("stock");
+        float price = reading.value;
+        float change = reading.change;
+        String ticker = config["modules"]["stock"]["ticker"] | "N/A";
 
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "%s: $%.2f | %+.1f%%", ticker.c_str(), price, change);
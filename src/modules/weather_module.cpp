@@ -1,9 +1,12 @@
 #include "module_interface.h"
 #include "config.h"
 #include "network.h"
+#include "time_sync.h"
+#include "readings_store.h"
 #include <ArduinoJson.h>
 
 extern NetworkManager network;
+extern ReadingsStore readings;
 
 class WeatherModule : public ModuleInterface {
 public:
@@ -122,12 +125,17 @@ public:
             Serial.println("'");
         }
 
-        // Update cache (use reference, NOT .to<JsonObject>() which clears everything!)
-        JsonObject data = config["modules"]["weather"];
-        data["temperature"] = temp;
-        data["condition"] = condition;
-        data["lastUpdate"] = millis() / 1000;
-        data["lastSuccess"] = true;
+        // Update reading
+        ModuleReading* reading = readings.edit("weather");
+        if (!reading) {
+            errorMsg = "Readings store full";
+            return false;
+        }
+        reading->temperature = temp;
+        strlcpy(reading->condition, condition.c_str(), sizeof(reading->condition));
+        reading->fields |= READING_TEMPERATURE | READING_CONDITION;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
 
         Serial.print("Weather: ");
         Serial.print(temp, 1);
@@ -138,10 +146,10 @@ public:
     }
 
     String formatDisplay() override {
-        JsonObject data = config["modules"]["weather"];
-        float temp = data["temperature"] | 0.0;
-        String condition = data["condition"] | "Unknown";
-        String location = data["location"] | "Unknown";
+        const ModuleReading& reading = readings.read("weather");
+        float temp = reading.temperature;
+        String condition = reading.condition;
+        String location = config["modules"]["weather"]["location"] | "Unknown";
 
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "%.1f°C | %s | %s", temp, condition.c_str(), location.c_str());
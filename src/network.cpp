@@ -2,12 +2,41 @@
 #include "config.h"
 #include "security.h"
 #include "scheduler.h"
+#include "time_sync.h"
+#include "http_body_stream.h"
+#include "inflate_stream.h"
+#include "event_bus.h"
+#include "readings_store.h"
+#include "config_journal.h"
+#include "web_assets.h"  // Gzipped pages from web/ (scripts/build_web_assets.py)
 #include <ESPmDNS.h>
 #include <LittleFS.h>
 
 // External objects (initialized in main)
 extern SecurityManager security;
 extern Scheduler scheduler;
+extern FetchWorker fetchWorker;
+extern EventBus eventBus;
+extern ReadingsStore readings;
+extern ConfigJournal configJournal;
+
+// Percent-encode a query string value
+static String urlEncode(const String& text) {
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    String encoded;
+    encoded.reserve(text.length() * 3);
+    for (size_t i = 0; i < text.length(); i++) {
+        uint8_t c = text[i];
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded += (char)c;
+        } else {
+            encoded += '%';
+            encoded += HEX_DIGITS[c >> 4];
+            encoded += HEX_DIGITS[c & 0x0F];
+        }
+    }
+    return encoded;
+}
 
 // Debug: Store last POST body and save result for debugging
 String lastPostBody = "";
@@ -33,712 +62,14 @@ const char* ANIMAL_NAMES[] = {
     "Lynx", "Panther", "Puma", "Ocelot"
 };
 
-// Minimal HTML for configuration (ultra-compact)
-const char PORTAL_HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html>
-<html><head><meta name="viewport" content="width=device-width,initial-scale=1">
-<title>Setup</title><style>body{font-family:Arial;margin:20px}input,select{width:100%;padding:8px;margin:5px 0}
-button{background:#4CAF50;color:#fff;padding:12px;border:none;width:100%;margin-top:15px}</style></head>
-<body><h2>DataTracker Setup</h2><label>WiFi:</label><select id="ssid"></select>
-<label>Password:</label><input type="password" id="pwd"><label>Module:</label>
-<select id="mod"><option value="bitcoin">Bitcoin</option><option value="ethereum">Ethereum</option>
-<option value="stock">Stock</option><option value="weather">Weather</option></select>
-<div id="cfg"></div><button onclick="save()">Complete Step 3/3</button><script>
-function save(){var c={ssid:document.getElementById('ssid').value,password:document.getElementById('pwd').value,
-module:document.getElementById('mod').value};fetch('/save',{method:'POST',body:JSON.stringify(c)}).then(()=>alert('Saved!'));}
-fetch('/scan').then(r=>r.json()).then(n=>{var s=document.getElementById('ssid');n.forEach(x=>s.innerHTML+=
-'<option value="'+x.ssid+'">'+x.ssid+'</option>')});
-</script></body></html>)rawliteral";
-
-// Dynamic Settings page HTML (login + module management)
-const char SETTINGS_HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html>
-<html>
-<head>
-    <meta name="viewport" content="width=device-width,initial-scale=1">
-    <title>DataTracker Settings</title>
-    <style>
-        * { box-sizing: border-box; }
-        body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Arial, sans-serif; margin: 0; padding: 20px; background: #f5f5f5; }
-        .container { max-width: 600px; margin: 0 auto; background: #fff; border-radius: 12px; box-shadow: 0 2px 8px rgba(0,0,0,0.1); }
-        .header { background: linear-gradient(135deg, #667eea 0%, #764ba2 100%); color: white; padding: 30px; border-radius: 12px 12px 0 0; text-align: center; }
-        .header h1 { margin: 0; font-size: 28px; }
-        .header p { margin: 10px 0 0; opacity: 0.9; }
-        .content { padding: 30px; }
-        .hidden { display: none; }
-        .code-input { font-size: 32px; text-align: center; letter-spacing: 15px; width: 100%; padding: 15px; border: 2px solid #ddd; border-radius: 8px; }
-        button { background: #667eea; color: white; border: none; padding: 12px 24px; border-radius: 8px; cursor: pointer; font-size: 16px; width: 100%; margin-top: 15px; transition: all 0.3s; }
-        button:hover { background: #5568d3; transform: translateY(-1px); }
-        button.secondary { background: #6c757d; }
-        button.danger { background: #dc3545; }
-        button.small { width: auto; padding: 8px 16px; font-size: 14px; }
-        .module-list { margin-top: 20px; }
-        .module-item { background: #f8f9fa; border: 2px solid #e9ecef; border-radius: 8px; padding: 15px; margin-bottom: 10px; display: flex; align-items: center; cursor: move; transition: all 0.3s; }
-        .module-item:hover { border-color: #667eea; box-shadow: 0 2px 8px rgba(102,126,234,0.2); }
-        .module-item.dragging { opacity: 0.5; }
-        .module-icon { font-size: 32px; margin-right: 15px; }
-        .module-info { flex: 1; }
-        .module-name { font-weight: bold; font-size: 16px; margin: 0; }
-        .module-detail { color: #6c757d; font-size: 14px; margin: 5px 0 0; }
-        .module-actions { display: flex; gap: 8px; }
-        .module-actions button { width: auto; margin: 0; padding: 6px 12px; font-size: 13px; }
-        .add-module { margin-top: 20px; padding: 20px; background: #e7f3ff; border-radius: 8px; border: 2px dashed #667eea; }
-        .module-type-grid { display: grid; grid-template-columns: repeat(auto-fit, minmax(120px, 1fr)); gap: 10px; margin-top: 15px; }
-        .module-type { background: white; border: 2px solid #e9ecef; border-radius: 8px; padding: 15px; text-align: center; cursor: pointer; transition: all 0.3s; }
-        .module-type:hover { border-color: #667eea; box-shadow: 0 2px 8px rgba(102,126,234,0.2); }
-        .module-type .icon { font-size: 32px; margin-bottom: 8px; }
-        .module-type .name { font-size: 14px; font-weight: 500; }
-        .modal { display: none; position: fixed; top: 0; left: 0; width: 100%; height: 100%; background: rgba(0,0,0,0.5); z-index: 1000; }
-        .modal.active { display: flex; align-items: center; justify-content: center; }
-        .modal-content { background: white; border-radius: 12px; padding: 30px; max-width: 500px; width: 90%; max-height: 80vh; overflow-y: auto; }
-        .modal-header { font-size: 24px; font-weight: bold; margin-bottom: 20px; }
-        .form-group { margin-bottom: 20px; }
-        .form-group label { display: block; font-weight: 500; margin-bottom: 8px; }
-        .form-group input, .form-group select { width: 100%; padding: 10px; border: 2px solid #e9ecef; border-radius: 8px; font-size: 16px; }
-        .form-actions { display: flex; gap: 10px; margin-top: 20px; }
-        .form-actions button { flex: 1; }
-        .message { padding: 12px; border-radius: 8px; margin-bottom: 20px; font-weight: 500; }
-        .message.error { background: #f8d7da; color: #721c24; border: 1px solid #f5c6cb; }
-        .message.success { background: #d4edda; color: #155724; border: 1px solid #c3e6cb; }
-        .search-container { position: relative; }
-        .search-results { border: 1px solid #ddd; border-radius: 8px; margin-top: 5px; max-height: 200px; overflow-y: auto; background: white; }
-        .search-item { padding: 10px; cursor: pointer; border-bottom: 1px solid #eee; display: flex; align-items: center; }
-        .search-item:hover { background: #f5f5f5; }
-        .search-item:last-child { border-bottom: none; }
-        .search-item img { width: 24px; height: 24px; margin-right: 10px; border-radius: 50%; }
-        .text-center { text-align: center; }
-        .mt-20 { margin-top: 20px; }
-        .flex-end { display: flex; justify-content: flex-end; }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div class="header">
-            <h1>DataTracker</h1>
-            <p id="header-subtitle">Settings & Configuration</p>
-        </div>
-        <div id="login-view" class="content">
-            <p class="text-center">Enter code from device display:</p>
-            <input type="text" id="code" class="code-input" maxlength="6" placeholder="000000" pattern="[0-9]{6}">
-            <button onclick="validateCode()">Unlock Settings</button>
-            <div id="login-error" class="message error hidden"></div>
-        </div>
-        <div id="settings-view" class="content hidden">
-            <div class="flex-end" style="margin-bottom: 20px;">
-                <button class="small secondary" onclick="logout()">Logout</button>
-            </div>
-            <div id="message" class="message hidden"></div>
-            <h3>Active Modules</h3>
-            <p style="color: #6c757d; font-size: 14px;">Drag to reorder - Click Edit to configure</p>
-            <div id="module-list" class="module-list"></div>
-            <div class="add-module">
-                <h4 style="margin-top: 0;">Add New Module</h4>
-                <p style="color: #6c757d; font-size: 14px; margin-bottom: 15px;">Choose a module type to add:</p>
-                <div id="module-types" class="module-type-grid"></div>
-            </div>
-            <div class="mt-20">
-                <h3>Device Settings</h3>
-                <div class="form-group">
-                    <label>Currency:</label>
-                    <select id="currency">
-                        <option value="USD">US Dollar (USD)</option>
-                        <option value="EUR">Euro (EUR)</option>
-                        <option value="GBP">British Pound (GBP)</option>
-                        <option value="JPY">Japanese Yen (JPY)</option>
-                        <option value="CAD">Canadian Dollar (CAD)</option>
-                        <option value="AUD">Australian Dollar (AUD)</option>
-                        <option value="CHF">Swiss Franc (CHF)</option>
-                        <option value="CNY">Chinese Yuan (CNY)</option>
-                        <option value="INR">Indian Rupee (INR)</option>
-                        <option value="BRL">Brazilian Real (BRL)</option>
-                    </select>
-                </div>
-                <div class="form-group">
-                    <label>Thousand Separator:</label>
-                    <select id="thousandSep">
-                        <option value="">None (1000) ⭐ Recommended</option>
-                        <option value="'">Apostrophe (1'000) - Tight</option>
-                        <option value=",">Comma (1,000)</option>
-                        <option value=".">Period (1.000)</option>
-                        <option value=" ">Space (1 000)</option>
-                    </select>
-                </div>
-                <button onclick="saveDeviceSettings()">Save Settings</button>
-            </div>
-            <div class="mt-20">
-                <button class="danger" onclick="restartDevice()">Restart Device</button>
-                <button class="danger" onclick="factoryReset()">Factory Reset</button>
-            </div>
-        </div>
-    </div>
-    <div id="module-modal" class="modal">
-        <div class="modal-content">
-            <div class="modal-header" id="modal-title">Add Module</div>
-            <div id="modal-form"></div>
-            <div class="form-actions">
-                <button class="secondary" onclick="closeModal()">Cancel</button>
-                <button id="modal-save-btn" onclick="saveModule()">Save</button>
-            </div>
-        </div>
-    </div>
-    <script>
-        let token = '';
-        let modules = [];
-        let moduleTypes = [];
-        let currentModule = null;
-        let searchTimeout = null;
-        let draggedItem = null;
-        function validateCode() {
-            const code = document.getElementById('code').value;
-            if (code.length !== 6) {
-                showLoginError('Enter 6-digit code');
-                return;
-            }
-            fetch('/api/validate', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify({code: parseInt(code)})
-            })
-            .then(r => r.json())
-            .then(d => {
-                if (d.valid) {
-                    token = d.token;
-                    showSettings();
-                } else {
-                    showLoginError(d.error || 'Invalid code');
-                }
-            })
-            .catch(() => showLoginError('Connection error'));
-        }
-        function showLoginError(msg) {
-            const el = document.getElementById('login-error');
-            el.textContent = msg;
-            el.classList.remove('hidden');
-        }
-        function showSettings() {
-            document.getElementById('login-view').classList.add('hidden');
-            document.getElementById('settings-view').classList.remove('hidden');
-            loadSettings();
-        }
-        function logout() {
-            token = '';
-            document.getElementById('settings-view').classList.add('hidden');
-            document.getElementById('login-view').classList.remove('hidden');
-            document.getElementById('code').value = '';
-        }
-        function loadSettings() {
-            loadModules();
-            loadModuleTypes();
-            loadConfig();
-        }
-        function loadModules() {
-            fetch('/api/modules', {headers: {'Authorization': token}})
-            .then(r => {
-                if (r.status === 401) { logout(); return null; }
-                if (!r.ok) {
-                    return r.text().then(text => {
-                        throw new Error(`HTTP ${r.status}: ${text}`);
-                    });
-                }
-                return r.json();
-            })
-            .then(d => {
-                if (!d) return;
-                modules = d.modules || [];
-                renderModules();
-            })
-            .catch(e => {
-                console.error('Load modules error:', e);
-                showMessage('Failed to load modules: ' + e.message, 'error');
-            });
-        }
-        function loadModuleTypes() {
-            fetch('/api/module-types', {headers: {'Authorization': token}})
-            .then(r => r.json())
-            .then(d => {
-                moduleTypes = d.types || [];
-                renderModuleTypes();
-            });
-        }
-        function loadConfig() {
-            fetch('/api/config', {headers: {'Authorization': token}})
-            .then(r => r.json())
-            .then(d => {
-                document.getElementById('currency').value = d.device.currency || 'USD';
-                document.getElementById('thousandSep').value = d.device.thousandSep !== undefined ? d.device.thousandSep : ',';
-            });
-        }
-        function renderModules() {
-            const list = document.getElementById('module-list');
-            if (modules.length === 0) {
-                list.innerHTML = '<p style="text-align:center;color:#6c757d;padding:20px;">No modules yet. Add one below!</p>';
-                return;
-            }
-            list.innerHTML = modules.map((m, idx) => {
-                const icon = getModuleIcon(m.type);
-                const name = getModuleName(m);
-                const detail = getModuleDetail(m);
-                return `<div class="module-item" draggable="true" data-id="${m.id}">
-                    <div class="module-icon">${icon}</div>
-                    <div class="module-info">
-                        <div class="module-name">${name}</div>
-                        <div class="module-detail">${detail}</div>
-                    </div>
-                    <div class="module-actions">
-                        <button class="small" onclick="editModule('${m.id}')">Edit</button>
-                        <button class="small danger" onclick="deleteModule('${m.id}')">Delete</button>
-                    </div>
-                </div>`;
-            }).join('');
-            setupDragDrop();
-        }
-        function getModuleIcon(type) {
-            const icons = {crypto: 'B', stock: 'S', weather: 'W', custom: 'C', settings: 'S'};
-            return icons[type] || 'M';
-        }
-        function getModuleName(m) {
-            if (m.type === 'crypto') return m.cryptoName || m.cryptoSymbol || 'Crypto';
-            if (m.type === 'stock') return m.name || m.ticker || 'Stock';
-            if (m.type === 'weather') return m.location || 'Weather';
-            if (m.type === 'custom') return m.label || 'Custom';
-            if (m.type === 'settings') return 'Settings';
-            return m.id;
-        }
-        function getModuleDetail(m) {
-            if (m.type === 'crypto') return `${m.cryptoSymbol} - $${(m.value || 0).toFixed(2)}`;
-            if (m.type === 'stock') return `${m.ticker} - $${(m.value || 0).toFixed(2)}`;
-            if (m.type === 'weather') return `${(m.temperature || 0).toFixed(1)}C - ${m.condition || 'Unknown'}`;
-            if (m.type === 'custom') return `${(m.value || 0).toFixed(2)} ${m.unit || ''}`;
-            return 'Configuration module';
-        }
-        function setupDragDrop() {
-            const items = document.querySelectorAll('.module-item');
-            items.forEach(item => {
-                item.addEventListener('dragstart', handleDragStart);
-                item.addEventListener('dragover', handleDragOver);
-                item.addEventListener('drop', handleDrop);
-                item.addEventListener('dragend', handleDragEnd);
-            });
-        }
-        function handleDragStart(e) {
-            draggedItem = this;
-            this.classList.add('dragging');
-            e.dataTransfer.effectAllowed = 'move';
-        }
-        function handleDragOver(e) {
-            e.preventDefault();
-            e.dataTransfer.dropEffect = 'move';
-            const afterElement = getDragAfterElement(this.parentNode, e.clientY);
-            if (afterElement == null) {
-                this.parentNode.appendChild(draggedItem);
-            } else {
-                this.parentNode.insertBefore(draggedItem, afterElement);
-            }
-        }
-        function handleDrop(e) {
-            e.stopPropagation();
-            return false;
-        }
-        function handleDragEnd(e) {
-            this.classList.remove('dragging');
-            saveModuleOrder();
-        }
-        function getDragAfterElement(container, y) {
-            const draggableElements = [...container.querySelectorAll('.module-item:not(.dragging)')];
-            return draggableElements.reduce((closest, child) => {
-                const box = child.getBoundingClientRect();
-                const offset = y - box.top - box.height / 2;
-                if (offset < 0 && offset > closest.offset) {
-                    return {offset: offset, element: child};
-                } else {
-                    return closest;
-                }
-            }, {offset: Number.NEGATIVE_INFINITY}).element;
-        }
-        function saveModuleOrder() {
-            const items = document.querySelectorAll('.module-item');
-            const order = Array.from(items).map(item => item.getAttribute('data-id'));
-            fetch('/api/modules/order', {
-                method: 'POST',
-                headers: {'Authorization': token, 'Content-Type': 'application/json'},
-                body: JSON.stringify({order: order})
-            })
-            .then(r => r.json())
-            .then(d => {
-                if (d.success) {
-                    showMessage('Module order updated', 'success');
-                }
-            })
-            .catch(e => showMessage('Failed to update order', 'error'));
-        }
-        function renderModuleTypes() {
-            const grid = document.getElementById('module-types');
-            grid.innerHTML = moduleTypes.map(t => `
-                <div class="module-type" onclick="openAddModule('${t.id}')">
-                    <div class="icon">${t.icon}</div>
-                    <div class="name">${t.name}</div>
-                </div>
-            `).join('');
-        }
-        function openAddModule(type) {
-            currentModule = {type: type, id: generateModuleId(type)};
-            document.getElementById('modal-title').textContent = 'Add ' + moduleTypes.find(t => t.id === type).name;
-            renderModuleForm(type);
-            document.getElementById('module-modal').classList.add('active');
-        }
-        function editModule(id) {
-            currentModule = modules.find(m => m.id === id);
-            if (!currentModule) return;
-            const typeName = moduleTypes.find(t => t.id === currentModule.type)?.name || 'Module';
-            document.getElementById('modal-title').textContent = 'Edit ' + typeName;
-            renderModuleForm(currentModule.type, currentModule);
-            document.getElementById('module-modal').classList.add('active');
-        }
-        function generateModuleId(type) {
-            const existing = modules.filter(m => m.type === type).length;
-            return type + '_' + Date.now();
-        }
-        function renderModuleForm(type, data = {}) {
-            const form = document.getElementById('modal-form');
-            if (type === 'crypto') {
-                form.innerHTML = `
-                    <div class="form-group">
-                        <label>Search Cryptocurrency:</label>
-                        <div class="search-container">
-                            <input type="text" id="crypto-search" placeholder="Search..." oninput="searchCrypto(this.value)">
-                            <div id="crypto-results" class="search-results" style="display:none"></div>
-                        </div>
-                    </div>
-                    <div class="form-group">
-                        <label>Crypto ID:</label>
-                        <input type="text" id="cryptoId" value="${data.cryptoId || ''}" readonly>
-                    </div>
-                    <div class="form-group">
-                        <label>Symbol:</label>
-                        <input type="text" id="cryptoSymbol" value="${data.cryptoSymbol || ''}" readonly>
-                    </div>
-                    <div class="form-group">
-                        <label>Name:</label>
-                        <input type="text" id="cryptoName" value="${data.cryptoName || ''}" readonly>
-                    </div>
-                    <div class="form-group">
-                        <label>Decimal Places:</label>
-                        <input type="number" id="decimals" value="${data.decimals !== undefined ? data.decimals : 'auto'}" min="0" max="8" placeholder="auto">
-                        <small style="color: #888; font-size: 11px;">Leave blank for auto (BTC: 0, ETH: 0, <$1: 4-6)</small>
-                    </div>
-                `;
-            } else if (type === 'stock') {
-                form.innerHTML = `
-                    <div class="form-group">
-                        <label>Search Stock:</label>
-                        <div class="search-container">
-                            <input type="text" id="stock-search" placeholder="Search ticker..." oninput="searchStock(this.value)">
-                            <div id="stock-results" class="search-results" style="display:none"></div>
-                        </div>
-                    </div>
-                    <div class="form-group">
-                        <label>Ticker Symbol:</label>
-                        <input type="text" id="ticker" value="${data.ticker || ''}" placeholder="AAPL">
-                    </div>
-                    <div class="form-group">
-                        <label>Company Name:</label>
-                        <input type="text" id="stockName" value="${data.name || ''}" placeholder="Apple Inc.">
-                    </div>
-                    <div class="form-group">
-                        <label>Decimal Places:</label>
-                        <input type="number" id="decimals" value="${data.decimals !== undefined ? data.decimals : 'auto'}" min="0" max="8" placeholder="auto">
-                        <small style="color: #888; font-size: 11px;">Leave blank for auto (>$100: 0, else: 2)</small>
-                    </div>
-                `;
-            } else if (type === 'weather') {
-                form.innerHTML = `
-                    <div class="form-group">
-                        <label>Search Location:</label>
-                        <input type="text" id="weather-search" placeholder="Start typing city name..." oninput="searchWeather(this.value)" autocomplete="off">
-                        <div id="weather-results" style="display:none; max-height:150px; overflow-y:auto; border:1px solid #ddd; margin-top:4px;"></div>
-                    </div>
-                    <div class="form-group">
-                        <label>Selected Location:</label>
-                        <input type="text" id="location" value="${data.location || ''}" readonly style="background:#f5f5f5">
-                    </div>
-                    <input type="hidden" id="latitude" value="${data.latitude || 0}">
-                    <input type="hidden" id="longitude" value="${data.longitude || 0}">
-                `;
-            } else if (type === 'custom') {
-                form.innerHTML = `
-                    <div class="form-group">
-                        <label>Label:</label>
-                        <input type="text" id="label" value="${data.label || ''}" placeholder="My Metric" maxlength="20">
-                    </div>
-                    <div class="form-group">
-                        <label>Value:</label>
-                        <input type="number" step="0.01" id="value" value="${data.value || 0}">
-                    </div>
-                    <div class="form-group">
-                        <label>Unit:</label>
-                        <input type="text" id="unit" value="${data.unit || ''}" placeholder="units" maxlength="10">
-                    </div>
-                `;
-            } else if (type === 'quad') {
-                // Build module selector options from current modules
-                let moduleOptions = '<option value="">-- None --</option>';
-                modules.forEach(m => {
-                    if (m.type !== 'quad' && m.type !== 'settings') {
-                        const name = getModuleName(m);
-                        moduleOptions += `<option value="${m.id}">${name}</option>`;
-                    }
-                });
-
-                form.innerHTML = `
-                    <div class="form-group">
-                        <label>Top Left Module:</label>
-                        <select id="slot1">${moduleOptions}</select>
-                    </div>
-                    <div class="form-group">
-                        <label>Top Right Module:</label>
-                        <select id="slot2">${moduleOptions}</select>
-                    </div>
-                    <div class="form-group">
-                        <label>Bottom Left Module:</label>
-                        <select id="slot3">${moduleOptions}</select>
-                    </div>
-                    <div class="form-group">
-                        <label>Bottom Right Module:</label>
-                        <select id="slot4">${moduleOptions}</select>
-                    </div>
-                `;
-
-                // Set current values if editing
-                if (data.slot1) document.getElementById('slot1').value = data.slot1;
-                if (data.slot2) document.getElementById('slot2').value = data.slot2;
-                if (data.slot3) document.getElementById('slot3').value = data.slot3;
-                if (data.slot4) document.getElementById('slot4').value = data.slot4;
-            }
-        }
-        function searchCrypto(query) {
-            clearTimeout(searchTimeout);
-            if (query.length < 2) {
-                document.getElementById('crypto-results').style.display = 'none';
-                return;
-            }
-            const results = document.getElementById('crypto-results');
-            results.innerHTML = '<div class="search-item">Searching...</div>';
-            results.style.display = 'block';
-            searchTimeout = setTimeout(() => {
-                fetch(`https://api.coingecko.com/api/v3/search?query=${encodeURIComponent(query)}`)
-                .then(r => r.json())
-                .then(d => {
-                    results.innerHTML = d.coins.slice(0,5).map(coin => `
-                        <div class="search-item" onclick="selectCrypto('${coin.id}', '${coin.symbol}', '${coin.name.replace(/'/g, "\\'")}')">
-                            ${coin.thumb ? `<img src="${coin.thumb}">` : ''}
-                            ${coin.name} (${coin.symbol.toUpperCase()})
-                        </div>
-                    `).join('') || '<div class="search-item">No results</div>';
-                })
-                .catch(() => results.innerHTML = '<div class="search-item">Error searching</div>');
-            }, 300);
-        }
-        function selectCrypto(id, symbol, name) {
-            document.getElementById('cryptoId').value = id;
-            document.getElementById('cryptoSymbol').value = symbol.toUpperCase();
-            document.getElementById('cryptoName').value = name;
-            document.getElementById('crypto-search').value = '';
-            document.getElementById('crypto-results').style.display = 'none';
-        }
-        function searchStock(query) {
-            clearTimeout(searchTimeout);
-            if (query.length < 1) {
-                document.getElementById('stock-results').style.display = 'none';
-                return;
-            }
-            const results = document.getElementById('stock-results');
-            results.innerHTML = '<div class="search-item">Searching...</div>';
-            results.style.display = 'block';
-            searchTimeout = setTimeout(() => {
-                fetch(`/api/stock-search?q=${encodeURIComponent(query)}`)
-                .then(r => r.json())
-                .then(d => {
-                    if (d.quotes && d.quotes.length > 0) {
-                        results.innerHTML = d.quotes.filter(q => q.quoteType === 'EQUITY' || q.quoteType === 'ETF').slice(0,5).map(q => `
-                            <div class="search-item" onclick="selectStock('${q.symbol}', '${(q.shortname || q.longname || q.symbol).replace(/'/g, "\\'")}')">
-                                ${q.shortname || q.longname || q.symbol} (${q.symbol})
-                            </div>
-                        `).join('') || `<div class="search-item" onclick="selectStock('${query.toUpperCase()}', '${query.toUpperCase()}')">Use "${query.toUpperCase()}" as ticker</div>`;
-                    } else {
-                        results.innerHTML = `<div class="search-item" onclick="selectStock('${query.toUpperCase()}', '${query.toUpperCase()}')">Use "${query.toUpperCase()}" as ticker</div>`;
-                    }
-                })
-                .catch(() => {
-                    const ticker = query.toUpperCase();
-                    results.innerHTML = `<div class="search-item" onclick="selectStock('${ticker}', '${ticker}')">Use "${ticker}" as ticker</div>`;
-                });
-            }, 300);
-        }
-        function selectStock(ticker, name) {
-            document.getElementById('ticker').value = ticker.toUpperCase();
-            document.getElementById('stockName').value = name;
-            document.getElementById('stock-search').value = '';
-            document.getElementById('stock-results').style.display = 'none';
-        }
-        function searchWeather(query) {
-            clearTimeout(searchTimeout);
-            if (query.length < 2) {
-                document.getElementById('weather-results').style.display = 'none';
-                return;
-            }
-            const results = document.getElementById('weather-results');
-            results.innerHTML = '<div class="search-item">Searching...</div>';
-            results.style.display = 'block';
-            searchTimeout = setTimeout(() => {
-                fetch(`https://geocoding-api.open-meteo.com/v1/search?name=${encodeURIComponent(query)}&count=5&language=en&format=json`)
-                .then(r => r.json())
-                .then(d => {
-                    results.innerHTML = (d.results || []).map(city => `
-                        <div class="search-item" onclick="selectWeather('${city.name.replace(/'/g, "\\'")}', ${city.latitude}, ${city.longitude})">
-                            ${city.name}${city.admin1 ? ', ' + city.admin1 : ''}${city.country ? ' (' + city.country + ')' : ''}
-                        </div>
-                    `).join('') || '<div class="search-item">No results</div>';
-                })
-                .catch(() => results.innerHTML = '<div class="search-item">Error searching</div>');
-            }, 300);
-        }
-        function selectWeather(location, lat, lon) {
-            document.getElementById('location').value = location;
-            document.getElementById('latitude').value = lat;
-            document.getElementById('longitude').value = lon;
-            document.getElementById('weather-search').value = '';
-            document.getElementById('weather-results').style.display = 'none';
-        }
-        function saveModule() {
-            const type = currentModule.type;
-            const isNew = !modules.find(m => m.id === currentModule.id);
-            let data = {id: currentModule.id, type: type};
-            if (type === 'crypto') {
-                data.cryptoId = document.getElementById('cryptoId').value;
-                data.cryptoSymbol = document.getElementById('cryptoSymbol').value;
-                data.cryptoName = document.getElementById('cryptoName').value;
-                const decimalsInput = document.getElementById('decimals').value;
-                if (decimalsInput !== '' && decimalsInput !== 'auto') {
-                    data.decimals = parseInt(decimalsInput);
-                }
-                if (!data.cryptoId) { showMessage('Please search and select a cryptocurrency', 'error'); return; }
-            } else if (type === 'stock') {
-                data.ticker = document.getElementById('ticker').value;
-                data.name = document.getElementById('stockName').value;
-                const decimalsInput = document.getElementById('decimals').value;
-                if (decimalsInput !== '' && decimalsInput !== 'auto') {
-                    data.decimals = parseInt(decimalsInput);
-                }
-                if (!data.ticker) { showMessage('Please enter a ticker symbol', 'error'); return; }
-            } else if (type === 'weather') {
-                data.location = document.getElementById('location').value;
-                data.latitude = parseFloat(document.getElementById('latitude').value);
-                data.longitude = parseFloat(document.getElementById('longitude').value);
-                if (!data.location || data.latitude === 0 || data.longitude === 0) {
-                    showMessage('Please search and select a location', 'error');
-                    return;
-                }
-            } else if (type === 'custom') {
-                data.label = document.getElementById('label').value;
-                data.value = parseFloat(document.getElementById('value').value) || 0;
-                data.unit = document.getElementById('unit').value;
-                if (!data.label) { showMessage('Please enter a label', 'error'); return; }
-            } else if (type === 'quad') {
-                data.slot1 = document.getElementById('slot1').value;
-                data.slot2 = document.getElementById('slot2').value;
-                data.slot3 = document.getElementById('slot3').value;
-                data.slot4 = document.getElementById('slot4').value;
-            }
-            const url = isNew ? '/api/modules' : '/api/modules/update';
-            fetch(url, {
-                method: 'POST',
-                headers: {'Authorization': token, 'Content-Type': 'application/json'},
-                body: JSON.stringify(data)
-            })
-            .then(r => r.json())
-            .then(d => {
-                if (d.success || d.id) {
-                    closeModal();
-                    loadModules();
-                    showMessage(isNew ? 'Module added successfully' : 'Module updated successfully', 'success');
-                } else {
-                    showMessage(d.error || 'Failed to save module', 'error');
-                }
-            })
-            .catch(e => showMessage('Failed to save module', 'error'));
-        }
-        function deleteModule(id) {
-            if (!confirm('Are you sure you want to delete this module?')) return;
-            fetch('/api/modules/delete', {
-                method: 'POST',
-                headers: {'Authorization': token, 'Content-Type': 'application/json'},
-                body: JSON.stringify({id: id})
-            })
-            .then(r => r.json())
-            .then(d => {
-                if (d.success) {
-                    loadModules();
-                    showMessage('Module deleted', 'success');
-                } else {
-                    showMessage(d.error || 'Failed to delete module', 'error');
-                }
-            })
-            .catch(e => showMessage('Failed to delete module', 'error'));
-        }
-        function saveDeviceSettings() {
-            const currency = document.getElementById('currency').value;
-            const thousandSep = document.getElementById('thousandSep').value;
-            fetch('/api/config', {
-                method: 'POST',
-                headers: {'Authorization': token, 'Content-Type': 'application/json'},
-                body: JSON.stringify({device: {currency: currency, thousandSep: thousandSep}})
-            })
-            .then(r => r.json())
-            .then(d => showMessage('Settings saved', 'success'))
-            .catch(e => showMessage('Failed to save settings', 'error'));
-        }
-        function restartDevice() {
-            if (!confirm('Restart device? This will disconnect you.')) return;
-            fetch('/api/restart', {
-                method: 'POST',
-                headers: {'Authorization': token}
-            })
-            .then(() => {
-                showMessage('Device restarting...', 'success');
-                setTimeout(logout, 2000);
-            })
-            .catch(e => showMessage('Failed to restart', 'error'));
-        }
-        function factoryReset() {
-            if (!confirm('Factory reset? This will erase ALL settings and data!')) return;
-            if (!confirm('Are you ABSOLUTELY sure? This cannot be undone!')) return;
-            fetch('/api/factory-reset', {
-                method: 'POST',
-                headers: {'Authorization': token}
-            })
-            .then(() => {
-                showMessage('Factory reset initiated...', 'success');
-                setTimeout(logout, 2000);
-            })
-            .catch(e => showMessage('Failed to reset', 'error'));
-        }
-        function closeModal() {
-            document.getElementById('module-modal').classList.remove('active');
-            currentModule = null;
-        }
-        function showMessage(msg, type = 'success') {
-            const el = document.getElementById('message');
-            el.textContent = msg;
-            el.className = `message ${type}`;
-            el.classList.remove('hidden');
-            setTimeout(() => el.classList.add('hidden'), 5000);
-        }
-    </script>
-</body>
-</html>)rawliteral";
-
 NetworkManager::NetworkManager()
-    : server(nullptr), isAPMode(false), isSettingsMode(false), lastReconnectAttempt(0),
+    : server(nullptr), isAPMode(false), isSettingsMode(false),
+      linkState(LINK_DOWN), linkUpEvent(false), linkDownEvent(false), disconnectReason(0),
+      eventsRegistered(false), linkDownSince(0), nextReconnectAt(0), reconnectFailures(0),
+      associateStart(0), associateFast(false), wifiStats{0, false, 0, 0, 0, 0, 0, 0},
       cachedScanResults("[]"), lastScanTime(0), scanInProgress(false),
-      clientWasConnected(false) {
+      clientWasConnected(false), eventSubscription(-1), pendingRestart(RESTART_NONE),
+      restartRequestedAt(0), restartFlushedAt(0) {
 }
 
 NetworkManager::~NetworkManager() {
@@ -792,25 +123,127 @@ bool NetworkManager::connectWiFi(const char* ssid, const char* password, uint16_
     Serial.println(ssid);
 
     WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
-
+    WiFi.setAutoReconnect(false);  // maintainConnection() reconnects with backoff instead
+    registerWiFiEvents();
     unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < timeout) {
-        delay(500);
-        Serial.print(".");
+
+    // Straight to the last good AP - skips the channel scan
+    uint8_t bssid[6];
+    int32_t channel;
+    bool fast = loadCachedAP(bssid, channel);
+    if (fast) {
+        Serial.printf("Trying cached AP %02X:%02X:%02X:%02X:%02X:%02X on channel %d\n",
+                      bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5], channel);
+        applyCachedLease();
+        WiFi.begin(ssid, password, channel, bssid);
+        if (!waitForAssociation(startTime, WIFI_FAST_CONNECT_TIMEOUT)) {
+            Serial.println("Cached AP not reachable, scanning");
+            WiFi.disconnect();
+            wifiStats.fastFallbacks++;
+            fast = false;
+        }
+    }
+
+    if (!fast) {
+        WiFi.begin(ssid, password);
+        waitForAssociation(startTime, timeout);
     }
-    Serial.println();
 
     if (WiFi.status() == WL_CONNECTED) {
+        recordAssociation(millis() - startTime, fast);
         Serial.println("WiFi connected!");
         Serial.print("IP: ");
         Serial.println(WiFi.localIP());
         isAPMode = false;
+        linkState = LINK_UP;
+        linkDownEvent = false;  // Failed cached-AP attempt above
+        rememberAP();
         return true;
     } else {
         Serial.println("WiFi connection failed");
+        linkState = LINK_DOWN;
+        linkDownSince = millis();
+        nextReconnectAt = linkDownSince + WIFI_BACKOFF_MIN;
+        return false;
+    }
+}
+
+bool NetworkManager::waitForAssociation(unsigned long start, unsigned long timeout) {
+    unsigned long lastDot = millis();
+    while (WiFi.status() != WL_CONNECTED && (millis() - start) < timeout) {
+        delay(20);  // Short poll so time-to-associate is measured closely
+        if (millis() - lastDot >= 500) {
+            Serial.print(".");
+            lastDot = millis();
+        }
+    }
+    Serial.println();
+    return WiFi.status() == WL_CONNECTED;
+}
+
+bool NetworkManager::loadCachedAP(uint8_t bssid[6], int32_t& channel) {
+    String text = config["wifi"]["bssid"] | "";
+    channel = config["wifi"]["channel"] | 0;
+    if (channel <= 0 || text.length() != 17) {
+        return false;
+    }
+
+    unsigned int b[6];
+    if (sscanf(text.c_str(), "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6) {
         return false;
     }
+    for (uint8_t i = 0; i < 6; i++) {
+        bssid[i] = b[i];
+    }
+    return true;
+}
+
+void NetworkManager::applyCachedLease() {
+    // Opt-in: reusing the last DHCP lease saves the DHCP exchange, but only
+    // suits networks where the router keeps reserving the same address
+    if (!(config["wifi"]["reuseLease"] | false)) return;
+
+    JsonObject lease = config["wifi"]["lease"];
+    IPAddress ip, gateway, subnet, dns;
+    if (lease.isNull() || !ip.fromString(lease["ip"] | "") || !gateway.fromString(lease["gateway"] | "") ||
+        !subnet.fromString(lease["subnet"] | "") || !dns.fromString(lease["dns"] | "")) {
+        return;
+    }
+    WiFi.config(ip, gateway, subnet, dns);
+}
+
+void NetworkManager::rememberAP() {
+    JsonObject wifi = config["wifi"];
+    String bssid = WiFi.BSSIDstr();
+    int32_t channel = WiFi.channel();
+    String ip = WiFi.localIP().toString();
+
+    // Only write flash when the AP (or address) actually changed
+    if (bssid == (wifi["bssid"] | "") && channel == (wifi["channel"] | 0) &&
+        ip == (wifi["lease"]["ip"] | "")) {
+        return;
+    }
+
+    wifi["bssid"] = bssid;
+    wifi["channel"] = channel;
+    JsonObject lease = wifi.containsKey("lease") ? wifi["lease"].as<JsonObject>() : wifi.createNestedObject("lease");
+    lease["ip"] = ip;
+    lease["gateway"] = WiFi.gatewayIP().toString();
+    lease["subnet"] = WiFi.subnetMask().toString();
+    lease["dns"] = WiFi.dnsIP().toString();
+    saveConfiguration(true);
+    Serial.println("Cached AP details updated");
+}
+
+void NetworkManager::recordAssociation(unsigned long ms, bool fast) {
+    wifiStats.lastAssociateMs = ms;
+    wifiStats.lastFastPath = fast;
+    if (fast) {
+        wifiStats.fastConnects++;
+    } else {
+        wifiStats.fullConnects++;
+    }
+    Serial.printf("WiFi associated in %lums (%s)\n", ms, fast ? "cached AP" : "scan");
 }
 
 void NetworkManager::startConfigAP() {
@@ -872,11 +305,11 @@ void NetworkManager::startConfigAP() {
 }
 
 void NetworkManager::setupWebServer() {
-    server = new WebServer(80);
+    server = new EventWebServer(80);
 
     // Root page
     server->on("/", [this]() {
-        server->send_P(200, "text/html", PORTAL_HTML);
+        sendGzipPage(PORTAL_HTML_GZ, PORTAL_HTML_GZ_LEN, PORTAL_HTML_ETAG);
     });
 
     // Scan endpoint
@@ -908,14 +341,18 @@ void NetworkManager::handleSave() {
         if (!error) {
             config["wifi"]["ssid"] = doc["ssid"].as<String>();
             config["wifi"]["password"] = doc["password"].as<String>();
+            // Different network - the cached AP and lease no longer apply
+            config["wifi"].remove("bssid");
+            config["wifi"].remove("channel");
+            config["wifi"].remove("lease");
             config["device"]["activeModule"] = doc["module"].as<String>();
 
             saveConfiguration();
 
             server->send(200, "text/plain", "OK");
 
-            delay(1000);
-            ESP.restart();
+            flushConfiguration();  // Restarting: the deferred save must reach flash first
+            scheduleRestart(RESTART_REBOOT);
         } else {
             server->send(400, "text/plain", "Invalid JSON");
         }
@@ -937,22 +374,146 @@ bool NetworkManager::isConnected() {
     return WiFi.status() == WL_CONNECTED;
 }
 
-void NetworkManager::reconnect() {
-    if (isAPMode) return;
+void NetworkManager::registerWiFiEvents() {
+    if (eventsRegistered) return;
+    eventsRegistered = true;
+
+    // Runs on the WiFi event task: only raise flags, loop() does the work
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+        switch (event) {
+            case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+                linkUpEvent = true;
+                break;
+            case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+                disconnectReason = info.wifi_sta_disconnected.reason;
+                linkDownEvent = true;
+                break;
+            case ARDUINO_EVENT_WIFI_STA_LOST_IP:
+                linkDownEvent = true;
+                break;
+            default:
+                break;
+        }
+    });
+}
+
+void NetworkManager::maintainConnection() {
+    if (isAPMode || !eventsRegistered) return;
 
     unsigned long now = millis();
-    if (now - lastReconnectAttempt < 30000) return;
 
-    lastReconnectAttempt = now;
+    if (linkUpEvent) {
+        linkUpEvent = false;
+        linkDownEvent = false;  // Stale failure of an earlier attempt
+        if (linkState != LINK_UP) {
+            onLinkUp(now);
+        }
+    }
+
+    if (linkDownEvent) {
+        linkDownEvent = false;
+        // While connecting, the driver reports every failed association;
+        // the attempt timeout below decides when to try again
+        if (linkState == LINK_UP) {
+            onLinkDown(now);
+        }
+    }
+
+    // Missed event safety net
+    if (linkState == LINK_UP && WiFi.status() != WL_CONNECTED) {
+        onLinkDown(now);
+    }
+
+    if (linkState == LINK_CONNECTING) {
+        unsigned long timeout = associateFast ? WIFI_FAST_CONNECT_TIMEOUT : WIFI_SCAN_CONNECT_TIMEOUT;
+        if (now - associateStart < timeout) return;
+
+        if (associateFast) {
+            // Cached AP didn't answer - scan right away, no backoff yet
+            Serial.println("Cached AP not reachable, scanning");
+            wifiStats.fastFallbacks++;
+            startReconnect(now);
+            return;
+        }
+
+        reconnectFailures++;
+        unsigned long wait = reconnectDelay();
+        Serial.printf("WiFi reconnect failed, retrying in %lums\n", wait);
+        linkState = LINK_DOWN;
+        associateStart = 0;
+        nextReconnectAt = now + wait;
+        return;
+    }
+
+    if (linkState == LINK_DOWN && (long)(now - nextReconnectAt) >= 0) {
+        startReconnect(now);
+    }
+}
+
+void NetworkManager::onLinkUp(unsigned long now) {
+    if (associateStart) {
+        recordAssociation(now - associateStart, associateFast);
+    }
+    if (linkDownSince) {
+        wifiStats.lastOutageMs = now - linkDownSince;
+        Serial.printf("WiFi link up after %lums offline\n", wifiStats.lastOutageMs);
+    }
+    linkState = LINK_UP;
+    linkDownSince = 0;
+    reconnectFailures = 0;
+    associateStart = 0;
+    associateFast = false;
+    rememberAP();
+}
+
+void NetworkManager::onLinkDown(unsigned long now) {
+    Serial.print("WiFi link lost (reason ");
+    Serial.print(disconnectReason);
+    Serial.println(")");
+    wifiStats.linkDrops++;
+    linkState = LINK_DOWN;
+    linkDownSince = now;
+    reconnectFailures = 0;
+    nextReconnectAt = now;  // First attempt right away
+}
 
+void NetworkManager::startReconnect(unsigned long now) {
     String ssid = config["wifi"]["ssid"] | "";
     String password = config["wifi"]["password"] | "";
 
-    if (ssid.length() == 0) return;
+    if (ssid.length() == 0) {
+        nextReconnectAt = now + WIFI_BACKOFF_MAX;
+        linkState = LINK_DOWN;
+        return;
+    }
+
+    // Alternate: direct connect to the last AP, then a scan if that didn't answer
+    uint8_t bssid[6];
+    int32_t channel;
+    bool fast = !(linkState == LINK_CONNECTING && associateFast) && loadCachedAP(bssid, channel);
 
-    Serial.println("Reconnecting to WiFi...");
+    Serial.println(fast ? "Reconnecting to WiFi (cached AP)..." : "Reconnecting to WiFi...");
     WiFi.disconnect();
-    WiFi.begin(ssid.c_str(), password.c_str());
+    if (fast) {
+        applyCachedLease();
+        WiFi.begin(ssid.c_str(), password.c_str(), channel, bssid);
+    } else {
+        WiFi.begin(ssid.c_str(), password.c_str());
+    }
+    linkState = LINK_CONNECTING;
+    associateStart = now;
+    associateFast = fast;
+    wifiStats.reconnectAttempts++;
+}
+
+unsigned long NetworkManager::reconnectDelay() {
+    // Exponential: 1s, 2s, 4s ... capped, with +/-20% jitter so APs rebooting
+    // after a power cut aren't hit by every device at once
+    uint8_t shift = reconnectFailures > 7 ? 6 : reconnectFailures - 1;
+    unsigned long base = WIFI_BACKOFF_MIN << shift;
+    if (base > WIFI_BACKOFF_MAX) base = WIFI_BACKOFF_MAX;
+    long jitter = base / 5;
+    return base + random(-jitter, jitter + 1);
 }
 
 void NetworkManager::handleClient() {
@@ -963,70 +524,255 @@ void NetworkManager::handleClient() {
     if (isAPMode) {
         updateScanResults();
     }
+
+    if (pendingRestart != RESTART_NONE) {
+        finishPendingRestart();
+    }
 }
 
-bool NetworkManager::httpGet(const char* url, String& response, String& errorMsg) {
-    WiFiClientSecure* client = new WiFiClientSecure;
-    if (!client) {
-        errorMsg = "Out of memory";
-        return false;
+void NetworkManager::scheduleRestart(PendingRestart kind) {
+    pendingRestart = kind;
+    restartRequestedAt = millis();
+    restartFlushedAt = 0;
+}
+
+void NetworkManager::finishPendingRestart() {
+    // The reply announcing the restart goes out first: wait until the server
+    // has handed every response to the socket, then give lwIP a moment to
+    // transmit the last segments
+    unsigned long now = millis();
+    bool overdue = now - restartRequestedAt >= RESTART_MAX_WAIT;
+    if (server && server->isWriting() && !overdue) {
+        restartFlushedAt = 0;
+        return;
+    }
+    if (restartFlushedAt == 0) {
+        restartFlushedAt = now;
+        return;
+    }
+    if (now - restartFlushedAt < RESTART_GRACE && !overdue) {
+        return;
     }
 
-    client->setInsecure();
+    if (pendingRestart == RESTART_FACTORY_RESET) {
+        configJournal.stop();  // A queued config write must not land after the format
+        LittleFS.format();
+    }
+    ESP.restart();
+}
 
-    HTTPClient https;
-    https.begin(*client, url);
-    https.setTimeout(15000);
+bool NetworkManager::httpGet(const char* url, String& response, String& errorMsg, int* httpCode, FetchTrace* trace) {
+    return httpRequest(url, false, &response, nullptr, JsonVariantConst(), false, errorMsg, httpCode, trace);
+}
 
-    int httpCode = https.GET();
+bool NetworkManager::httpGetWithHeaders(const char* url, String& response, String& errorMsg, int* httpCode, FetchTrace* trace) {
+    return httpRequest(url, true, &response, nullptr, JsonVariantConst(), false, errorMsg, httpCode, trace);
+}
 
-    if (httpCode == HTTP_CODE_OK) {
-        response = https.getString();
-        https.end();
-        delete client;
-        return true;
-    } else {
-        errorMsg = "HTTP " + String(httpCode);
-        https.end();
-        delete client;
-        return false;
+bool NetworkManager::httpGetJson(const FetchRequest& request, JsonDocument& doc, String& errorMsg, int* httpCode, FetchTrace* trace) {
+    JsonVariantConst filter = request.filter ? request.filter->as<JsonVariantConst>() : JsonVariantConst();
+    return httpRequest(request.url.c_str(), request.withHeaders, nullptr, &doc, filter,
+                       request.useCache, errorMsg, httpCode, trace);
+}
+
+// Split "https://host[:port]/path" into host and port
+static bool parseUrlHost(const char* url, String& host, uint16_t& port) {
+    String s = String(url);
+    int start = s.indexOf("://");
+    if (start < 0) return false;
+    start += 3;
+
+    int end = s.indexOf('/', start);
+    if (end < 0) end = s.length();
+    host = s.substring(start, end);
+
+    port = s.startsWith("https") ? 443 : 80;
+    int colon = host.indexOf(':');
+    if (colon >= 0) {
+        port = host.substring(colon + 1).toInt();
+        host = host.substring(0, colon);
     }
+    return host.length() > 0;
 }
 
-bool NetworkManager::httpGetWithHeaders(const char* url, String& response, String& errorMsg) {
-    WiFiClientSecure* client = new WiFiClientSecure;
-    if (!client) {
-        errorMsg = "Out of memory";
+bool NetworkManager::httpRequest(const char* url, bool browserHeaders, String* response, JsonDocument* doc,
+                                 JsonVariantConst filter, bool useCache, String& errorMsg, int* httpCode, FetchTrace* trace) {
+    FetchTrace localTrace;
+    if (!trace) trace = &localTrace;
+    if (httpCode) *httpCode = 0;
+
+    String host;
+    uint16_t port;
+    if (!parseUrlHost(url, host, port)) {
+        errorMsg = "Invalid URL";
         return false;
     }
 
-    client->setInsecure();
+    // Still within max-age: skip the request entirely
+    String cacheKey = String(url);
+    if (useCache && httpCache.isFresh(cacheKey)) {
+        if (httpCode) *httpCode = HTTP_CODE_NOT_MODIFIED;
+        return true;
+    }
+
+    String etag, lastModified;
+    if (useCache) {
+        httpCache.getValidators(cacheKey, etag, lastModified);
+    }
 
-    HTTPClient https;
-    https.begin(*client, url);
-    https.setTimeout(15000);
+    // Up to two attempts: a pooled connection may have been closed by the server
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        bool reused = false;
+        WiFiClientSecure* client = connectionPool.acquire(host, port, reused);
+        if (!client) {
+            errorMsg = "Out of memory";
+            return false;
+        }
 
-    // Add User-Agent header for Yahoo Finance API
-    https.addHeader("User-Agent", "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/91.0.4472.124 Safari/537.36");
-    https.addHeader("Accept", "application/json");
-    https.addHeader("Accept-Encoding", "gzip, deflate");
-    https.addHeader("DNT", "1");
-    https.addHeader("Connection", "keep-alive");
-    https.addHeader("Upgrade-Insecure-Requests", "1");
+        // DNS, then TCP + TLS handshake - all skipped on a kept-alive connection
+        uint32_t t;
+        if (!reused) {
+            // DNS on its own so it can be timed (lwIP caches it for connect below)
+            t = micros();
+            IPAddress ip;
+            if (!WiFi.hostByName(host.c_str(), ip)) {
+                errorMsg = "DNS lookup failed";
+                if (httpCode) *httpCode = HTTPC_ERROR_CONNECTION_REFUSED;
+                connectionPool.release(client, false);
+                return false;
+            }
+            trace->us[PHASE_DNS] = micros() - t;
 
-    int httpCode = https.GET();
+            client->setInsecure();
+            client->setHandshakeTimeout(15);
 
-    if (httpCode == HTTP_CODE_OK) {
-        response = https.getString();
-        https.end();
-        delete client;
-        return true;
-    } else {
-        errorMsg = "HTTP " + String(httpCode);
+            t = micros();
+            if (!client->connect(host.c_str(), port)) {
+                errorMsg = "Connection failed";
+                if (httpCode) *httpCode = HTTPC_ERROR_CONNECTION_REFUSED;
+                connectionPool.release(client, false);
+                return false;
+            }
+            trace->us[PHASE_CONNECT] = micros() - t;
+            connectionPool.recordHandshake(trace->us[PHASE_CONNECT]);
+        }
+
+        // HTTPClient sees the open socket and sends on it
+        HTTPClient https;
+        https.setReuse(true);  // Keep the socket open after end() unless the server says close
+        https.begin(*client, url);
+        https.setTimeout(15000);
+
+        // Compressed bodies cost less airtime; decoded below
+        https.addHeader("Accept-Encoding", "gzip, deflate");
+
+        // Conditional request: the server answers 304 if nothing changed
+        if (etag.length() > 0) {
+            https.addHeader("If-None-Match", etag);
+        }
+        if (lastModified.length() > 0) {
+            https.addHeader("If-Modified-Since", lastModified);
+        }
+
+        if (browserHeaders) {
+            // Add User-Agent header for Yahoo Finance API
+            https.addHeader("User-Agent", "Mozilla/5.0 (Windows NT 10.0; Win64; x64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/91.0.4472.124 Safari/537.36");
+            https.addHeader("Accept", "application/json");
+            https.addHeader("DNT", "1");
+            https.addHeader("Upgrade-Insecure-Requests", "1");
+        }
+
+        // Needed to read chunked and compressed bodies ourselves, and for caching
+        const char* bodyHeaders[] = {"Transfer-Encoding", "Content-Encoding",
+                                     "ETag", "Last-Modified", "Cache-Control", "Age"};
+        https.collectHeaders(bodyHeaders, 6);
+
+        // GET returns once the status line and headers are in
+        t = micros();
+        int code = https.GET();
+        trace->us[PHASE_FIRST_BYTE] = micros() - t;
+
+        if (code < 0 && reused) {
+            // Stale keep-alive connection - retry once on a fresh one
+            https.end();
+            connectionPool.release(client, false);
+            connectionPool.recordStaleRetry();
+            continue;
+        }
+        if (httpCode) *httpCode = code;
+
+        bool success = false;
+        if (code == HTTP_CODE_OK) {
+            t = micros();
+            bool chunked = https.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+            String encoding = https.header("Content-Encoding");
+            encoding.toLowerCase();
+            bool compressed = (encoding == "gzip" || encoding == "deflate");
+
+            if (encoding.length() > 0 && encoding != "identity" && !compressed) {
+                errorMsg = "Unsupported content encoding: " + encoding;
+            } else if (!compressed && !doc) {
+                // Plain body into a String (HTTPClient handles chunking)
+                *response = https.getString();
+                trace->wireBytes = trace->bodyBytes = response->length();
+                success = true;
+            } else {
+                // Socket -> (inflate) -> JSON parser or String, never holding the compressed body
+                HttpBodyStream body(*client, https.getSize(), chunked);
+                InflateStream inflater(body, encoding == "gzip" ? InflateStream::GZIP : InflateStream::DEFLATE);
+                Stream& source = compressed ? (Stream&)inflater : (Stream&)body;
+
+                if (doc) {
+                    // The filter drops fields we never read
+                    DeserializationError error = filter.isNull()
+                        ? deserializeJson(*doc, source)
+                        : deserializeJson(*doc, source, DeserializationOption::Filter(filter));
+                    if (error) {
+                        errorMsg = "JSON parse error: " + String(error.c_str());
+                    }
+                    success = !error;
+                } else {
+                    char chunk[256];
+                    size_t n;
+                    while ((n = source.readBytes(chunk, sizeof(chunk))) > 0) {
+                        response->concat(chunk, n);
+                    }
+                    success = true;
+                }
+
+                if (compressed && inflater.hasError()) {
+                    errorMsg = "Decompression failed (" + encoding + ")";
+                    success = false;
+                }
+
+                body.drain();
+                trace->wireBytes = body.getBytesRead();
+                trace->bodyBytes = compressed ? inflater.getBytesOut() : trace->wireBytes;
+                trace->inflateUs = inflater.getInflateUs();
+            }
+            trace->us[PHASE_BODY] = micros() - t;
+
+            if (success && useCache) {
+                httpCache.storeResponse(cacheKey, https.header("ETag"), https.header("Last-Modified"),
+                                        https.header("Cache-Control"), https.header("Age"));
+            }
+        } else if (code == HTTP_CODE_NOT_MODIFIED && useCache) {
+            // Unchanged since the validators were stored - nothing to read or parse
+            httpCache.recordNotModified(cacheKey, https.header("Cache-Control"), https.header("Age"));
+            success = true;
+        } else {
+            errorMsg = "HTTP " + String(code);
+        }
+
+        // Only a fully read response leaves the socket clean enough to reuse
         https.end();
-        delete client;
-        return false;
+        connectionPool.release(client, success);
+        return success;
     }
+
+    errorMsg = "Connection lost";
+    if (httpCode) *httpCode = HTTPC_ERROR_CONNECTION_LOST;
+    return false;
 }
 
 void NetworkManager::startWiFiScan() {
@@ -1129,6 +875,8 @@ void NetworkManager::startSettingsServer() {
 
 void NetworkManager::stopSettingsServer() {
     if (server && isSettingsMode) {
+        eventBus.unsubscribe(eventSubscription);
+        eventSubscription = -1;
         delete server;
         server = nullptr;
         isSettingsMode = false;
@@ -1149,8 +897,8 @@ String NetworkManager::getLocalIP() {
 
 void NetworkManager::setupSettingsServer() {
     Serial.println("\n=== Setting up Settings Server ===");
-    server = new WebServer(80);
-    Serial.println("WebServer created on port 80");
+    server = new EventWebServer(80);
+    Serial.println("EventWebServer created on port 80");
 
     // Settings page root - serve new dynamic interface
     server->on("/", [this]() {
@@ -1232,32 +980,33 @@ void NetworkManager::setupSettingsServer() {
         Serial.print("Ticker: ");
         Serial.println(ticker);
 
-        // Force a fetch
+        // Force a fetch and answer once it lands - other clients are served meanwhile
         scheduler.requestFetch("stock", true);
-
-        // Wait a bit for fetch to complete
-        delay(3000);
-
-        // Get status
-        JsonObject stock = config["modules"]["stock"];
-        float price = stock["value"] | 0.0;
-        float change = stock["change"] | 0.0;
-        unsigned long lastUpdate = stock["lastUpdate"] | 0;
-        bool lastSuccess = stock["lastSuccess"] | false;
-
-        String response = "{";
-        response += "\"ticker\":\"" + String(ticker) + "\",";
-        response += "\"price\":" + String(price, 2) + ",";
-        response += "\"change\":" + String(change, 2) + ",";
-        response += "\"lastUpdate\":" + String(lastUpdate) + ",";
-        response += "\"lastSuccess\":" + String(lastSuccess ? "true" : "false");
-        response += "}";
-
-        Serial.println("Test response:");
-        Serial.println(response);
-        Serial.println("=== END TEST ===\n");
-
-        server->send(200, "application/json", response);
+        ResponseHandle handle = server->defer();
+        scheduler.onFetchComplete("stock", [this, handle, ticker]() {
+            if (!server) return;
+
+            // Get status
+            const ModuleReading& stock = readings.read("stock");
+            float price = stock.value;
+            float change = stock.change;
+            unsigned long lastUpdate = stock.lastUpdate;
+            bool lastSuccess = stock.lastSuccess;
+
+            String response = "{";
+            response += "\"ticker\":\"" + String(ticker) + "\",";
+            response += "\"price\":" + String(price, 2) + ",";
+            response += "\"change\":" + String(change, 2) + ",";
+            response += "\"lastUpdate\":" + String(lastUpdate) + ",";
+            response += "\"lastSuccess\":" + String(lastSuccess ? "true" : "false");
+            response += "}";
+
+            Serial.println("Test response:");
+            Serial.println(response);
+            Serial.println("=== END TEST ===\n");
+
+            server->sendDeferred(handle, 200, "application/json", response);
+        });
     };
 
     server->on("/api/test-stock", HTTP_POST, testStockHandler);
@@ -1274,34 +1023,35 @@ void NetworkManager::setupSettingsServer() {
         bool hasBitcoin = scheduler.hasModule("bitcoin");
         int moduleCount = scheduler.getModuleCount();
 
-        // Force a stock fetch
+        // Force a stock fetch, answer when it completes
         scheduler.requestFetch("stock", true);
-
-        // Wait a moment
-        delay(3000);
-
-        // Check result
-        JsonObject stock = config["modules"]["stock"];
-        unsigned long lastUpdate = stock["lastUpdate"] | 0;
-        float value = stock["value"] | 0.0;
-        bool success = stock["lastSuccess"] | false;
-        String error = stock["lastError"] | "";
-
-        String response = "{";
-        response += "\"triggered\":true,";
-        response += "\"moduleCount\":" + String(moduleCount) + ",";
-        response += "\"hasStock\":" + String(hasStock ? "true" : "false") + ",";
-        response += "\"hasBitcoin\":" + String(hasBitcoin ? "true" : "false") + ",";
-        response += "\"lastUpdate\":" + String(lastUpdate) + ",";
-        response += "\"value\":" + String(value) + ",";
-        response += "\"lastSuccess\":" + String(success ? "true" : "false") + ",";
-        response += "\"lastError\":\"" + error + "\"";
-        response += "}";
-
-        Serial.println("=== Force stock result ===");
-        Serial.println(response);
-
-        server->send(200, "application/json", response);
+        ResponseHandle handle = server->defer();
+        scheduler.onFetchComplete("stock", [this, handle, hasStock, hasBitcoin, moduleCount]() {
+            if (!server) return;
+
+            // Check result
+            const ModuleReading& stock = readings.read("stock");
+            unsigned long lastUpdate = stock.lastUpdate;
+            float value = stock.value;
+            bool success = stock.lastSuccess;
+            String error = stock.lastError;
+
+            String response = "{";
+            response += "\"triggered\":true,";
+            response += "\"moduleCount\":" + String(moduleCount) + ",";
+            response += "\"hasStock\":" + String(hasStock ? "true" : "false") + ",";
+            response += "\"hasBitcoin\":" + String(hasBitcoin ? "true" : "false") + ",";
+            response += "\"lastUpdate\":" + String(lastUpdate) + ",";
+            response += "\"value\":" + String(value) + ",";
+            response += "\"lastSuccess\":" + String(success ? "true" : "false") + ",";
+            response += "\"lastError\":\"" + error + "\"";
+            response += "}";
+
+            Serial.println("=== Force stock result ===");
+            Serial.println(response);
+
+            server->sendDeferred(handle, 200, "application/json", response);
+        });
     });
 
     // Force weather fetch endpoint (no auth for debugging)
@@ -1333,44 +1083,50 @@ void NetworkManager::setupSettingsServer() {
             Serial.print("Found weather module: ");
             Serial.println(weatherModuleId);
             scheduler.requestFetch(weatherModuleId.c_str(), true);
-            delay(3000);
         } else {
             Serial.println("No weather module found in moduleOrder");
         }
 
-        // Check result
-        JsonObject weather;
-        if (weatherModuleId.length() > 0) {
-            weather = config["modules"][weatherModuleId];
-        }
-        unsigned long lastUpdate = weather["lastUpdate"] | 0;
-        float temp = weather["temperature"] | 0.0;
-        String condition = weather["condition"] | "Unknown";
-        String location = weather["location"] | "Unknown";
-        float latitude = weather["latitude"] | 0.0;
-        float longitude = weather["longitude"] | 0.0;
-        bool success = weather["lastSuccess"] | false;
-        String error = weather["lastError"] | "";
-
-        String response = "{";
-        response += "\"triggered\":true,";
-        response += "\"weatherModuleId\":\"" + weatherModuleId + "\",";
-        response += "\"moduleCount\":" + String(moduleCount) + ",";
-        response += "\"hasWeather\":" + String(hasWeather ? "true" : "false") + ",";
-        response += "\"location\":\"" + location + "\",";
-        response += "\"latitude\":" + String(latitude, 4) + ",";
-        response += "\"longitude\":" + String(longitude, 4) + ",";
-        response += "\"lastUpdate\":" + String(lastUpdate) + ",";
-        response += "\"temperature\":" + String(temp, 1) + ",";
-        response += "\"condition\":\"" + condition + "\",";
-        response += "\"lastSuccess\":" + String(success ? "true" : "false") + ",";
-        response += "\"lastError\":\"" + error + "\"";
-        response += "}";
-
-        Serial.println("=== Force weather result ===");
-        Serial.println(response);
+        // Answer when the fetch completes (right away if nothing was started)
+        ResponseHandle handle = server->defer();
+        scheduler.onFetchComplete(weatherModuleId.c_str(), [this, handle, weatherModuleId, hasWeather, moduleCount]() {
+            if (!server) return;
 
-        server->send(200, "application/json", response);
+            // Check result
+            JsonObject weather;
+            if (weatherModuleId.length() > 0) {
+                weather = config["modules"][weatherModuleId];
+            }
+            const ModuleReading& reading = readings.read(weatherModuleId.c_str());
+            unsigned long lastUpdate = reading.lastUpdate;
+            float temp = reading.temperature;
+            String condition = reading.condition;
+            String location = weather["location"] | "Unknown";
+            float latitude = weather["latitude"] | 0.0;
+            float longitude = weather["longitude"] | 0.0;
+            bool success = reading.lastSuccess;
+            String error = reading.lastError;
+
+            String response = "{";
+            response += "\"triggered\":true,";
+            response += "\"weatherModuleId\":\"" + weatherModuleId + "\",";
+            response += "\"moduleCount\":" + String(moduleCount) + ",";
+            response += "\"hasWeather\":" + String(hasWeather ? "true" : "false") + ",";
+            response += "\"location\":\"" + location + "\",";
+            response += "\"latitude\":" + String(latitude, 4) + ",";
+            response += "\"longitude\":" + String(longitude, 4) + ",";
+            response += "\"lastUpdate\":" + String(lastUpdate) + ",";
+            response += "\"temperature\":" + String(temp, 1) + ",";
+            response += "\"condition\":\"" + condition + "\",";
+            response += "\"lastSuccess\":" + String(success ? "true" : "false") + ",";
+            response += "\"lastError\":\"" + error + "\"";
+            response += "}";
+
+            Serial.println("=== Force weather result ===");
+            Serial.println(response);
+
+            server->sendDeferred(handle, 200, "application/json", response);
+        });
     });
 
     // Debug endpoint to show last save processing
@@ -1426,10 +1182,11 @@ void NetworkManager::setupSettingsServer() {
                 html += "Module ID: " + weatherModuleId + "\n";
                 html += "Type: " + String(weather["type"] | "missing") + "\n";
                 html += "Location: " + String(weather["location"] | "missing") + "\n";
-                html += "Temperature: " + String(weather["temperature"] | 0.0, 1) + "\n";
+                const ModuleReading& reading = readings.read(weatherModuleId.c_str());
+                html += "Temperature: " + String(reading.temperature, 1) + "\n";
                 html += "Latitude: " + String(weather["latitude"] | 0.0, 4) + "\n";
                 html += "Longitude: " + String(weather["longitude"] | 0.0, 4) + "\n";
-                html += "Last Update: " + String(weather["lastUpdate"] | 0) + "\n";
+                html += "Last Update: " + String(reading.lastUpdate) + "\n";
             }
         } else {
             html += "No weather module ID found\n";
@@ -1469,15 +1226,16 @@ void NetworkManager::setupSettingsServer() {
     // Debug endpoint for weather config (no auth for debugging)
     server->on("/api/weather-config", HTTP_GET, [this]() {
         JsonObject weather = config["modules"]["weather"];
+        const ModuleReading& reading = readings.read("weather");
 
         String response = "Weather config in memory:\n\n";
         response += "location: " + String(weather["location"] | "NOT SET") + "\n";
         response += "latitude: " + String(weather["latitude"] | 0.0, 6) + "\n";
         response += "longitude: " + String(weather["longitude"] | 0.0, 6) + "\n";
-        response += "temperature: " + String(weather["temperature"] | 0.0, 1) + "\n";
-        response += "condition: " + String(weather["condition"] | "Unknown") + "\n";
-        response += "lastUpdate: " + String(weather["lastUpdate"] | 0) + "\n";
-        response += "lastSuccess: " + String(weather["lastSuccess"] | false ? "true" : "false") + "\n";
+        response += "temperature: " + String(reading.temperature, 1) + "\n";
+        response += "condition: " + String(reading.condition) + "\n";
+        response += "lastUpdate: " + String(reading.lastUpdate) + "\n";
+        response += "lastSuccess: " + String(reading.lastSuccess ? "true" : "false") + "\n";
 
         // Also check what fields actually exist
         response += "\nField existence check:\n";
@@ -1529,12 +1287,14 @@ void NetworkManager::setupSettingsServer() {
     server->on("/api/status", HTTP_GET, [this]() {
         extern Scheduler scheduler;
 
-        unsigned long now = millis() / 1000;
+        unsigned long now = nowSeconds();
 
         JsonObject stock = config["modules"]["stock"];
         JsonObject bitcoin = config["modules"]["bitcoin"];
-        unsigned long stockLastUpdate = stock["lastUpdate"] | 0;
-        unsigned long btcLastUpdate = bitcoin["lastUpdate"] | 0;
+        const ModuleReading& stockReading = readings.read("stock");
+        const ModuleReading& btcReading = readings.read("bitcoin");
+        unsigned long stockLastUpdate = stockReading.lastUpdate;
+        unsigned long btcLastUpdate = btcReading.lastUpdate;
 
         // Check config
         bool hasStockConfig = stock["ticker"].as<String>().length() > 0;
@@ -1542,17 +1302,24 @@ void NetworkManager::setupSettingsServer() {
 
         String response = "{";
         response += "\"stock_lastUpdate\":" + String(stockLastUpdate) + ",";
-        response += "\"stock_value\":" + String(stock["value"] | 0.0) + ",";
-        response += "\"stock_lastSuccess\":" + String(stock["lastSuccess"] | false ? "true" : "false") + ",";
+        response += "\"stock_value\":" + String(stockReading.value) + ",";
+        response += "\"stock_lastSuccess\":" + String(stockReading.lastSuccess ? "true" : "false") + ",";
         response += "\"stock_ticker\":\"" + stock["ticker"].as<String>() + "\",";
         response += "\"stock_config_exists\":" + String(hasStockConfig ? "true" : "false") + ",";
         response += "\"bitcoin_lastUpdate\":" + String(btcLastUpdate) + ",";
-        response += "\"bitcoin_value\":" + String(bitcoin["value"] | 0.0) + ",";
-        response += "\"bitcoin_lastSuccess\":" + String(bitcoin["lastSuccess"] | false ? "true" : "false") + ",";
+        response += "\"bitcoin_value\":" + String(btcReading.value) + ",";
+        response += "\"bitcoin_lastSuccess\":" + String(btcReading.lastSuccess ? "true" : "false") + ",";
         response += "\"bitcoin_config_exists\":" + String(hasBitcoinConfig ? "true" : "false") + ",";
         response += "\"current_time\":" + String(now) + ",";
-        response += "\"stock_time_since_update\":" + String(now - stockLastUpdate) + ",";
-        response += "\"bitcoin_time_since_update\":" + String(now - btcLastUpdate) + "";
+        response += "\"time_synced\":" + String(isTimeSynced() ? "true" : "false") + ",";
+        response += "\"wifi_associate_ms\":" + String(wifiStats.lastAssociateMs) + ",";
+        response += "\"wifi_fast_path\":" + String(wifiStats.lastFastPath ? "true" : "false") + ",";
+        response += "\"wifi_link_drops\":" + String(wifiStats.linkDrops) + ",";
+        response += "\"wifi_last_outage_ms\":" + String(wifiStats.lastOutageMs) + ",";
+        response += "\"config_saves_requested\":" + String(configJournal.getRequestCount()) + ",";
+        response += "\"config_saves_written\":" + String(configJournal.getWriteCount()) + ",";
+        response += "\"stock_time_since_update\":" + String(timestampAge(stockLastUpdate)) + ",";
+        response += "\"bitcoin_time_since_update\":" + String(timestampAge(btcLastUpdate)) + "";
         response += "}";
         server->send(200, "application/json", response);
     });
@@ -1565,7 +1332,7 @@ void NetworkManager::setupSettingsServer() {
         html += "td,th{border:1px solid #666;padding:8px 12px;text-align:left}";
         html += "th{background:#2d2d2d}</style></head><body>";
         html += "<h2>Crypto Module Configuration</h2>";
-        html += "<p style='color:#888'>v2.6.4 - Auto-Fetch Fix | Auto-refreshes every 3 seconds</p>";
+        html += "<p style='color:#888'>v2.6.4 - Auto-Fetch Fix | Live updates below (reload for a full dump)</p>";
         html += "<table><tr><th>Module</th><th>Field</th><th>Value</th></tr>";
 
         // Bitcoin module
@@ -1574,9 +1341,10 @@ void NetworkManager::setupSettingsServer() {
         html += "<td>cryptoId</td><td>" + String(bitcoin["cryptoId"] | "NOT SET") + "</td></tr>";
         html += "<tr><td>cryptoSymbol</td><td>" + String(bitcoin["cryptoSymbol"] | "NOT SET") + "</td></tr>";
         html += "<tr><td>cryptoName</td><td>" + String(bitcoin["cryptoName"] | "NOT SET") + "</td></tr>";
-        html += "<tr><td>value</td><td>$" + String(bitcoin["value"] | 0.0, 2) + "</td></tr>";
-        html += "<tr><td>lastUpdate</td><td>" + String(bitcoin["lastUpdate"] | 0) + "</td></tr>";
-        html += "<tr><td>lastSuccess</td><td>" + String(bitcoin["lastSuccess"] | false ? "true" : "false") + "</td></tr>";
+        const ModuleReading& bitcoinReading = readings.read("bitcoin");
+        html += "<tr><td>value</td><td>$" + String(bitcoinReading.value, 2) + "</td></tr>";
+        html += "<tr><td>lastUpdate</td><td>" + String(bitcoinReading.lastUpdate) + "</td></tr>";
+        html += "<tr><td>lastSuccess</td><td>" + String(bitcoinReading.lastSuccess ? "true" : "false") + "</td></tr>";
 
         // Ethereum module
         JsonObject ethereum = config["modules"]["ethereum"];
@@ -1584,9 +1352,10 @@ void NetworkManager::setupSettingsServer() {
         html += "<td>cryptoId</td><td>" + String(ethereum["cryptoId"] | "NOT SET") + "</td></tr>";
         html += "<tr><td>cryptoSymbol</td><td>" + String(ethereum["cryptoSymbol"] | "NOT SET") + "</td></tr>";
         html += "<tr><td>cryptoName</td><td>" + String(ethereum["cryptoName"] | "NOT SET") + "</td></tr>";
-        html += "<tr><td>value</td><td>$" + String(ethereum["value"] | 0.0, 2) + "</td></tr>";
-        html += "<tr><td>lastUpdate</td><td>" + String(ethereum["lastUpdate"] | 0) + "</td></tr>";
-        html += "<tr><td>lastSuccess</td><td>" + String(ethereum["lastSuccess"] | false ? "true" : "false") + "</td></tr>";
+        const ModuleReading& ethereumReading = readings.read("ethereum");
+        html += "<tr><td>value</td><td>$" + String(ethereumReading.value, 2) + "</td></tr>";
+        html += "<tr><td>lastUpdate</td><td>" + String(ethereumReading.lastUpdate) + "</td></tr>";
+        html += "<tr><td>lastSuccess</td><td>" + String(ethereumReading.lastSuccess ? "true" : "false") + "</td></tr>";
 
         html += "</table>";
 
@@ -1603,7 +1372,11 @@ void NetworkManager::setupSettingsServer() {
         if (config.overflowed()) {
             html += "<p style='color:#f44336;font-weight:bold'>⚠ WARNING: Config overflowed!</p>";
         }
-        html += "<script>setTimeout(function(){location.reload()},3000);</script>";
+        html += "<h3>Live Module Events</h3>";
+        html += "<pre id='events' style='background:#2d2d2d;padding:10px;overflow:auto;max-height:300px'></pre>";
+        html += "<script>var es=new EventSource('/api/events');es.addEventListener('module',function(e){";
+        html += "var p=document.getElementById('events');";
+        html += "p.textContent=new Date().toLocaleTimeString()+' '+e.data+'\\n'+p.textContent;});</script>";
         html += "</body></html>";
         server->send(200, "text/html", html);
     });
@@ -1617,83 +1390,35 @@ void NetworkManager::setupSettingsServer() {
             return;
         }
 
-        StaticJsonDocument<6144> response;  // Increased from 4096 to 6144 for more modules
-        JsonArray modulesArray = response.createNestedArray("modules");
-
-        // Get module order
-        JsonArray moduleOrder = config["device"]["moduleOrder"];
-
-        for (JsonVariant v : moduleOrder) {
-            String moduleId = v.as<String>();
-            JsonObject moduleConfig = config["modules"][moduleId];
-
-            if (!moduleConfig.isNull()) {
-                JsonObject moduleData = modulesArray.createNestedObject();
-                moduleData["id"] = moduleId;
-                moduleData["type"] = moduleConfig["type"] | "unknown";
-
-                // Copy module-specific fields based on type
-                String type = moduleConfig["type"] | "";
-                if (type == "crypto") {
-                    moduleData["cryptoId"] = moduleConfig["cryptoId"];
-                    moduleData["cryptoSymbol"] = moduleConfig["cryptoSymbol"];
-                    moduleData["cryptoName"] = moduleConfig["cryptoName"];
-                    moduleData["value"] = moduleConfig["value"];
-                    moduleData["change24h"] = moduleConfig["change24h"];
-                } else if (type == "stock") {
-                    moduleData["ticker"] = moduleConfig["ticker"];
-                    moduleData["name"] = moduleConfig["name"];
-                    moduleData["value"] = moduleConfig["value"];
-                    moduleData["change"] = moduleConfig["change"];
-                } else if (type == "weather") {
-                    moduleData["location"] = moduleConfig["location"];
-                    moduleData["latitude"] = moduleConfig["latitude"];
-                    moduleData["longitude"] = moduleConfig["longitude"];
-                    moduleData["temperature"] = moduleConfig["temperature"];
-                    moduleData["condition"] = moduleConfig["condition"];
-                } else if (type == "custom") {
-                    moduleData["label"] = moduleConfig["label"];
-                    moduleData["value"] = moduleConfig["value"];
-                    moduleData["unit"] = moduleConfig["unit"];
-                } else if (type == "quad") {
-                    moduleData["slot1"] = moduleConfig["slot1"];
-                    moduleData["slot2"] = moduleConfig["slot2"];
-                    moduleData["slot3"] = moduleConfig["slot3"];
-                    moduleData["slot4"] = moduleConfig["slot4"];
-                }
-
-                moduleData["lastUpdate"] = moduleConfig["lastUpdate"];
-                moduleData["lastSuccess"] = moduleConfig["lastSuccess"];
+        // Streamed one module at a time - memory use doesn't grow with the module count
+        size_t index = 0;
+        bool first = true;
+        bool opened = false;
+        server->sendChunked(200, "application/json", [this, index, first, opened](Print& out) mutable {
+            if (!opened) {
+                out.print("{\"modules\":[");
+                opened = true;
             }
-        }
-
-        // Check for overflow
-        if (response.overflowed()) {
-            Serial.println("ERROR: /api/modules response overflowed!");
-            server->send(500, "application/json", "{\"error\":\"Too many modules\"}");
-            return;
-        }
 
-        String output;
-        size_t len = serializeJson(response, output);
-
-        // Debug: Log response length and check for control characters
-        Serial.print("GET /api/modules - Response length: ");
-        Serial.print(len);
-        Serial.println(" bytes");
-
-        // Check for invalid characters
-        for (size_t i = 0; i < output.length(); i++) {
-            char c = output.charAt(i);
-            if (c < 32 && c != '\n' && c != '\r' && c != '\t') {
-                Serial.print("WARNING: Invalid control character at position ");
-                Serial.print(i);
-                Serial.print(": 0x");
-                Serial.println((int)c, HEX);
+            // Next configured module in display order
+            JsonArray moduleOrder = config["device"]["moduleOrder"];
+            while (index < moduleOrder.size()) {
+                String moduleId = moduleOrder[index++].as<String>();
+                JsonObject moduleConfig = config["modules"][moduleId];
+                if (moduleConfig.isNull()) {
+                    continue;
+                }
+                if (!first) {
+                    out.print(',');
+                }
+                first = false;
+                writeModuleJson(out, moduleId, moduleConfig);
+                return true;
             }
-        }
 
-        server->send(200, "application/json", output);
+            out.print("]}");
+            return false;
+        });
     });
 
     // POST /api/modules - Add a new module
@@ -1778,19 +1503,13 @@ void NetworkManager::setupSettingsServer() {
             newModule["cryptoId"] = sanitize(doc["cryptoId"] | "bitcoin");
             newModule["cryptoSymbol"] = sanitize(doc["cryptoSymbol"] | "BTC");
             newModule["cryptoName"] = sanitize(doc["cryptoName"] | "Bitcoin");
-            newModule["value"] = 0.0;
-            newModule["change24h"] = 0.0;
         } else if (moduleType == "stock") {
             newModule["ticker"] = sanitize(doc["ticker"] | "AAPL");
             newModule["name"] = sanitize(doc["name"] | "Apple Inc.");
-            newModule["value"] = 0.0;
-            newModule["change"] = 0.0;
         } else if (moduleType == "weather") {
             newModule["location"] = sanitize(doc["location"] | "San Francisco");
             newModule["latitude"] = doc["latitude"] | 0.0;
             newModule["longitude"] = doc["longitude"] | 0.0;
-            newModule["temperature"] = 0.0;
-            newModule["condition"] = "Unknown";
         } else if (moduleType == "custom") {
             newModule["label"] = sanitize(doc["label"] | "My Metric");
             newModule["value"] = doc["value"] | 0.0;
@@ -1801,9 +1520,7 @@ void NetworkManager::setupSettingsServer() {
             newModule["slot3"] = doc["slot3"] | "";
             newModule["slot4"] = doc["slot4"] | "";
         }
-
-        newModule["lastUpdate"] = 0;
-        newModule["lastSuccess"] = false;
+        // Readings (value, lastUpdate, ...) live in the readings store, not config
 
         // Add to module order
         JsonArray moduleOrder = config["device"]["moduleOrder"];
@@ -1862,8 +1579,9 @@ void NetworkManager::setupSettingsServer() {
             }
         }
 
-        // Remove module config
+        // Remove module config and its readings
         config["modules"].remove(moduleId);
+        readings.release(moduleId.c_str());
 
         // Unregister from scheduler
         extern Scheduler scheduler;
@@ -2036,6 +1754,63 @@ void NetworkManager::setupSettingsServer() {
         server->send(200, "application/json", response);
     });
 
+    // GET /api/fetch-stats - Per-module fetch phase timings (microseconds), connection and server stats
+    server->on("/api/fetch-stats", HTTP_GET, [this]() {
+        String token = server->header("Authorization");
+        if (!security.validateSession(token)) {
+            server->send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+            return;
+        }
+
+        extern FetchStats fetchStats;
+        StaticJsonDocument<4096> response;
+        fetchStats.toJson(response.createNestedObject("modules"));
+        connectionPool.toJson(response.createNestedObject("connections"));
+        server->toJson(response.createNestedObject("server"));
+        if (response.overflowed()) {
+            Serial.println("WARNING: /api/fetch-stats response truncated");
+        }
+
+        String output;
+        serializeJson(response, output);
+        server->send(200, "application/json", output);
+    });
+
+    // GET /api/http-cache - Validator cache contents and hit rates, plus the stock search cache
+    server->on("/api/http-cache", HTTP_GET, [this]() {
+        String token = server->header("Authorization");
+        if (!security.validateSession(token)) {
+            server->send(401, "application/json", "{\"error\":\"Unauthorized\"}");
+            return;
+        }
+
+        StaticJsonDocument<4096> response;
+        httpCache.toJson(response.to<JsonObject>());
+        searchCache.toJson(response.createNestedObject("search"));
+        if (response.overflowed()) {
+            Serial.println("WARNING: /api/http-cache response truncated");
+        }
+
+        String output;
+        serializeJson(response, output);
+        server->send(200, "application/json", output);
+    });
+
+    // GET /api/events - Server-Sent Events: "module" deltas as readings, errors or backoff change
+    // (no auth, same data as /api/status; EventSource can't send an Authorization header)
+    server->on("/api/events", HTTP_GET, [this]() {
+        if (!server->beginEventStream()) {
+            server->send(503, "application/json", "{\"error\":\"Too many event streams\"}");
+        }
+    });
+
+    // Forward bus events to every open stream
+    eventSubscription = eventBus.subscribe([this](const char* event, const String& data) {
+        if (server) {
+            server->broadcastEvent(event, data);
+        }
+    });
+
     Serial.println("Registered module management API endpoints");
     Serial.println("  - GET    /api/modules");
     Serial.println("  - POST   /api/modules");
@@ -2043,6 +1818,9 @@ void NetworkManager::setupSettingsServer() {
     Serial.println("  - POST   /api/modules/order");
     Serial.println("  - POST   /api/modules/update");
     Serial.println("  - GET    /api/module-types");
+    Serial.println("  - GET    /api/fetch-stats");
+    Serial.println("  - GET    /api/http-cache");
+    Serial.println("  - GET    /api/events");
 
     Serial.println("Starting WebServer...");
     server->begin();
@@ -2052,7 +1830,74 @@ void NetworkManager::setupSettingsServer() {
 
 // Settings page handlers
 void NetworkManager::handleSettingsRoot() {
-    server->send_P(200, "text/html", SETTINGS_HTML);
+    sendGzipPage(SETTINGS_HTML_GZ, SETTINGS_HTML_GZ_LEN, SETTINGS_HTML_ETAG);
+}
+
+void NetworkManager::sendGzipPage(const uint8_t* data, size_t length, const char* etag) {
+    // no-cache = revalidate every load, so an unchanged page costs one small 304
+    server->sendHeader("ETag", etag);
+    server->sendHeader("Cache-Control", "no-cache");
+    if (server->header("If-None-Match").indexOf(etag) >= 0) {
+        server->send(304, "text/html", "");
+        return;
+    }
+
+    // Every browser accepts gzip, so only the compressed copy is kept in flash
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, "text/html", (PGM_P)data, length);
+}
+
+void NetworkManager::writeModuleJson(Print& out, const String& moduleId, JsonObject moduleConfig) {
+    StaticJsonDocument<768> moduleData;
+    moduleData["id"] = moduleId;
+    moduleData["type"] = moduleConfig["type"] | "unknown";
+
+    // Copy module-specific fields based on type
+    String type = moduleConfig["type"] | "";
+    if (type == "crypto") {
+        moduleData["cryptoId"] = moduleConfig["cryptoId"];
+        moduleData["cryptoSymbol"] = moduleConfig["cryptoSymbol"];
+        moduleData["cryptoName"] = moduleConfig["cryptoName"];
+    } else if (type == "stock") {
+        moduleData["ticker"] = moduleConfig["ticker"];
+        moduleData["name"] = moduleConfig["name"];
+    } else if (type == "weather") {
+        moduleData["location"] = moduleConfig["location"];
+        moduleData["latitude"] = moduleConfig["latitude"];
+        moduleData["longitude"] = moduleConfig["longitude"];
+    } else if (type == "custom") {
+        moduleData["label"] = moduleConfig["label"];
+        moduleData["value"] = moduleConfig["value"];
+        moduleData["unit"] = moduleConfig["unit"];
+    } else if (type == "quad") {
+        moduleData["slot1"] = moduleConfig["slot1"];
+        moduleData["slot2"] = moduleConfig["slot2"];
+        moduleData["slot3"] = moduleConfig["slot3"];
+        moduleData["slot4"] = moduleConfig["slot4"];
+    }
+
+    // Live reading (value/change/temperature..., lastUpdate, lastSuccess, lastError)
+    readings.toJson(moduleId.c_str(), moduleData.as<JsonObject>());
+
+    // Per-module retry/backoff state from the scheduler
+    const ModuleFetchState* fetchState = scheduler.getFetchState(moduleId.c_str());
+    if (fetchState) {
+        unsigned long now = millis() / 1000;
+        JsonObject backoff = moduleData.createNestedObject("backoff");
+        backoff["failures"] = fetchState->consecutiveFailures;
+        backoff["retryIn"] = fetchState->nextAllowed > now ? fetchState->nextAllowed - now : 0;
+        backoff["lastErrorCode"] = fetchState->lastErrorCode;
+        backoff["lastAttempt"] = fetchState->lastAttempt;
+
+        moduleData["refreshInterval"] = scheduler.getRefreshInterval(moduleId.c_str());
+        moduleData["volatility"] = fetchState->volatility;
+    }
+
+    if (moduleData.overflowed()) {
+        Serial.print("WARNING: /api/modules entry truncated for ");
+        Serial.println(moduleId);
+    }
+    serializeJson(moduleData, out);
 }
 
 void NetworkManager::handleValidateCode() {
@@ -2166,12 +2011,20 @@ void NetworkManager::handleUpdateConfig() {
             // If activeModule changed, mark it for forced fetch
             if (newActiveModule != previousActiveModule) {
                 // Clear lastUpdate to trigger immediate fetch
-                JsonObject moduleData = config["modules"][newActiveModule];
-                moduleData["lastUpdate"] = 0;
+                readings.setLastUpdate(newActiveModule.c_str(), 0);
                 Serial.print("Active module changed to: ");
                 Serial.println(newActiveModule);
             }
         }
+        if (doc["device"].containsKey("adaptiveRefresh")) {
+            config["device"]["adaptiveRefresh"] = doc["device"]["adaptiveRefresh"].as<bool>();
+        }
+        if (doc["device"].containsKey("maxRefreshInterval")) {
+            config["device"]["maxRefreshInterval"] = doc["device"]["maxRefreshInterval"].as<uint16_t>();
+        }
+        if (doc["device"].containsKey("adaptiveTarget")) {
+            config["device"]["adaptiveTarget"] = doc["device"]["adaptiveTarget"].as<float>();
+        }
     }
 
     if (doc.containsKey("modules")) {
@@ -2204,9 +2057,7 @@ void NetworkManager::handleUpdateConfig() {
             }
             // Clear cached data if crypto changed
             if (cryptoChanged) {
-                config["modules"]["bitcoin"]["value"] = 0.0;
-                config["modules"]["bitcoin"]["change24h"] = 0.0;
-                config["modules"]["bitcoin"]["lastUpdate"] = 0;
+                readings.reset("bitcoin");
                 Serial.println("Bitcoin crypto changed - cleared cache");
             }
         }
@@ -2230,9 +2081,7 @@ void NetworkManager::handleUpdateConfig() {
             }
             // Clear cached data if crypto changed
             if (cryptoChanged) {
-                config["modules"]["ethereum"]["value"] = 0.0;
-                config["modules"]["ethereum"]["change24h"] = 0.0;
-                config["modules"]["ethereum"]["lastUpdate"] = 0;
+                readings.reset("ethereum");
                 Serial.println("Ethereum crypto changed - cleared cache");
             }
         }
@@ -2242,10 +2091,7 @@ void NetworkManager::handleUpdateConfig() {
             if (modules["stock"].containsKey("ticker")) {
                 config["modules"]["stock"]["ticker"] = modules["stock"]["ticker"].as<String>();
                 // Clear cached stock data to force fresh fetch
-                config["modules"]["stock"]["value"] = 0.0;
-                config["modules"]["stock"]["change"] = 0.0;
-                config["modules"]["stock"]["lastUpdate"] = 0;
-                config["modules"]["stock"]["lastSuccess"] = false;
+                readings.reset("stock");
             }
             if (modules["stock"].containsKey("name")) {
                 config["modules"]["stock"]["name"] = modules["stock"]["name"].as<String>();
@@ -2266,10 +2112,7 @@ void NetworkManager::handleUpdateConfig() {
             }
 
             // Clear cached weather data to force fresh fetch
-            config["modules"]["weather"]["temperature"] = 0;
-            config["modules"]["weather"]["condition"] = "Unknown";
-            config["modules"]["weather"]["lastUpdate"] = 0;
-            config["modules"]["weather"]["lastSuccess"] = false;
+            readings.reset("weather");
 
             Serial.println("Weather cache cleared, will fetch on next cycle");
         }
@@ -2323,25 +2166,73 @@ void NetworkManager::handleStockSearch() {
         return;
     }
 
-    String query = server->arg("q");
+    String query = SearchCache::normalize(server->arg("q"));
     Serial.print("Stock search query: ");
     Serial.println(query);
 
-    HTTPClient http;
-    http.begin("https://query2.finance.yahoo.com/v1/finance/search?q=" + query + "&quotesCount=10&newsCount=0");
-    http.addHeader("User-Agent", "Mozilla/5.0");
+    // Recent (or prefix-covered) query - answer without going upstream
+    String cached;
+    if (searchCache.lookup(query, cached)) {
+        server->send(200, "application/json", cached);
+        return;
+    }
 
-    int httpCode = http.GET();
+    // Same query already on its way (another tab, repeated keystroke) - share the answer
+    ResponseHandle handle = server->defer();
+    auto pending = pendingSearches.find(query);
+    if (pending != pendingSearches.end()) {
+        pending->second.push_back(handle);
+        return;
+    }
+    pendingSearches[query].push_back(handle);
+
+    // Parsed on the fetch worker straight from the socket, keeping only what the UI shows
+    FetchRequest request;
+    request.url = "https://query2.finance.yahoo.com/v1/finance/search?q=" + urlEncode(query) +
+                  "&quotesCount=" + String(SEARCH_MAX_RESULTS) + "&newsCount=0";
+    request.withHeaders = true;
+    request.docCapacity = SEARCH_DOC_CAPACITY;
+    request.useCache = false;  // searchCache keeps the bodies, HttpCache only validators
+    JsonObject quoteFilter = request.newFilter()["quotes"].createNestedObject();
+    quoteFilter["symbol"] = true;
+    quoteFilter["shortname"] = true;
+    quoteFilter["longname"] = true;
+    quoteFilter["quoteType"] = true;
+
+    bool queued = fetchWorker.submit(std::move(request), [this, query](FetchResult& result) {
+        onStockSearchResult(query, result);
+    });
+    if (!queued) {
+        FetchResult failed;
+        failed.success = false;
+        failed.httpCode = 503;
+        failed.doc = nullptr;
+        onStockSearchResult(query, failed);
+    }
+}
 
-    if (httpCode == 200) {
-        String payload = http.getString();
-        server->send(200, "application/json", payload);
+void NetworkManager::onStockSearchResult(const String& query, FetchResult& result) {
+    int code = 200;
+    String body;
+    if (result.success && result.doc) {
+        serializeJson(*result.doc, body);
+        searchCache.store(query, body, (*result.doc)["quotes"].size());
     } else {
-        Serial.printf("Stock API error: %d\n", httpCode);
-        server->send(httpCode, "application/json", "{\"error\":\"API request failed\"}");
+        Serial.printf("Stock API error: %d\n", result.httpCode);
+        // Upstream answered 2xx/3xx but the body didn't parse: still a bad gateway, never a 200
+        code = result.httpCode >= 400 ? result.httpCode : 502;
+        body = "{\"error\":\"API request failed\"}";
     }
 
-    http.end();
+    auto pending = pendingSearches.find(query);
+    if (pending == pendingSearches.end()) return;
+    std::vector<ResponseHandle> handles = pending->second;
+    pendingSearches.erase(pending);
+
+    if (!server) return;
+    for (ResponseHandle handle : handles) {
+        server->sendDeferred(handle, code, "application/json", body);
+    }
 }
 
 void NetworkManager::handleRestart() {
@@ -2353,8 +2244,9 @@ void NetworkManager::handleRestart() {
     }
 
     server->send(200, "application/json", "{\"success\":true}");
-    delay(500);
-    ESP.restart();
+    flushConfiguration();
+    readings.save();
+    scheduleRestart(RESTART_REBOOT);
 }
 
 void NetworkManager::handleFactoryReset() {
@@ -2366,10 +2258,6 @@ void NetworkManager::handleFactoryReset() {
     }
 
     server->send(200, "application/json", "{\"success\":true}");
-    delay(500);
-
     Serial.println("Factory reset via web interface");
-    LittleFS.format();
-    delay(1000);
-    ESP.restart();
+    scheduleRestart(RESTART_FACTORY_RESET);
 }
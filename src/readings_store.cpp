@@ -0,0 +1,355 @@
+#include "readings_store.h"
+#include "time_sync.h"
+#include "config.h"
+#include <LittleFS.h>
+
+// Snapshot file: header, then per slot a length-prefixed id and the raw struct
+#define READINGS_MAGIC 0x52445331UL  // "RDS1"
+#define READINGS_VERSION 1
+
+struct ReadingsHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;  // sizeof(ModuleReading) - layout changed = discard
+    uint8_t count;
+};
+
+ReadingsStore::ReadingsStore() : dirty(false), lastSave(0), snapshots(0) {
+    for (uint8_t i = 0; i < READINGS_MAX_MODULES; i++) {
+        slots[i].fields = 0;
+        clearReading(slots[i]);
+        persistent[i] = true;
+    }
+    empty.fields = READING_CONDITION;
+    clearReading(empty);
+}
+
+void ReadingsStore::clearReading(ModuleReading& reading) {
+    uint8_t fields = reading.fields;
+    memset(&reading, 0, sizeof(reading));
+    reading.fields = fields;
+    if (fields & READING_CONDITION) {
+        strlcpy(reading.condition, "Unknown", sizeof(reading.condition));
+    }
+}
+
+int ReadingsStore::find(const char* moduleId) {
+    for (uint8_t i = 0; i < READINGS_MAX_MODULES; i++) {
+        if (slotIds[i].length() > 0 && slotIds[i] == moduleId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int ReadingsStore::allocate(const char* moduleId) {
+    int slot = find(moduleId);
+    if (slot >= 0) return slot;
+
+    for (uint8_t i = 0; i < READINGS_MAX_MODULES; i++) {
+        if (slotIds[i].length() == 0) {
+            slotIds[i] = moduleId;
+            slots[i].fields = 0;
+            clearReading(slots[i]);
+            persistent[i] = true;
+            return i;
+        }
+    }
+
+    Serial.print("WARNING: Readings store full, no slot for ");
+    Serial.println(moduleId);
+    return -1;
+}
+
+int ReadingsStore::declare(const char* moduleId, uint8_t fields, bool persist) {
+    int slot = allocate(moduleId);
+    if (slot < 0) return -1;
+
+    ModuleReading& reading = slots[slot];
+    if (!persist && persistent[slot]) {
+        // Whatever a snapshot (or older firmware) left for it goes, on flash too
+        persistent[slot] = false;
+        clearReading(reading);
+        dirty = true;
+    }
+    if ((fields & READING_CONDITION) && !(reading.fields & READING_CONDITION)) {
+        strlcpy(reading.condition, "Unknown", sizeof(reading.condition));
+    }
+    reading.fields |= fields;
+    return slot;
+}
+
+const ModuleReading* ReadingsStore::get(const char* moduleId) {
+    return get(find(moduleId));
+}
+
+const ModuleReading* ReadingsStore::get(int slot) {
+    if (slot < 0 || slot >= READINGS_MAX_MODULES || slotIds[slot].length() == 0) {
+        return nullptr;
+    }
+    return &slots[slot];
+}
+
+const ModuleReading& ReadingsStore::read(const char* moduleId) {
+    const ModuleReading* reading = get(moduleId);
+    return reading ? *reading : empty;
+}
+
+ModuleReading* ReadingsStore::edit(const char* moduleId) {
+    return edit(allocate(moduleId));
+}
+
+ModuleReading* ReadingsStore::edit(int slot) {
+    if (slot < 0 || slot >= READINGS_MAX_MODULES || slotIds[slot].length() == 0) {
+        return nullptr;
+    }
+    if (persistent[slot]) dirty = true;
+    return &slots[slot];
+}
+
+unsigned long ReadingsStore::getLastUpdate(const char* moduleId) {
+    const ModuleReading* reading = get(moduleId);
+    return reading ? reading->lastUpdate : 0;
+}
+
+void ReadingsStore::setLastUpdate(const char* moduleId, unsigned long timestamp) {
+    ModuleReading* reading = edit(moduleId);
+    if (reading) {
+        reading->lastUpdate = timestamp;
+    }
+}
+
+void ReadingsStore::setStatus(const char* moduleId, bool success, const String& error) {
+    ModuleReading* reading = edit(moduleId);
+    if (reading) {
+        reading->lastSuccess = success;
+        strlcpy(reading->lastError, error.c_str(), sizeof(reading->lastError));
+    }
+}
+
+void ReadingsStore::reset(const char* moduleId) {
+    int slot = find(moduleId);
+    if (slot >= 0) {
+        clearReading(slots[slot]);
+        if (persistent[slot]) dirty = true;
+    }
+}
+
+void ReadingsStore::release(const char* moduleId) {
+    int slot = find(moduleId);
+    if (slot >= 0) {
+        slotIds[slot] = "";
+        slots[slot].fields = 0;
+        clearReading(slots[slot]);
+        if (persistent[slot]) dirty = true;
+        persistent[slot] = true;
+    }
+}
+
+void ReadingsStore::toJson(const char* moduleId, JsonObject out) {
+    const ModuleReading* reading = get(moduleId);
+    if (!reading) {
+        out["lastUpdate"] = 0;
+        out["lastSuccess"] = false;
+        return;
+    }
+
+    if (reading->fields & READING_VALUE) out["value"] = reading->value;
+    if (reading->fields & READING_CHANGE) out["change"] = reading->change;
+    if (reading->fields & READING_CHANGE24H) out["change24h"] = reading->change;
+    if (reading->fields & READING_TEMPERATURE) out["temperature"] = reading->temperature;
+    if (reading->fields & READING_CONDITION) out["condition"] = reading->condition;
+    if (reading->fields & READING_CODE) {
+        out["securityCode"] = reading->securityCode;
+        out["codeTimeRemaining"] = reading->codeTimeRemaining;
+    }
+    out["lastUpdate"] = reading->lastUpdate;
+    out["lastSuccess"] = reading->lastSuccess;
+    out["lastError"] = reading->lastError;
+}
+
+uint8_t ReadingsStore::rebaseTimestamps(unsigned long epoch, unsigned long uptime) {
+    uint8_t rebased = 0;
+    for (uint8_t i = 0; i < READINGS_MAX_MODULES; i++) {
+        unsigned long lastUpdate = slots[i].lastUpdate;
+        if (slotIds[i].length() > 0 && lastUpdate != 0 && lastUpdate < EPOCH_VALID_AFTER && lastUpdate <= uptime) {
+            slots[i].lastUpdate = epoch - (uptime - lastUpdate);
+            if (persistent[i]) dirty = true;
+            rebased++;
+        }
+    }
+    return rebased;
+}
+
+uint8_t ReadingsStore::migrateFromConfig(JsonObject modules) {
+    uint8_t moved = 0;
+    for (JsonPair kv : modules) {
+        JsonObject module = kv.value().as<JsonObject>();
+        const char* moduleId = kv.key().c_str();
+        String type = module["type"] | "";
+
+        // Custom values are user-entered settings, not readings - they stay
+        bool hasReading = module.containsKey("lastUpdate") || module.containsKey("lastSuccess") ||
+                          module.containsKey("lastError") || module.containsKey("temperature") ||
+                          module.containsKey("condition") || module.containsKey("securityCode") ||
+                          module.containsKey("change") || module.containsKey("change24h") ||
+                          (type != "custom" && module.containsKey("value"));
+        if (!hasReading) continue;
+
+        // A newer snapshot wins over what the old config held
+        int slot = find(moduleId);
+        unsigned long lastUpdate = module["lastUpdate"] | 0;
+        if (lastUpdate < EPOCH_VALID_AFTER) lastUpdate = 0;  // Uptime stamp from an earlier boot
+        if (slot < 0 || slots[slot].lastUpdate < lastUpdate) {
+            ModuleReading* reading = edit(moduleId);
+            if (reading) {
+                if (type != "custom" && module.containsKey("value")) {
+                    reading->value = module["value"] | 0.0f;
+                    reading->fields |= READING_VALUE;
+                }
+                if (module.containsKey("change")) {
+                    reading->change = module["change"] | 0.0f;
+                    reading->fields |= READING_CHANGE;
+                }
+                if (module.containsKey("change24h")) {
+                    reading->change = module["change24h"] | 0.0f;
+                    reading->fields |= READING_CHANGE24H;
+                }
+                if (module.containsKey("temperature")) {
+                    reading->temperature = module["temperature"] | 0.0f;
+                    reading->fields |= READING_TEMPERATURE;
+                }
+                if (module.containsKey("condition")) {
+                    strlcpy(reading->condition, module["condition"] | "Unknown", sizeof(reading->condition));
+                    reading->fields |= READING_CONDITION;
+                }
+                reading->lastUpdate = lastUpdate;
+                reading->lastSuccess = module["lastSuccess"] | false;
+                strlcpy(reading->lastError, module["lastError"] | "", sizeof(reading->lastError));
+            }
+        }
+
+        if (type != "custom") module.remove("value");
+        module.remove("change");
+        module.remove("change24h");
+        module.remove("temperature");
+        module.remove("condition");
+        module.remove("securityCode");
+        module.remove("codeTimeRemaining");
+        module.remove("lastUpdate");
+        module.remove("lastSuccess");
+        module.remove("lastError");
+        moved++;
+    }
+
+    if (moved > 0) {
+        Serial.print("Moved readings of ");
+        Serial.print(moved);
+        Serial.println(" module(s) out of config");
+    }
+    return moved;
+}
+
+bool ReadingsStore::load() {
+    File file = LittleFS.open(READINGS_FILE, "r");
+    if (!file) {
+        Serial.println("No readings snapshot (first boot)");
+        return false;
+    }
+
+    ReadingsHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != READINGS_MAGIC || header.version != READINGS_VERSION ||
+        header.recordSize != sizeof(ModuleReading)) {
+        Serial.println("Readings snapshot unreadable or from another firmware, ignored");
+        file.close();
+        return false;
+    }
+
+    uint8_t loaded = 0;
+    for (uint8_t i = 0; i < header.count; i++) {
+        int idLength = file.read();
+        char id[64];
+        ModuleReading reading;
+        if (idLength <= 0 || idLength >= (int)sizeof(id) ||
+            file.read((uint8_t*)id, idLength) != (size_t)idLength ||
+            file.read((uint8_t*)&reading, sizeof(reading)) != sizeof(reading)) {
+            Serial.println("Readings snapshot truncated");
+            break;
+        }
+        id[idLength] = '\0';
+        reading.condition[READING_CONDITION_LEN - 1] = '\0';
+        reading.lastError[READING_ERROR_LEN - 1] = '\0';
+
+        // Uptime-based stamps from a previous boot mean nothing now - treat as never fetched
+        if (reading.lastUpdate != 0 && reading.lastUpdate < EPOCH_VALID_AFTER) {
+            reading.lastUpdate = 0;
+        }
+
+        int slot = allocate(id);
+        if (slot < 0) break;
+        slots[slot] = reading;
+        loaded++;
+    }
+    file.close();
+
+    Serial.print("Readings loaded: ");
+    Serial.print(loaded);
+    Serial.println(" module(s)");
+    return true;
+}
+
+bool ReadingsStore::save() {
+    // Temp file + rename: a power cut never leaves a half-written snapshot
+    File file = LittleFS.open(READINGS_TEMP_FILE, "w");
+    if (!file) {
+        Serial.println("ERROR: Failed to open readings snapshot for writing");
+        return false;
+    }
+
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < READINGS_MAX_MODULES; i++) {
+        if (slotIds[i].length() > 0 && persistent[i]) count++;
+    }
+
+    ReadingsHeader header = {READINGS_MAGIC, READINGS_VERSION, (uint16_t)sizeof(ModuleReading), count};
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    for (uint8_t i = 0; ok && i < READINGS_MAX_MODULES; i++) {
+        if (slotIds[i].length() == 0 || !persistent[i]) continue;
+        uint8_t idLength = min(slotIds[i].length(), (unsigned int)63);
+        ok = file.write(idLength) == 1 &&
+             file.write((const uint8_t*)slotIds[i].c_str(), idLength) == idLength &&
+             file.write((const uint8_t*)&slots[i], sizeof(ModuleReading)) == sizeof(ModuleReading);
+    }
+    file.close();
+
+    if (!ok || !LittleFS.rename(READINGS_TEMP_FILE, READINGS_FILE)) {
+        Serial.println("ERROR: Failed to write readings snapshot");
+        LittleFS.remove(READINGS_TEMP_FILE);
+        return false;
+    }
+
+    dirty = false;
+    lastSave = millis();
+    snapshots++;
+    return true;
+}
+
+void ReadingsStore::maybeSave() {
+    if (!dirty) return;
+
+    // Lose at most about one refresh worth of readings to a power cut
+    unsigned long interval = (unsigned long)(config["device"]["refreshInterval"] | 300) * 1000UL;
+    interval = max(min(interval, (unsigned long)READINGS_SAVE_INTERVAL), (unsigned long)READINGS_SAVE_MIN_INTERVAL);
+    if (millis() - lastSave >= interval) {
+        save();
+    }
+}
+
+uint8_t ReadingsStore::getCount() {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < READINGS_MAX_MODULES; i++) {
+        if (slotIds[i].length() > 0) count++;
+    }
+    return count;
+}
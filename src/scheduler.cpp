@@ -2,14 +2,57 @@
 #include "modules/module_interface.h"
 #include "module_factory.h"
 #include "config.h"
+#include "network.h"
+#include "fetch_worker.h"
+#include "time_sync.h"
+#include "fetch_stats.h"
+#include "event_bus.h"
+#include "readings_store.h"
+#include <algorithm>
+#include <climits>
+
+// External network, fetch worker, timing stats, event bus and readings (initialized in main)
+extern NetworkManager network;
+extern FetchWorker fetchWorker;
+extern FetchStats fetchStats;
+extern EventBus eventBus;
+extern ReadingsStore readings;
+
+// Built-in per-host limits (overridable via config["device"]["rateLimits"][host])
+struct HostLimitDefault {
+    const char* host;
+    float perMinute;
+    float burst;
+};
+
+static const HostLimitDefault HOST_LIMIT_DEFAULTS[] = {
+    {"api.coingecko.com", 10, 3},           // Free tier allows ~10-30 calls/min
+    {"query1.finance.yahoo.com", 30, 5},
+    {"api.open-meteo.com", 60, 5},
+};
+
+#define DEFAULT_HOST_PER_MINUTE 30
+#define DEFAULT_HOST_BURST 5
+#define STARTUP_JITTER_MAX 30  // seconds: spread fleet fetches after a power blip
+
+// Adaptive refresh tuning
+#define VOLATILITY_ALPHA 0.3f       // EWMA weight of the newest sample
+#define VOLATILITY_MIN_WINDOW 60    // seconds: floor on the sample window (forced fetches)
+#define VOLATILITY_MAX_STEP 0.2f    // Ignore jumps above 20% (ticker/crypto switched)
+
+// Min-heap ordering for refreshQueue (earliest dueAt on top)
+static bool laterDue(const ScheduleEntry& a, const ScheduleEntry& b) {
+    return a.dueAt > b.dueAt;
+}
 
 Scheduler::Scheduler() {
     context.state = IDLE;
     context.lastFetchTime = 0;
     context.nextAllowedFetch = 0;
-    context.retryCount = 0;
-    context.retryDelay = 0;
     lastGlobalFetch = 0;
+    startupHoldUntil = 0;
+    offline = false;
+    catchUpRemaining = 0;
 }
 
 Scheduler::~Scheduler() {
@@ -21,14 +64,35 @@ Scheduler::~Scheduler() {
 }
 
 void Scheduler::init() {
-    Serial.println("Scheduler initialized");
+    // Random start offset so devices that boot together don't poll in lockstep
+    unsigned long jitter = random(0, STARTUP_JITTER_MAX + 1);
+    startupHoldUntil = millis() / 1000 + jitter;
+
+    Serial.print("Scheduler initialized (first automatic fetch in ");
+    Serial.print(jitter);
+    Serial.println("s)");
 }
 
 void Scheduler::registerModule(ModuleInterface* module) {
     if (module && module->id) {
         modules[String(module->id)] = module;
+        fetchStates[String(module->id)] = {0, 0, 0, 0, 0.0f, 0, 0.0f, 0, 0};
         Serial.print("Registered module: ");
         Serial.println(module->id);
+
+        // Queue for background refresh, due when its cached data expires
+        if (module->needsNetwork()) {
+            unsigned long now = millis() / 1000;
+            unsigned long age = timestampAge(readings.getLastUpdate(module->id));
+            uint16_t interval = refreshIntervalFor(module);
+            unsigned long dueAt = now;
+            if (age != AGE_UNKNOWN && age < interval) {
+                dueAt = now + (interval - age);
+            }
+            // Spread initial refreshes across the fleet
+            dueAt += random(0, min((uint16_t)STARTUP_JITTER_MAX, interval) + 1);
+            scheduleRefresh(String(module->id), dueAt);
+        }
     }
 }
 
@@ -38,6 +102,14 @@ void Scheduler::unregisterModule(const char* moduleId) {
     if (it != modules.end()) {
         delete it->second;  // Free module memory
         modules.erase(it);
+        fetchStates.erase(id);
+        fetchStats.forget(id);
+
+        // Drop its background refresh entry
+        refreshQueue.erase(std::remove_if(refreshQueue.begin(), refreshQueue.end(),
+                                          [&id](const ScheduleEntry& e) { return e.moduleId == id; }),
+                           refreshQueue.end());
+        std::make_heap(refreshQueue.begin(), refreshQueue.end(), laterDue);
         Serial.print("Unregistered module: ");
         Serial.println(moduleId);
     }
@@ -114,18 +186,39 @@ void Scheduler::loadModulesFromConfig() {
 void Scheduler::tick() {
     unsigned long now = millis() / 1000;
 
+    // No link: hold network fetches rather than let them fail into backoff.
+    // Local modules (custom, quad, settings) keep refreshing
+    bool online = network.isOnline();
+    if (!online) {
+        if (!offline) {
+            offline = true;
+            catchUpRemaining = 0;
+            Serial.println("Scheduler: offline, network fetches paused");
+        }
+    } else if (offline) {
+        offline = false;
+        startCatchUp(now);
+    }
+
     // If currently fetching, let it complete
     if (context.state == FETCHING) {
         return;
     }
 
+    // Randomized start offset after boot
+    if (now < startupHoldUntil) {
+        return;
+    }
+
     // Check if it's time to auto-refresh the active module
     if (context.state == IDLE) {
         String activeModule = config["device"]["activeModule"] | "bitcoin";
         uint16_t refreshInterval = config["device"]["refreshInterval"] | 300;
+        if (modules.count(activeModule)) {
+            refreshInterval = refreshIntervalFor(modules[activeModule]);
+        }
 
-        JsonObject moduleData = config["modules"][activeModule];
-        unsigned long lastUpdate = moduleData["lastUpdate"] | 0;
+        unsigned long lastUpdate = readings.getLastUpdate(activeModule.c_str());
 
         // Debug logging
         static unsigned long lastDebugTime = 0;
@@ -139,20 +232,336 @@ void Scheduler::tick() {
             Serial.print(" refreshInterval=");
             Serial.print(refreshInterval);
             Serial.print(" timeSinceLastUpdate=");
-            Serial.println(now - lastUpdate);
+            Serial.println(timestampAge(lastUpdate));
             lastDebugTime = now;
         }
 
-        if (lastUpdate == 0 || (now - lastUpdate) >= refreshInterval) {
+        bool local = modules.count(activeModule) && !modules[activeModule]->needsNetwork();
+        bool cooldownOver = (now - lastGlobalFetch) >= minFetchGap();
+        if ((online || local) && cooldownOver && isDue(lastUpdate, refreshInterval)) {
             // Time to refresh
             Serial.print("Scheduler: Triggering fetch for ");
             Serial.println(activeModule);
             requestFetch(activeModule.c_str(), false);
         }
     }
+
+    // Keep every other module fresh in the background (one fetch per global interval)
+    if (online && context.state == IDLE && isBackgroundRefreshEnabled()) {
+        tickBackground(now);
+    }
+}
+
+bool Scheduler::isBackgroundRefreshEnabled() {
+    return config["device"]["backgroundRefresh"] | true;
+}
+
+bool Scheduler::isAdaptiveRefreshEnabled() {
+    return config["device"]["adaptiveRefresh"] | false;
+}
+
+uint16_t Scheduler::refreshIntervalFor(ModuleInterface* module) {
+    uint16_t refreshInterval = config["device"]["refreshInterval"] | 300;
+
+    if (isAdaptiveRefreshEnabled()) {
+        auto it = fetchStates.find(String(module->id));
+        if (it != fetchStates.end() && it->second.adaptiveInterval > 0) {
+            return max(it->second.adaptiveInterval, module->minRefreshInterval);
+        }
+    }
+    return max(refreshInterval, module->minRefreshInterval);
+}
+
+bool Scheduler::isDue(unsigned long lastUpdate, uint16_t interval) {
+    if (lastUpdate == 0) return true;
+
+    unsigned long age = timestampAge(lastUpdate);
+    if (age == AGE_UNKNOWN) {
+        // Persisted wall-clock stamp: give SNTP a moment before assuming it's stale
+        return millis() / 1000 >= TIME_SYNC_GRACE;
+    }
+    return age >= interval;
+}
+
+uint16_t Scheduler::getRefreshInterval(const char* moduleId) {
+    auto it = modules.find(String(moduleId));
+    if (it == modules.end()) return 0;
+    return refreshIntervalFor(it->second);
+}
+
+void Scheduler::updateVolatility(const String& moduleId, ModuleInterface* module, unsigned long now) {
+    const ModuleReading* reading = readings.get(moduleId.c_str());
+    if (!reading || !(reading->fields & (READING_VALUE | READING_TEMPERATURE))) {
+        return;  // Nothing numeric to track (custom, quad, settings)
+    }
+    bool isTemperature = !(reading->fields & READING_VALUE);
+    float value = isTemperature ? reading->temperature : reading->value;
+
+    ModuleFetchState& fetchState = fetchStates[moduleId];
+    if (fetchState.lastValueAt == 0) {
+        // First reading: seed from the 24h change the API already reports
+        fetchState.volatility = fabs(reading->change) / 100.0f / 24.0f;
+    } else {
+        // Relative move per hour since the last reading (temperatures use a 1 degree floor)
+        float base = isTemperature ? max(fabs(fetchState.lastValue), 1.0f) : fabs(fetchState.lastValue);
+        float step = base > 0 ? fabs(value - fetchState.lastValue) / base : VOLATILITY_MAX_STEP + 1;
+        if (step <= VOLATILITY_MAX_STEP) {
+            unsigned long window = max(now - fetchState.lastValueAt, (unsigned long)VOLATILITY_MIN_WINDOW);
+            float sample = step * 3600.0f / window;
+            fetchState.volatility = VOLATILITY_ALPHA * sample + (1.0f - VOLATILITY_ALPHA) * fetchState.volatility;
+        }
+    }
+    fetchState.lastValue = value;
+    fetchState.lastValueAt = now;
+
+    // Interval that lets the value move about adaptiveTarget percent between fetches
+    uint16_t ceiling = config["device"]["maxRefreshInterval"] | 1800;
+    ceiling = max(ceiling, module->minRefreshInterval);
+    float target = (config["device"]["adaptiveTarget"] | 0.1f) / 100.0f;
+    uint16_t interval = ceiling;
+    if (fetchState.volatility > 0) {
+        float seconds = target / fetchState.volatility * 3600.0f;
+        if (seconds < ceiling) {
+            interval = max((uint16_t)seconds, module->minRefreshInterval);
+        }
+    }
+    fetchState.adaptiveInterval = interval;
 }
 
-void Scheduler::requestFetch(const char* moduleId, bool forced) {
+void Scheduler::scheduleRefresh(const String& moduleId, unsigned long dueAt) {
+    // One entry per module: replace any existing entry
+    refreshQueue.erase(std::remove_if(refreshQueue.begin(), refreshQueue.end(),
+                                      [&moduleId](const ScheduleEntry& e) { return e.moduleId == moduleId; }),
+                       refreshQueue.end());
+    std::make_heap(refreshQueue.begin(), refreshQueue.end(), laterDue);
+
+    refreshQueue.push_back({dueAt, moduleId});
+    std::push_heap(refreshQueue.begin(), refreshQueue.end(), laterDue);
+}
+
+uint16_t Scheduler::minFetchGap() {
+    return catchUpRemaining > 0 ? CATCHUP_MIN_INTERVAL : GLOBAL_MIN_INTERVAL;
+}
+
+void Scheduler::startCatchUp(unsigned long now) {
+    // Stale network modules by data age (unknown age sorts first)
+    std::vector<std::pair<unsigned long, String>> stale;
+    for (auto& pair : modules) {
+        ModuleInterface* module = pair.second;
+        if (!module->needsNetwork()) continue;
+
+        // Transport errors were most likely the outage, not the upstream
+        ModuleFetchState& fetchState = fetchStates[pair.first];
+        if (fetchState.lastErrorCode < 0) {
+            fetchState.consecutiveFailures = 0;
+            fetchState.nextAllowed = 0;
+        }
+
+        unsigned long lastUpdate = readings.getLastUpdate(pair.first.c_str());
+        if (!isDue(lastUpdate, refreshIntervalFor(module))) continue;
+
+        unsigned long age = lastUpdate ? timestampAge(lastUpdate) : AGE_UNKNOWN;
+        stale.push_back({age == AGE_UNKNOWN ? ULONG_MAX : age, pair.first});
+    }
+
+    std::sort(stale.begin(), stale.end(),
+              [](const std::pair<unsigned long, String>& a, const std::pair<unsigned long, String>& b) {
+                  return a.first > b.first;
+              });
+
+    // Already due, keyed so the heap pops them in staleness order
+    // (tick() still checks the active module before the queue)
+    size_t count = stale.size();
+    unsigned long base = now >= count ? now - count : 0;
+    for (size_t rank = 0; rank < count; rank++) {
+        scheduleRefresh(stale[rank].second, base + rank);
+    }
+
+    catchUpRemaining = count > 255 ? 255 : count;
+    Serial.print("Scheduler: back online, catching up ");
+    Serial.print(count);
+    Serial.println(" module(s)");
+}
+
+bool Scheduler::tickBackground(unsigned long now) {
+    // Respect the global budget before touching the queue
+    if ((now - lastGlobalFetch) < minFetchGap()) {
+        return false;
+    }
+
+    // Walk due entries until one dispatches; entries that can't go now are requeued
+    std::vector<ScheduleEntry> requeue;
+    bool dispatched = false;
+
+    while (!dispatched && !refreshQueue.empty() && refreshQueue.front().dueAt <= now) {
+        std::pop_heap(refreshQueue.begin(), refreshQueue.end(), laterDue);
+        ScheduleEntry entry = refreshQueue.back();
+        refreshQueue.pop_back();
+
+        auto it = modules.find(entry.moduleId);
+        if (it == modules.end()) {
+            continue;  // Unregistered since it was queued
+        }
+
+        ModuleInterface* module = it->second;
+        uint16_t interval = refreshIntervalFor(module);
+
+        // Backing off after failures - revisit when its own backoff expires
+        const ModuleFetchState& fetchState = fetchStates[entry.moduleId];
+        if (now < fetchState.nextAllowed) {
+            requeue.push_back({fetchState.nextAllowed, entry.moduleId});
+            continue;
+        }
+
+        // Refreshed since it was queued (e.g. as the active module) - just requeue
+        unsigned long lastUpdate = readings.getLastUpdate(entry.moduleId.c_str());
+        if (!isDue(lastUpdate, interval)) {
+            unsigned long age = timestampAge(lastUpdate);
+            unsigned long wait = (age == AGE_UNKNOWN) ? 5 : interval - age;  // Unknown: clock not synced yet
+            requeue.push_back({now + wait, entry.moduleId});
+            continue;
+        }
+
+        // Upstream host out of tokens - try the next module so idle hosts aren't held up
+        const char* host = module->upstreamHost();
+        if (!hostHasToken(host)) {
+            requeue.push_back({now + hostWaitSeconds(host), entry.moduleId});
+            continue;
+        }
+
+        Serial.print("Scheduler: Background refresh for ");
+        Serial.println(entry.moduleId);
+        dispatched = requestFetch(entry.moduleId.c_str(), false);
+        requeue.push_back({now + interval, entry.moduleId});
+    }
+
+    for (const ScheduleEntry& entry : requeue) {
+        scheduleRefresh(entry.moduleId, entry.dueAt);
+    }
+    return dispatched;
+}
+
+HostBucket& Scheduler::bucketFor(const char* host) {
+    auto it = hostBuckets.find(String(host));
+    if (it != hostBuckets.end()) {
+        return it->second;
+    }
+
+    // Built-in default for known hosts, then config override
+    float perMinute = DEFAULT_HOST_PER_MINUTE;
+    float burst = DEFAULT_HOST_BURST;
+    for (const HostLimitDefault& limit : HOST_LIMIT_DEFAULTS) {
+        if (strcmp(limit.host, host) == 0) {
+            perMinute = limit.perMinute;
+            burst = limit.burst;
+            break;
+        }
+    }
+    JsonObject configured = config["device"]["rateLimits"][host];
+    perMinute = configured["perMinute"] | perMinute;
+    burst = configured["burst"] | burst;
+
+    HostBucket bucket;
+    bucket.tokens = burst;
+    bucket.ratePerSec = perMinute / 60.0f;
+    bucket.burst = burst;
+    bucket.lastRefill = millis();
+    bucket.throttled = 0;
+    return hostBuckets[String(host)] = bucket;
+}
+
+void Scheduler::refillBucket(HostBucket& bucket) {
+    unsigned long nowMs = millis();
+    float elapsed = (nowMs - bucket.lastRefill) / 1000.0f;
+    bucket.tokens = min(bucket.burst, bucket.tokens + elapsed * bucket.ratePerSec);
+    bucket.lastRefill = nowMs;
+}
+
+bool Scheduler::hostHasToken(const char* host) {
+    if (!host) return true;  // No upstream (or unlimited)
+
+    HostBucket& bucket = bucketFor(host);
+    refillBucket(bucket);
+    return bucket.tokens >= 1.0f;
+}
+
+void Scheduler::takeHostToken(const char* host) {
+    if (!host) return;
+
+    HostBucket& bucket = bucketFor(host);
+    refillBucket(bucket);
+    // Forced fetches may run dry; never go below empty
+    bucket.tokens = max(0.0f, bucket.tokens - 1.0f);
+}
+
+unsigned long Scheduler::hostWaitSeconds(const char* host) {
+    if (!host) return 0;
+
+    HostBucket& bucket = bucketFor(host);
+    refillBucket(bucket);
+    if (bucket.tokens >= 1.0f || bucket.ratePerSec <= 0) {
+        return 1;
+    }
+    return (unsigned long)((1.0f - bucket.tokens) / bucket.ratePerSec) + 1;
+}
+
+void Scheduler::printHostLimits() {
+    for (auto& pair : hostBuckets) {
+        HostBucket& bucket = pair.second;
+        refillBucket(bucket);
+        Serial.print("  ");
+        Serial.print(pair.first);
+        Serial.print(" - tokens: ");
+        Serial.print(bucket.tokens, 1);
+        Serial.print("/");
+        Serial.print(bucket.burst, 0);
+        Serial.print(", rate: ");
+        Serial.print(bucket.ratePerSec * 60.0f, 1);
+        Serial.print("/min, throttled: ");
+        Serial.println(bucket.throttled);
+    }
+}
+
+void Scheduler::printRefreshQueue() {
+    unsigned long now = millis() / 1000;
+
+    // Copy and drain the heap so entries print in due order
+    std::vector<ScheduleEntry> ordered = refreshQueue;
+    Serial.print("Background refresh: ");
+    Serial.println(isBackgroundRefreshEnabled() ? "ON" : "OFF");
+    Serial.print("Adaptive intervals: ");
+    Serial.println(isAdaptiveRefreshEnabled() ? "ON" : "OFF");
+
+    while (!ordered.empty()) {
+        std::pop_heap(ordered.begin(), ordered.end(), laterDue);
+        ScheduleEntry entry = ordered.back();
+        ordered.pop_back();
+
+        unsigned long age = timestampAge(readings.getLastUpdate(entry.moduleId.c_str()));
+        Serial.print("  ");
+        Serial.print(entry.moduleId);
+        Serial.print(" - data age: ");
+        if (age == AGE_UNKNOWN) {
+            Serial.print("unknown");
+        } else {
+            Serial.print(age);
+            Serial.print("s");
+        }
+        Serial.print(", due in: ");
+        Serial.print(entry.dueAt > now ? entry.dueAt - now : 0);
+        Serial.print("s, interval: ");
+        Serial.print(getRefreshInterval(entry.moduleId.c_str()));
+        Serial.print("s");
+        if (isAdaptiveRefreshEnabled()) {
+            Serial.print(", volatility: ");
+            Serial.print(fetchStates[entry.moduleId].volatility * 100.0f, 2);
+            Serial.print("%/h");
+        }
+        Serial.println();
+    }
+}
+
+bool Scheduler::requestFetch(const char* moduleId, bool forced) {
     unsigned long now = millis() / 1000;
 
     Serial.print("DEBUG requestFetch: moduleId=");
@@ -174,42 +583,65 @@ void Scheduler::requestFetch(const char* moduleId, bool forced) {
         Serial.print("ERROR: Module not found in map: ");
         Serial.println(moduleId);
         Serial.println("Module lookup FAILED!");
-        return;
+        return false;
     }
     Serial.println("Module found in map!");
 
     ModuleInterface* module = modules[String(moduleId)];
 
+    // No link - the fetch could only fail (and back off) for nothing
+    if (module->needsNetwork() && !network.isOnline()) {
+        Serial.println("Fetch denied: WiFi offline");
+        return false;
+    }
+
+    // Already queued or running on the fetch worker
+    if (isFetchInFlight(moduleId)) {
+        Serial.println("Fetch skipped: request already in flight");
+        return false;
+    }
+
     // Check global cooldown
-    if (!forced && (now - lastGlobalFetch) < GLOBAL_MIN_INTERVAL) {
+    if (!forced && (now - lastGlobalFetch) < minFetchGap()) {
         Serial.print("Fetch denied: global cooldown active (");
         Serial.print(now - lastGlobalFetch);
         Serial.print("s < ");
-        Serial.print(GLOBAL_MIN_INTERVAL);
+        Serial.print(minFetchGap());
         Serial.println("s)");
-        return;
+        return false;
     }
 
     // Check module-specific cooldown
-    JsonObject moduleData = config["modules"][moduleId];
-    unsigned long lastUpdate = moduleData["lastUpdate"] | 0;
-    if (!forced && (now - lastUpdate) < module->minRefreshInterval) {
+    unsigned long age = timestampAge(readings.getLastUpdate(moduleId));
+    if (!forced && age != AGE_UNKNOWN && age < module->minRefreshInterval) {
         Serial.print("Fetch denied: module cooldown (last update ");
-        Serial.print(now - lastUpdate);
+        Serial.print(age);
         Serial.print("s ago, min interval ");
         Serial.print(module->minRefreshInterval);
         Serial.println("s)");
-        return;
+        return false;
     }
 
-    // Check retry backoff (unless forced)
-    if (!forced && context.retryDelay > 0 && (now - context.lastFetchTime) < context.retryDelay) {
+    // Check this module's retry backoff (unless forced)
+    ModuleFetchState& fetchState = fetchStates[String(moduleId)];
+    if (!forced && now < fetchState.nextAllowed) {
         Serial.print("Fetch denied: retry backoff (");
-        Serial.print(context.retryDelay - (now - context.lastFetchTime));
+        Serial.print(fetchState.nextAllowed - now);
         Serial.println("s remaining)");
-        return;
+        return false;
     }
 
+    // Check the upstream host's token bucket (forced fetches still spend a token)
+    const char* host = module->upstreamHost();
+    if (!forced && !hostHasToken(host)) {
+        bucketFor(host).throttled++;
+        Serial.print("Fetch denied: host rate limit (");
+        Serial.print(host);
+        Serial.println(")");
+        return false;
+    }
+    takeHostToken(host);
+
     // Approve fetch
     if (forced) {
         Serial.println("FORCED FETCH - bypassing all cooldowns");
@@ -219,6 +651,7 @@ void Scheduler::requestFetch(const char* moduleId, bool forced) {
     context.currentModule = String(moduleId);
     context.state = FETCHING;
     executeFetch();
+    return true;
 }
 
 void Scheduler::executeFetch() {
@@ -229,68 +662,369 @@ void Scheduler::executeFetch() {
     if (modules.find(context.currentModule) == modules.end()) {
         Serial.print("ERROR: Module not found in map: ");
         Serial.println(context.currentModule);
-        context.state = IDLE;
+        context.state = inFlight.empty() ? IDLE : FETCHING;
         return;
     }
 
     ModuleInterface* module = modules[context.currentModule];
-    Serial.print("Module found at address: ");
-    Serial.println((unsigned long)module, HEX);
-    Serial.print("Module ID: ");
-    Serial.println(module->id);
+    String moduleId = context.currentModule;
+    String errorMsg;
+
+    // Local modules (custom, quad, settings) complete instantly - run inline
+    if (!module->needsNetwork()) {
+        bool success = module->fetch(errorMsg);
+        completeFetch(moduleId, success, errorMsg, 0);
+        return;
+    }
+
+    // Batchable modules share one request with other due members of their group
+    if (module->batchGroup()) {
+        executeBatchFetch(module);
+        return;
+    }
+
+    // Network modules: build the request here, the fetch worker performs it
+    FetchRequest request;
+    if (!module->prepareRequest(request, errorMsg)) {
+        completeFetch(moduleId, false, errorMsg, 0);
+        return;
+    }
+    // A 304 only helps if the module already holds that response's values
+    request.useCache = hasCurrentData(moduleId);
+
+    inFlight.push_back(moduleId);
+    bool queued = fetchWorker.submit(std::move(request), [this, moduleId](FetchResult& result) {
+        onFetchResult(moduleId, result);
+    });
+
+    if (!queued) {
+        inFlight.erase(std::remove(inFlight.begin(), inFlight.end(), moduleId), inFlight.end());
+        completeFetch(moduleId, false, "Fetch queue full", 0);
+        return;
+    }
+
+    Serial.print("Fetch queued for ");
+    Serial.println(moduleId);
+}
+
+void Scheduler::executeBatchFetch(ModuleInterface* lead) {
+    unsigned long now = millis() / 1000;
+    const char* group = lead->batchGroup();
+
+    // Pull in every other member of the group that may be refreshed right now
+    std::vector<ModuleInterface*> members(1, lead);
+    for (auto& pair : modules) {
+        if (members.size() >= MAX_BATCH_SIZE) break;
+
+        ModuleInterface* other = pair.second;
+        if (other == lead || !other->batchGroup() || strcmp(other->batchGroup(), group) != 0) {
+            continue;
+        }
+        if (isFetchInFlight(pair.first.c_str())) {
+            continue;
+        }
+        if (now < fetchStates[pair.first].nextAllowed) {
+            continue;  // Backing off on its own
+        }
+        unsigned long age = timestampAge(readings.getLastUpdate(pair.first.c_str()));
+        if (age != AGE_UNKNOWN && age < other->minRefreshInterval) {
+            continue;  // Still within its minimum interval
+        }
+        members.push_back(other);
+    }
 
     String errorMsg;
-    Serial.println("About to call module->fetch()...");
-    bool success = false;
+    FetchRequest request;
+    if (!lead->prepareBatchRequest(members, request, errorMsg)) {
+        completeFetch(String(lead->id), false, errorMsg, 0);
+        return;
+    }
 
-    if (context.currentModule == "stock") {
-        Serial.println("DEBUG: Calling StockModule fetch specifically");
+    std::vector<String> memberIds;
+    for (ModuleInterface* member : members) {
+        memberIds.push_back(String(member->id));
+        inFlight.push_back(String(member->id));
+        if (!hasCurrentData(member->id)) {
+            request.useCache = false;  // New or failed member needs the full body
+        }
     }
 
-    success = module->fetch(errorMsg);
+    bool queued = fetchWorker.submit(std::move(request), [this, memberIds](FetchResult& result) {
+        onBatchResult(memberIds, result);
+    });
 
-    Serial.print("module->fetch() returned: ");
-    Serial.println(success ? "true" : "false");
-    if (!success) {
-        Serial.print("Error message: ");
-        Serial.println(errorMsg);
+    if (!queued) {
+        for (const String& id : memberIds) {
+            inFlight.erase(std::remove(inFlight.begin(), inFlight.end(), id), inFlight.end());
+            completeFetch(id, false, "Fetch queue full", 0);
+        }
+        return;
+    }
+
+    Serial.print("Batched fetch queued for ");
+    Serial.print(memberIds.size());
+    Serial.print(" ");
+    Serial.print(group);
+    Serial.println(" module(s)");
+}
+
+void Scheduler::onBatchResult(const std::vector<String>& memberIds, FetchResult& result) {
+    // Members still registered (any of them can parse for the group)
+    std::vector<ModuleInterface*> members;
+    std::vector<String> ids;
+    for (const String& id : memberIds) {
+        inFlight.erase(std::remove(inFlight.begin(), inFlight.end(), id), inFlight.end());
+        auto it = modules.find(id);
+        if (it != modules.end()) {
+            members.push_back(it->second);
+            ids.push_back(id);
+        } else {
+            notifyWaiters(id);  // Removed while in flight
+        }
+    }
+
+    if (members.empty()) {
+        context.state = inFlight.empty() ? IDLE : FETCHING;
+        return;
     }
 
+    Serial.print("Batched fetch for ");
+    Serial.print(members.size());
+    Serial.print(" module(s) finished in ");
+    Serial.print(result.durationMs);
+    Serial.println("ms");
+
+    if (!result.success) {
+        for (const String& id : ids) {
+            fetchStats.record(id, result.trace);
+            completeFetch(id, false, result.errorMsg, result.httpCode);
+        }
+        return;
+    }
+
+    if (result.httpCode == HTTP_CODE_NOT_MODIFIED) {
+        for (const String& id : ids) {
+            markUnchanged(id);
+            completeFetch(id, true, "", result.httpCode);
+        }
+        return;
+    }
+
+    // Parse once, fan results back out to each member
+    std::vector<String> errors(members.size());
+    uint32_t parseStart = micros();
+    if (result.doc) {
+        members[0]->handleBatchDocument(*result.doc, members, errors);
+    } else {
+        members[0]->handleBatchResponse(result.body, members, errors);
+    }
+    result.trace.us[PHASE_PARSE] = micros() - parseStart;
+
+    for (size_t i = 0; i < ids.size(); i++) {
+        fetchStats.record(ids[i], result.trace);
+        completeFetch(ids[i], errors[i].length() == 0, errors[i], result.httpCode);
+    }
+}
+
+void Scheduler::onFetchResult(const String& moduleId, FetchResult& result) {
+    inFlight.erase(std::remove(inFlight.begin(), inFlight.end(), moduleId), inFlight.end());
+
+    auto it = modules.find(moduleId);
+    if (it == modules.end()) {
+        // Module was removed while its request was in flight
+        context.state = inFlight.empty() ? IDLE : FETCHING;
+        notifyWaiters(moduleId);
+        return;
+    }
+
+    Serial.print("Fetch for ");
+    Serial.print(moduleId);
+    Serial.print(" finished in ");
+    Serial.print(result.durationMs);
+    Serial.println("ms");
+
+    String errorMsg = result.errorMsg;
+    bool success = result.success;
+    if (success && result.httpCode == HTTP_CODE_NOT_MODIFIED) {
+        markUnchanged(moduleId);
+    } else if (success) {
+        uint32_t parseStart = micros();
+        success = result.doc ? it->second->handleDocument(*result.doc, errorMsg)
+                             : it->second->handleResponse(result.body, errorMsg);
+        result.trace.us[PHASE_PARSE] = micros() - parseStart;
+    }
+    fetchStats.record(moduleId, result.trace);
+    completeFetch(moduleId, success, errorMsg, result.httpCode);
+}
+
+void Scheduler::completeFetch(const String& moduleId, bool success, const String& errorMsg, int httpCode) {
+    Serial.print("Fetch result for ");
+    Serial.print(moduleId);
+    Serial.print(": ");
+    Serial.println(success ? "true" : "false");
+
     unsigned long now = millis() / 1000;
     context.lastFetchTime = now;
     lastGlobalFetch = now;
 
-    if (success) {
+    ModuleFetchState& fetchState = fetchStates[moduleId];
+    fetchState.lastAttempt = now;
+    auto fetched = modules.find(moduleId);
+    bool networked = fetched != modules.end() && fetched->second->needsNetwork();
+    if (networked && catchUpRemaining > 0) {
+        catchUpRemaining--;
+    }
+
+    // Link dropped under the request: not the upstream's fault, so no backoff
+    // and the last good reading stays as it is (catch-up refetches it)
+    bool linkLost = networked && !success &&
+                    (!network.isOnline() || (httpCode < 0 && WiFi.status() != WL_CONNECTED));
+
+    if (linkLost) {
+        Serial.print("Fetch failed while offline (not counted): ");
+        Serial.println(errorMsg);
+    } else if (success) {
         Serial.println("Fetch successful");
-        context.retryCount = 0;
-        context.retryDelay = 0;
+        fetchState.consecutiveFailures = 0;
+        fetchState.nextAllowed = 0;
+        fetchState.lastErrorCode = 0;
 
-        JsonObject moduleData = config["modules"][context.currentModule];
-        moduleData["lastSuccess"] = true;
-        moduleData["lastError"] = "";
+        readings.setStatus(moduleId.c_str(), true, "");
+
+        // Track how fast the value moves and requeue at the (possibly new) interval
+        auto it = modules.find(moduleId);
+        if (it != modules.end() && it->second->needsNetwork()) {
+            updateVolatility(moduleId, it->second, now);
+            scheduleRefresh(moduleId, now + refreshIntervalFor(it->second));
+        }
     } else {
         Serial.print("Fetch failed: ");
         Serial.println(errorMsg);
 
-        context.retryCount++;
-        context.retryDelay = calculateBackoff(context.retryCount);
+        // Back off this module only - other modules keep their own schedule
+        if (fetchState.consecutiveFailures < 255) {
+            fetchState.consecutiveFailures++;
+        }
+        uint16_t retryDelay = calculateBackoff(fetchState.consecutiveFailures);
+        retryDelay += random(0, retryDelay / 5 + 1);  // Jitter so retries don't align across devices
+        fetchState.nextAllowed = now + retryDelay;
+
+        // Retry when the backoff ends, not a whole interval after the failed attempt
+        if (networked) {
+            scheduleRefresh(moduleId, fetchState.nextAllowed);
+        }
 
-        JsonObject moduleData = config["modules"][context.currentModule];
-        moduleData["lastSuccess"] = false;
-        moduleData["lastError"] = errorMsg;
+        // Upstream says we're over its limit - stop using this host until tokens refill
+        auto it = modules.find(moduleId);
+        if (httpCode == 429 && it != modules.end() && it->second->upstreamHost()) {
+            HostBucket& bucket = bucketFor(it->second->upstreamHost());
+            refillBucket(bucket);
+            bucket.tokens = 0;
+        }
+
+        // A 200 means the request worked but the body failed to parse
+        fetchState.lastErrorCode = (httpCode == HTTP_CODE_OK) ? 0 : httpCode;
+
+        readings.setStatus(moduleId.c_str(), false, errorMsg);
 
         Serial.print("Retry count: ");
-        Serial.print(context.retryCount);
+        Serial.print(fetchState.consecutiveFailures);
         Serial.print(", next retry in ");
-        Serial.print(context.retryDelay);
+        Serial.print(retryDelay);
         Serial.println(" seconds");
     }
 
-    context.state = IDLE;
+    context.state = inFlight.empty() ? IDLE : FETCHING;
+    publishModuleDelta(moduleId);
+    notifyWaiters(moduleId);
+}
+
+void Scheduler::publishModuleDelta(const String& moduleId) {
+    if (!eventBus.hasListeners()) return;
+
+    ModuleFetchState& fetchState = fetchStates[moduleId];
+
+    // Reading fields (same names as /api/modules), lastSuccess and lastError
+    StaticJsonDocument<384> delta;
+    delta["id"] = moduleId;
+    readings.toJson(moduleId.c_str(), delta.as<JsonObject>());
+    unsigned long lastUpdate = delta["lastUpdate"] | 0;
+    delta.remove("lastUpdate");
+    JsonObject backoff = delta.createNestedObject("backoff");
+    backoff["failures"] = fetchState.consecutiveFailures;
+    backoff["lastErrorCode"] = fetchState.lastErrorCode;
+
+    // Only push when something a viewer would see changed (FNV-1a over the state)
+    String state;
+    serializeJson(delta, state);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < state.length(); i++) {
+        hash = (hash ^ (uint8_t)state[i]) * 16777619u;
+    }
+    if (hash == fetchState.publishedHash) return;
+    fetchState.publishedHash = hash;
+
+    // Time-varying fields go out with the change but don't trigger one
+    unsigned long now = millis() / 1000;
+    delta["lastUpdate"] = lastUpdate;
+    backoff["retryIn"] = fetchState.nextAllowed > now ? fetchState.nextAllowed - now : 0;
+
+    String data;
+    serializeJson(delta, data);
+    eventBus.publish("module", data);
+}
+
+bool Scheduler::hasCurrentData(const String& moduleId) {
+    const ModuleReading* reading = readings.get(moduleId.c_str());
+    return reading && reading->lastUpdate != 0 && reading->lastSuccess;
+}
+
+void Scheduler::markUnchanged(const String& moduleId) {
+    // Upstream confirmed the cached values - they're as fresh as a new fetch
+    readings.setLastUpdate(moduleId.c_str(), nowSeconds());
+    Serial.print(moduleId);
+    Serial.println(": not modified, cached values still current");
+}
+
+bool Scheduler::isFetchInFlight(const char* moduleId) {
+    return std::find(inFlight.begin(), inFlight.end(), String(moduleId)) != inFlight.end();
+}
+
+void Scheduler::onFetchComplete(const char* moduleId, FetchWaiter callback) {
+    if (!isFetchInFlight(moduleId)) {
+        callback();
+        return;
+    }
+    waiters.push_back({String(moduleId), callback});
+}
+
+void Scheduler::notifyWaiters(const String& moduleId) {
+    // Take the matching waiters out first - a callback may register new ones
+    std::vector<FetchWaiter> ready;
+    for (auto it = waiters.begin(); it != waiters.end();) {
+        if (it->moduleId == moduleId) {
+            ready.push_back(it->callback);
+            it = waiters.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (FetchWaiter& callback : ready) {
+        callback();
+    }
 }
 
 uint16_t Scheduler::calculateBackoff(uint8_t retryCount) {
     // Exponential backoff: min(2^n × 60s, 3600s)
+    if (retryCount >= 6) return 3600;         // 2^6 × 60 already exceeds the cap
     uint16_t delay = 60 * (1 << retryCount);  // 2^n × 60
     return min(delay, (uint16_t)3600);
 }
+
+const ModuleFetchState* Scheduler::getFetchState(const char* moduleId) {
+    auto it = fetchStates.find(String(moduleId));
+    if (it == fetchStates.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
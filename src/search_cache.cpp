@@ -0,0 +1,131 @@
+#include "search_cache.h"
+
+SearchCache::SearchCache() : hits(0), prefixHits(0), misses(0) {
+    for (uint8_t i = 0; i < SEARCH_CACHE_ENTRIES; i++) {
+        entries[i].count = 0;
+        entries[i].storedAt = 0;
+        entries[i].lastUsed = 0;
+    }
+}
+
+String SearchCache::normalize(const String& query) {
+    String normalized = query;
+    normalized.trim();
+    normalized.toUpperCase();
+    return normalized;
+}
+
+SearchCache::Entry* SearchCache::find(const String& query) {
+    for (uint8_t i = 0; i < SEARCH_CACHE_ENTRIES; i++) {
+        Entry& entry = entries[i];
+        if (entry.query.length() > 0 && entry.query == query) {
+            if (millis() - entry.storedAt < SEARCH_CACHE_TTL) {
+                return &entry;
+            }
+            entry.query = "";  // Expired
+            entry.results = "";
+        }
+    }
+    return nullptr;
+}
+
+bool SearchCache::lookup(const String& query, String& results) {
+    Entry* entry = find(query);
+    if (entry) {
+        entry->lastUsed = millis();
+        results = entry->results;
+        hits++;
+        return true;
+    }
+
+    // Longest cached prefix whose result set wasn't cut off at SEARCH_MAX_RESULTS
+    for (int len = query.length() - 1; len > 0; len--) {
+        Entry* prefix = find(query.substring(0, len));
+        if (!prefix) continue;
+        if (prefix->count >= SEARCH_MAX_RESULTS) break;  // Truncated - longer query may match others
+        if (filterPrefix(*prefix, query, results)) {
+            prefix->lastUsed = millis();
+            prefixHits++;
+            return true;
+        }
+        break;
+    }
+
+    misses++;
+    return false;
+}
+
+bool SearchCache::filterPrefix(const Entry& entry, const String& query, String& results) {
+    DynamicJsonDocument cached(SEARCH_DOC_CAPACITY);
+    if (deserializeJson(cached, entry.results)) {
+        return false;
+    }
+
+    DynamicJsonDocument filtered(SEARCH_DOC_CAPACITY);
+    JsonArray quotes = filtered.createNestedArray("quotes");
+    for (JsonObject quote : cached["quotes"].as<JsonArray>()) {
+        String symbol = quote["symbol"] | "";
+        String name = String(quote["shortname"] | "") + " " + String(quote["longname"] | "");
+        symbol.toUpperCase();
+        name.toUpperCase();
+        if (symbol.startsWith(query) || name.indexOf(query) >= 0) {
+            quotes.add(quote);
+        }
+    }
+
+    // Nothing left: upstream's fuzzy matching may still find something
+    if (quotes.size() == 0) {
+        return false;
+    }
+    results = "";
+    serializeJson(filtered, results);
+    return true;
+}
+
+void SearchCache::store(const String& query, const String& results, uint8_t count) {
+    // Same query, free slot, otherwise the least recently used entry
+    Entry* slot = nullptr;
+    for (uint8_t i = 0; i < SEARCH_CACHE_ENTRIES && !slot; i++) {
+        if (entries[i].query == query) {
+            slot = &entries[i];
+        }
+    }
+    for (uint8_t i = 0; i < SEARCH_CACHE_ENTRIES && !slot; i++) {
+        if (entries[i].query.length() == 0) {
+            slot = &entries[i];
+        }
+    }
+    if (!slot) {
+        slot = &entries[0];
+        for (uint8_t i = 1; i < SEARCH_CACHE_ENTRIES; i++) {
+            if (entries[i].lastUsed < slot->lastUsed) {
+                slot = &entries[i];
+            }
+        }
+    }
+
+    slot->query = query;
+    slot->results = results;
+    slot->count = count;
+    slot->storedAt = millis();
+    slot->lastUsed = slot->storedAt;
+}
+
+void SearchCache::toJson(JsonObject out) {
+    out["hits"] = hits;
+    out["prefixHits"] = prefixHits;
+    out["misses"] = misses;
+
+    JsonArray list = out.createNestedArray("entries");
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < SEARCH_CACHE_ENTRIES; i++) {
+        const Entry& entry = entries[i];
+        if (entry.query.length() == 0) continue;
+
+        JsonObject item = list.createNestedObject();
+        item["query"] = entry.query;
+        item["results"] = entry.count;
+        item["bytes"] = entry.results.length();
+        item["age"] = (now - entry.storedAt) / 1000;
+    }
+}
@@ -0,0 +1,63 @@
+#include "time_sync.h"
+#include "readings_store.h"
+#include <time.h>
+
+// Live readings (initialized in main)
+extern ReadingsStore readings;
+
+static bool sntpStarted = false;
+static bool syncReported = false;
+
+void initTimeSync() {
+    if (sntpStarted) return;
+
+    configTime(0, 0, NTP_SERVER_1, NTP_SERVER_2);
+    sntpStarted = true;
+    Serial.println("SNTP time sync started");
+}
+
+bool isTimeSynced() {
+    return (unsigned long)time(nullptr) >= EPOCH_VALID_AFTER;
+}
+
+unsigned long nowSeconds() {
+    if (isTimeSynced()) {
+        return (unsigned long)time(nullptr);
+    }
+    return millis() / 1000;
+}
+
+unsigned long timestampAge(unsigned long timestamp) {
+    if (timestamp == 0) return AGE_UNKNOWN;
+
+    unsigned long uptime = millis() / 1000;
+    if (timestamp < EPOCH_VALID_AFTER) {
+        // Uptime stamp: only meaningful if taken during this boot
+        if (isTimeSynced() || timestamp > uptime) return AGE_UNKNOWN;
+        return uptime - timestamp;
+    }
+
+    // Epoch stamp: needs a synced clock to compare against
+    if (!isTimeSynced()) return AGE_UNKNOWN;
+    unsigned long now = (unsigned long)time(nullptr);
+    return timestamp <= now ? now - timestamp : 0;
+}
+
+bool checkTimeSync() {
+    if (syncReported || !isTimeSynced()) {
+        return false;
+    }
+    syncReported = true;
+
+    // Convert stamps taken before the sync (uptime seconds) to epoch
+    unsigned long epoch = (unsigned long)time(nullptr);
+    unsigned long uptime = millis() / 1000;
+    uint8_t rebased = readings.rebaseTimestamps(epoch, uptime);
+
+    Serial.print("Time synced: ");
+    Serial.print(epoch);
+    Serial.print(" (rebased ");
+    Serial.print(rebased);
+    Serial.println(" timestamps)");
+    return true;
+}
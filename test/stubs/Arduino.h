@@ -0,0 +1,369 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/**
+ * Host Arduino core
+ *
+ * The subset of the ESP32 Arduino core the firmware sources use, so they can
+ * be compiled into host tests unchanged (pio test -e native). Time runs on the
+ * host clock; hostUseVirtualTime() freezes it so a test can step it by hand.
+ * Serial output is dropped unless HOST_SERIAL is set in the environment.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define PGM_P const char*
+#define F(text) (text)
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+#define DEC 10
+#define HEX 16
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+inline size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t len = strlen(src);
+    if (size > 0) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Clock
+// ---------------------------------------------------------------------------
+
+inline bool hostVirtualTime = false;
+inline unsigned long long hostVirtualUs = 0;
+
+inline unsigned long long hostRealMicros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// Freeze the clock at startMs; only hostAdvance() and delay() move it from then on
+inline void hostUseVirtualTime(unsigned long startMs) {
+    hostVirtualTime = true;
+    hostVirtualUs = (unsigned long long)startMs * 1000ULL;
+}
+
+inline void hostAdvance(unsigned long ms) {
+    hostVirtualUs += (unsigned long long)ms * 1000ULL;
+}
+
+inline unsigned long micros() {
+    return (unsigned long)(hostVirtualTime ? hostVirtualUs : hostRealMicros());
+}
+
+inline unsigned long millis() {
+    return micros() / 1000;
+}
+
+inline void delay(unsigned long ms) {
+    if (hostVirtualTime) {
+        hostAdvance(ms);
+    } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+}
+
+inline void yield() {}
+
+inline void randomSeed(unsigned long seed) {
+    srand(seed);
+}
+
+inline long random(long howBig) {
+    return howBig > 0 ? rand() % howBig : 0;
+}
+
+inline long random(long howSmall, long howBig) {
+    return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+// ---------------------------------------------------------------------------
+// String
+// ---------------------------------------------------------------------------
+
+class String {
+public:
+    String() {}
+    String(const char* text) : s(text ? text : "") {}
+    String(const std::string& text) : s(text) {}
+    String(char c) : s(1, c) {}
+    String(unsigned char value, unsigned char base = 10) : s(number(value, base)) {}
+    String(int value, unsigned char base = 10) : s(number(value, base)) {}
+    String(unsigned int value, unsigned char base = 10) : s(number(value, base)) {}
+    String(long value, unsigned char base = 10) : s(number(value, base)) {}
+    String(unsigned long value, unsigned char base = 10) : s(number(value, base)) {}
+    String(long long value, unsigned char base = 10) : s(number(value, base)) {}
+    String(unsigned long long value, unsigned char base = 10) : s(number(value, base)) {}
+    String(float value, unsigned int decimals = 2) : s(decimal(value, decimals)) {}
+    String(double value, unsigned int decimals = 2) : s(decimal(value, decimals)) {}
+
+    unsigned int length() const { return s.length(); }
+    const char* c_str() const { return s.c_str(); }
+    bool isEmpty() const { return s.empty(); }
+    unsigned char reserve(unsigned int size) { s.reserve(size); return 1; }
+
+    char operator[](unsigned int index) const { return index < s.length() ? s[index] : 0; }
+    char& operator[](unsigned int index) { return s[index]; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    String& operator+=(const String& other) { s += other.s; return *this; }
+    String& operator+=(const char* text) { if (text) s += text; return *this; }
+    String& operator+=(char c) { s += c; return *this; }
+    String& operator+=(unsigned char value) { s += number(value, 10); return *this; }
+    String& operator+=(int value) { s += number(value, 10); return *this; }
+    String& operator+=(unsigned int value) { s += number(value, 10); return *this; }
+    String& operator+=(long value) { s += number(value, 10); return *this; }
+    String& operator+=(unsigned long value) { s += number(value, 10); return *this; }
+    String& operator+=(float value) { s += decimal(value, 2); return *this; }
+    String& operator+=(double value) { s += decimal(value, 2); return *this; }
+
+    bool concat(const String& other) { s += other.s; return true; }
+    bool concat(const char* text) { if (text) s += text; return true; }
+    bool concat(const char* text, unsigned int length) { s.append(text, length); return true; }
+    bool concat(char c) { s += c; return true; }
+
+    bool operator==(const String& other) const { return s == other.s; }
+    bool operator==(const char* text) const { return s == (text ? text : ""); }
+    bool operator!=(const String& other) const { return s != other.s; }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    bool operator<(const String& other) const { return s < other.s; }
+    bool operator>(const String& other) const { return s > other.s; }
+    bool equals(const String& other) const { return s == other.s; }
+    bool equalsIgnoreCase(const String& other) const {
+        if (s.length() != other.s.length()) return false;
+        for (size_t i = 0; i < s.length(); i++) {
+            if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) return false;
+        }
+        return true;
+    }
+    bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.length(), prefix.s) == 0; }
+    bool endsWith(const String& suffix) const {
+        return s.length() >= suffix.s.length() &&
+               s.compare(s.length() - suffix.s.length(), suffix.s.length(), suffix.s) == 0;
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return found(s.find(c, from)); }
+    int indexOf(const String& text, unsigned int from = 0) const { return found(s.find(text.s, from)); }
+    int lastIndexOf(char c) const { return found(s.rfind(c)); }
+    int lastIndexOf(const String& text) const { return found(s.rfind(text.s)); }
+
+    String substring(unsigned int from) const { return from < s.length() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) std::swap(from, to);
+        if (from >= s.length()) return String();
+        return String(s.substr(from, to - from));
+    }
+
+    void trim() {
+        size_t begin = s.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos) {
+            s.clear();
+            return;
+        }
+        s = s.substr(begin, s.find_last_not_of(" \t\r\n") - begin + 1);
+    }
+    void toLowerCase() { for (char& c : s) c = tolower((unsigned char)c); }
+    void toUpperCase() { for (char& c : s) c = toupper((unsigned char)c); }
+    void replace(const String& find, const String& with) {
+        if (find.s.empty()) return;
+        for (size_t at = s.find(find.s); at != std::string::npos; at = s.find(find.s, at + with.s.length())) {
+            s.replace(at, find.s.length(), with.s);
+        }
+    }
+    void remove(unsigned int index) { if (index < s.length()) s.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s.length()) s.erase(index, count); }
+
+    long toInt() const { return strtol(s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(s.c_str(), nullptr); }
+
+private:
+    std::string s;
+
+    static int found(size_t at) { return at == std::string::npos ? -1 : (int)at; }
+
+    template <typename T>
+    static std::string number(T value, unsigned char base) {
+        char buf[72];
+        if (base == 16) {
+            snprintf(buf, sizeof(buf), "%llx", (unsigned long long)value);
+        } else if (value < 0) {
+            snprintf(buf, sizeof(buf), "%lld", (long long)value);
+        } else {
+            snprintf(buf, sizeof(buf), "%llu", (unsigned long long)value);
+        }
+        return buf;
+    }
+
+    static std::string decimal(double value, unsigned int decimals) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+        return buf;
+    }
+};
+
+// Temporary of a concatenation (ArduinoJson adapts it like String)
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& s) : String(s) {}
+};
+
+inline StringSumHelper operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, char b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, int b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, unsigned int b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, long b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, unsigned long b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, float b) { String r(a); r += b; return r; }
+inline StringSumHelper operator+(const String& a, double b) { String r(a); r += b; return r; }
+
+// ---------------------------------------------------------------------------
+// Print / Stream
+// ---------------------------------------------------------------------------
+
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (n < size && write(buffer[n])) n++;
+        return n;
+    }
+    size_t write(const char* text) { return text ? write((const uint8_t*)text, strlen(text)) : 0; }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text) { return write(text.c_str(), text.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char value, int base = DEC) { return print(String(value, base)); }
+    size_t print(int value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned int value, int base = DEC) { return print(String(value, base)); }
+    size_t print(long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(long long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(unsigned long long value, int base = DEC) { return print(String(value, base)); }
+    size_t print(double value, int digits = 2) { return print(String(value, digits)); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    template <typename T>
+    size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        return n > 0 ? write((const uint8_t*)buf, min((size_t)n, sizeof(buf) - 1)) : 0;
+    }
+
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { _timeout = timeout; }
+    unsigned long getTimeout() { return _timeout; }
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t n = 0;
+        while (n < length) {
+            int c = timedRead();
+            if (c < 0) break;
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+
+    String readStringUntil(char terminator) {
+        String text;
+        int c;
+        while ((c = timedRead()) >= 0 && c != terminator) text += (char)c;
+        return text;
+    }
+
+protected:
+    unsigned long _timeout = 1000;
+
+    int timedRead() {
+        unsigned long start = millis();
+        do {
+            int c = read();
+            if (c >= 0) return c;
+        } while (!hostVirtualTime && millis() - start < _timeout);
+        return -1;
+    }
+};
+
+class HostSerial : public Stream {
+public:
+    void begin(unsigned long) {}
+    operator bool() const { return true; }
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+
+    using Print::write;
+    size_t write(uint8_t c) override {
+        if (echo()) fputc(c, stdout);
+        return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (echo()) fwrite(buffer, 1, size, stdout);
+        return size;
+    }
+
+private:
+    static bool echo() {
+        static const bool enabled = getenv("HOST_SERIAL") != nullptr;
+        return enabled;
+    }
+};
+
+inline HostSerial Serial;
+
+class EspClass {
+public:
+    void restart() {
+        fprintf(stderr, "ESP.restart() called in a host test\n");
+        abort();
+    }
+    uint32_t getFreeHeap() { return 256 * 1024; }
+};
+
+inline EspClass ESP;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,16 @@
+#ifndef HOST_HTTP_METHOD_H
+#define HOST_HTTP_METHOD_H
+
+// Host build: request methods as the ESP32 core names them
+enum HTTPMethod {
+    HTTP_ANY,
+    HTTP_GET,
+    HTTP_HEAD,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_PATCH,
+    HTTP_DELETE,
+    HTTP_OPTIONS
+};
+
+#endif // HOST_HTTP_METHOD_H
@@ -0,0 +1,120 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+/**
+ * Host LittleFS
+ *
+ * In-memory filesystem with the LittleFS calls the firmware uses. Writes land
+ * in the file immediately (as if every write reached flash), so a test can
+ * cut a file short with hostFiles() to stand in for a power loss mid-write,
+ * or cut the next write short with hostShortWrite() for a write that fails.
+ * hostGate() held by a test stalls every open(), standing in for a busy
+ * writer task while the test queues work behind it.
+ */
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+typedef std::vector<uint8_t> HostFileData;
+
+class File : public Stream {
+public:
+    File() {}
+    File(std::shared_ptr<HostFileData> data, bool writable, bool append, long* shortWrite = nullptr)
+        : data(data), writable(writable), pos(append ? data->size() : 0), shortWrite(shortWrite) {}
+
+    operator bool() const { return data != nullptr; }
+
+    size_t size() const { return data ? data->size() : 0; }
+    size_t position() const { return pos; }
+    bool seek(size_t to) {
+        if (!data || to > data->size()) return false;
+        pos = to;
+        return true;
+    }
+    void close() { data.reset(); }
+
+    int available() override { return data ? (int)(data->size() - pos) : 0; }
+    int read() override { return data && pos < data->size() ? (*data)[pos++] : -1; }
+    int peek() override { return data && pos < data->size() ? (*data)[pos] : -1; }
+    size_t read(uint8_t* buffer, size_t length) {
+        if (!data) return 0;
+        size_t n = min(length, data->size() - pos);
+        memcpy(buffer, data->data() + pos, n);
+        pos += n;
+        return n;
+    }
+    size_t readBytes(char* buffer, size_t length) override { return read((uint8_t*)buffer, length); }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (!data || !writable) return 0;
+        if (shortWrite && *shortWrite >= 0) {
+            size = min(size, (size_t)*shortWrite);  // Only this much reaches flash, once
+            *shortWrite = -1;
+        }
+        if (data->size() < pos + size) data->resize(pos + size);
+        memcpy(data->data() + pos, buffer, size);
+        pos += size;
+        return size;
+    }
+
+private:
+    std::shared_ptr<HostFileData> data;
+    bool writable = false;
+    size_t pos = 0;
+    long* shortWrite = nullptr;
+};
+
+class HostLittleFS {
+public:
+    bool begin(bool formatOnFail = false) { return true; }
+    void end() {}
+    bool format() {
+        files.clear();
+        return true;
+    }
+
+    File open(const char* path, const char* mode = "r") {
+        std::lock_guard<std::mutex> held(gate);
+        auto it = files.find(path);
+        if (mode[0] == 'r') {
+            return it == files.end() ? File() : File(it->second, false, false);
+        }
+        if (mode[0] == 'w' || it == files.end()) {
+            files[path] = std::make_shared<HostFileData>();  // Truncate (or create for "a")
+        }
+        return File(files[path], true, mode[0] == 'a', &shortWrite);
+    }
+
+    bool exists(const char* path) { return files.count(path) > 0; }
+    bool remove(const char* path) { return files.erase(path) > 0; }
+    bool rename(const char* from, const char* to) {
+        auto it = files.find(from);
+        if (it == files.end()) return false;
+        files[to] = it->second;
+        files.erase(from);
+        return true;
+    }
+
+    // Test access: contents by path (edit to simulate torn or stale files)
+    std::map<std::string, std::shared_ptr<HostFileData>>& hostFiles() { return files; }
+    // Test access: the next write stores only this many bytes and reports that
+    void hostShortWrite(size_t bytes) { shortWrite = (long)bytes; }
+    // Test access: lock to stall open() on other threads, unlock to let them go
+    std::mutex& hostGate() { return gate; }
+
+private:
+    std::map<std::string, std::shared_ptr<HostFileData>> files;
+    long shortWrite = -1;
+    std::mutex gate;
+};
+
+inline HostLittleFS LittleFS;
+
+#endif // HOST_LITTLEFS_H
@@ -0,0 +1,180 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+/**
+ * Host WiFi
+ *
+ * WiFiClient and WiFiServer on loopback TCP sockets, with the ESP32 core's
+ * behaviour where it matters: write() blocks while the send buffer is full
+ * (retrying 1s waits up to 10 times), read() and available() never block,
+ * and copies of a client share one socket.
+ */
+
+#include <Arduino.h>
+#include <lwip/sockets.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <memory>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+class HostWiFi {
+public:
+    wl_status_t linkStatus = WL_CONNECTED;  // Tests set this to drop the link
+    wl_status_t status() { return linkStatus; }
+};
+
+inline HostWiFi WiFi;
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() {}
+    explicit WiFiClient(int fd) : socket(std::make_shared<Socket>(fd)) {}
+
+    operator bool() { return connected(); }
+
+    int fd() const { return socket ? socket->fd : -1; }
+
+    uint8_t connected() {
+        if (!socket) return 0;
+        uint8_t probe;
+        ssize_t n = lwip_recv(socket->fd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+        if (n > 0) return 1;
+        if (n == 0) return 0;  // Peer closed
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+
+    int available() override {
+        int pending = 0;
+        if (!socket || ioctl(socket->fd, FIONREAD, &pending) < 0) return 0;
+        return pending;
+    }
+
+    int read() override {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+
+    int read(uint8_t* buffer, size_t size) {
+        if (!socket) return -1;
+        ssize_t n = lwip_recv(socket->fd, buffer, size, MSG_DONTWAIT);
+        return n > 0 ? (int)n : -1;
+    }
+
+    int peek() override {
+        uint8_t c;
+        if (!socket) return -1;
+        return lwip_recv(socket->fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1 ? c : -1;
+    }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+
+    size_t write(const uint8_t* buffer, size_t size) override {
+        if (!socket) return 0;
+        size_t sent = 0;
+        int retries = 10;
+        while (sent < size && retries > 0) {
+            pollfd ready = {socket->fd, POLLOUT, 0};
+            if (poll(&ready, 1, 1000) <= 0) {
+                retries--;  // Send buffer still full after a second
+                continue;
+            }
+            ssize_t n = lwip_send(socket->fd, buffer + sent, size - sent, 0);
+            if (n <= 0) break;
+            sent += n;
+        }
+        return sent;
+    }
+
+    void setNoDelay(bool noDelay) {
+        if (!socket) return;
+        int flag = noDelay ? 1 : 0;
+        setsockopt(socket->fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    }
+
+    void stop() { socket.reset(); }
+
+private:
+    struct Socket {
+        int fd;
+        explicit Socket(int fd) : fd(fd) {}
+        ~Socket() { ::close(fd); }
+    };
+
+    std::shared_ptr<Socket> socket;
+};
+
+#define HOST_TCP_SND_BUF 5744  // bytes: TCP_SND_BUF in the ESP32 Arduino core (4 x MSS)
+
+// Port the last WiFiServer::begin() bound to (port 0 picks a free one)
+inline uint16_t hostServerPort = 0;
+
+class WiFiServer {
+public:
+    WiFiServer(uint16_t port = 80, uint8_t maxClients = 4) : port(port), maxClients(maxClients) {}
+    ~WiFiServer() { end(); }
+
+    void begin() {
+        listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(port);
+        if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd, maxClients) < 0) {
+            ::close(listenFd);
+            listenFd = -1;
+            return;
+        }
+        fcntl(listenFd, F_SETFL, O_NONBLOCK);
+
+        socklen_t len = sizeof(addr);
+        getsockname(listenFd, (sockaddr*)&addr, &len);
+        hostServerPort = ntohs(addr.sin_port);
+    }
+
+    void end() {
+        if (listenFd >= 0) ::close(listenFd);
+        if (acceptedFd >= 0) ::close(acceptedFd);
+        listenFd = acceptedFd = -1;
+    }
+
+    void setNoDelay(bool noDelay) {}
+
+    bool hasClient() {
+        if (acceptedFd < 0 && listenFd >= 0) {
+            acceptedFd = accept(listenFd, nullptr, nullptr);  // Blocking socket, like lwIP's
+        }
+        return acceptedFd >= 0;
+    }
+
+    WiFiClient available() {
+        if (!hasClient()) return WiFiClient();
+        // lwIP's send buffer is a few segments, not Linux's megabytes: a client
+        // that stops reading fills it as quickly as it would on the board
+        int sendBuffer = HOST_TCP_SND_BUF;
+        setsockopt(acceptedFd, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+        WiFiClient client(acceptedFd);
+        acceptedFd = -1;
+        return client;
+    }
+
+private:
+    uint16_t port;
+    uint8_t maxClients;
+    int listenFd = -1;
+    int acceptedFd = -1;
+};
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,127 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+/**
+ * Host FreeRTOS
+ *
+ * Queues, semaphores and tasks on std::thread, so the worker tasks run as
+ * real threads in host tests. Ticks are milliseconds.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+struct HostQueue {
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    UBaseType_t length;
+    UBaseType_t itemSize;
+};
+
+typedef HostQueue* QueueHandle_t;
+typedef HostQueue* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+// Waits until ready() or the ticks run out (portMAX_DELAY = forever)
+template <typename Ready>
+inline bool hostQueueWait(HostQueue* queue, std::unique_lock<std::mutex>& held, TickType_t ticks, Ready ready) {
+    if (ticks == portMAX_DELAY) {
+        queue->changed.wait(held, ready);
+        return true;
+    }
+    return queue->changed.wait_for(held, std::chrono::milliseconds(ticks), ready);
+}
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> held(queue->lock);
+    if (!hostQueueWait(queue, held, ticks, [queue] { return queue->items.size() < queue->length; })) {
+        return pdFALSE;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(item);
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> held(queue->lock);
+    if (!hostQueueWait(queue, held, ticks, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    if (queue->itemSize > 0) {
+        memcpy(item, queue->items.front().data(), queue->itemSize);
+    }
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> held(queue->lock);
+    return queue->items.size();
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 0);
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+    xQueueSend(mutex, nullptr, 0);
+    return mutex;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return xQueueReceive(semaphore, nullptr, ticks);
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t main, const char* name, uint32_t stackDepth,
+                              void* param, UBaseType_t priority, TaskHandle_t* handle) {
+    std::thread(main, param).detach();  // Tasks never return; the process exit ends them
+    if (handle) *handle = reinterpret_cast<TaskHandle_t>(main);
+    return pdPASS;
+}
+
+// Host tasks can only end themselves (nullptr): the thread parks until the process exits
+inline void vTaskDelete(TaskHandle_t task) {
+    while (!task) {
+        std::this_thread::sleep_for(std::chrono::hours(1));
+    }
+}
+
+inline void vTaskDelay(TickType_t ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+#endif // HOST_FREERTOS_H
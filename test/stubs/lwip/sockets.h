@@ -0,0 +1,21 @@
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+// Host build: lwIP socket calls map onto the host's BSD sockets
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+
+inline ssize_t lwip_send(int s, const void* data, size_t size, int flags) {
+    return ::send(s, data, size, flags | MSG_NOSIGNAL);  // Closed peer: EPIPE, not a signal
+}
+
+inline ssize_t lwip_recv(int s, void* mem, size_t len, int flags) {
+    return ::recv(s, mem, len, flags);
+}
+
+#endif // HOST_LWIP_SOCKETS_H
@@ -0,0 +1,104 @@
+#ifndef HOST_ROM_MINIZ_H
+#define HOST_ROM_MINIZ_H
+
+/**
+ * Host ROM inflater
+ *
+ * The tinfl calls InflateStream makes, on the system zlib. Statuses follow
+ * tinfl: DONE at the end of the deflate data, HAS_MORE_OUTPUT when the output
+ * span filled up, NEEDS_MORE_INPUT only while the caller says more is coming.
+ *
+ * zlib keeps its own history, while tinfl reads back-references out of the
+ * caller's buffer: outStart is a circular dictionary whose size is
+ * (outNext - outStart) + *outSize. So the buffer contract is checked here
+ * instead. The size must be a power of two (BAD_PARAM otherwise, as in
+ * tinfl). Output must continue where the last call stopped. Every byte of
+ * history must still hold what was decoded into it. A caller that breaks the
+ * contract would get corrupt output from tinfl; here it gets FAILED.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <zlib.h>
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8
+};
+
+typedef enum {
+    TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS = -4,
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef struct {
+    z_stream z;
+    int open;  // inflateInit2() done (on the first call, once the flags are known)
+    size_t total;                          // Bytes decoded so far
+    uint8_t history[TINFL_LZ_DICT_SIZE];   // What the caller's dictionary must hold
+} tinfl_decompressor;
+
+#define tinfl_init(r) memset((r), 0, sizeof(tinfl_decompressor))
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor* r, const uint8_t* inNext, size_t* inSize,
+                                     uint8_t* outStart, uint8_t* outNext, size_t* outSize, uint32_t flags) {
+    if (!(flags & TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF)) {
+        size_t dictSize = (outNext - outStart) + *outSize;
+        if (outNext < outStart || (dictSize & (dictSize - 1))) return TINFL_STATUS_BAD_PARAM;
+        // Shorter dictionaries than zlib's window would lose far back-references
+        if (dictSize != TINFL_LZ_DICT_SIZE) return TINFL_STATUS_FAILED;
+        size_t filled = r->total < TINFL_LZ_DICT_SIZE ? r->total : TINFL_LZ_DICT_SIZE;
+        if ((size_t)(outNext - outStart) != (r->total & (TINFL_LZ_DICT_SIZE - 1)) ||
+            memcmp(outStart, r->history, filled) != 0) {
+            return TINFL_STATUS_FAILED;  // History moved or overwritten
+        }
+    }
+
+    if (!r->open) {
+        int windowBits = (flags & TINFL_FLAG_PARSE_ZLIB_HEADER) ? 15 : -15;
+        if (inflateInit2(&r->z, windowBits) != Z_OK) return TINFL_STATUS_FAILED;
+        r->open = 1;
+    }
+
+    r->z.next_in = (Bytef*)inNext;
+    r->z.avail_in = *inSize;
+    r->z.next_out = outNext;
+    r->z.avail_out = *outSize;
+    int rc = inflate(&r->z, Z_NO_FLUSH);
+    *inSize -= r->z.avail_in;
+    *outSize -= r->z.avail_out;
+    if (!(flags & TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF)) {
+        memcpy(r->history + (outNext - outStart), outNext, *outSize);  // Never past the end (checked above)
+        r->total += *outSize;
+    }
+
+    tinfl_status status;
+    if (rc == Z_STREAM_END) {
+        status = TINFL_STATUS_DONE;
+    } else if (rc != Z_OK && rc != Z_BUF_ERROR) {
+        status = TINFL_STATUS_FAILED;
+    } else if (r->z.avail_out == 0) {
+        status = TINFL_STATUS_HAS_MORE_OUTPUT;
+    } else if (flags & TINFL_FLAG_HAS_MORE_INPUT) {
+        return TINFL_STATUS_NEEDS_MORE_INPUT;
+    } else {
+        status = TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS;  // Input ended mid-stream
+    }
+
+    if (status != TINFL_STATUS_HAS_MORE_OUTPUT) {
+        inflateEnd(&r->z);  // Terminal: the caller frees r without telling us
+        r->open = 0;
+    }
+    return status;
+}
+
+#endif // HOST_ROM_MINIZ_H
@@ -0,0 +1,247 @@
+// Config journal replay against the host LittleFS: a power cut at every byte
+// of a sample journal, a power cut between the snapshot rename and the journal
+// removal, a replay that fills the document pool with replaced values, and a
+// failed append with more queued behind it on the writer task.
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "../../src/config_journal.cpp"
+
+StaticJsonDocument<8192> config;
+
+static std::string toJsonString(JsonDocument& doc) {
+    std::string out;
+    serializeJson(doc, out);
+    return out;
+}
+
+static void setBaseConfig(JsonDocument& doc) {
+    doc.clear();
+    doc["device"]["currency"] = "usd";
+    doc["device"]["refreshInterval"] = 300;
+    doc["modules"]["bitcoin"]["type"] = "crypto";
+    doc["modules"]["bitcoin"]["name"] = "Bitcoin";
+    doc["modules"]["ethereum"]["type"] = "crypto";
+    doc["modules"]["ethereum"]["name"] = "Ethereum";
+}
+
+static HostFileData readHostFile(const char* path) {
+    auto& files = LittleFS.hostFiles();
+    auto it = files.find(path);
+    return it == files.end() ? HostFileData() : *it->second;
+}
+
+static void writeHostFile(const char* path, const uint8_t* data, size_t length) {
+    LittleFS.hostFiles()[path] = std::make_shared<HostFileData>(data, data + length);
+}
+
+// Boot: snapshot (header, then MessagePack) into doc, then the journal on top
+static bool bootConfig(ConfigJournal& journal, JsonDocument& doc) {
+    HostFileData snapshot = readHostFile(CONFIG_FILE);
+    TEST_ASSERT_FALSE(snapshot.empty());
+    size_t start = journal.openSnapshot(snapshot.data(), snapshot.size());
+    DeserializationError error = deserializeMsgPack(doc, (const char*)snapshot.data() + start,
+                                                    snapshot.size() - start);
+    TEST_ASSERT_TRUE(error == DeserializationError::Ok);
+    return journal.replay(doc);
+}
+
+static uint32_t statOf(ConfigJournal& journal, const char* key) {
+    StaticJsonDocument<512> stats;
+    journal.toJson(stats.to<JsonObject>());
+    return stats[key] | 0UL;
+}
+
+void setUp() {
+    LittleFS.format();
+}
+
+void tearDown() {}
+
+void test_torn_write_at_every_offset() {
+    // Sample journal: one section per commit, so every record boundary is a known state
+    DynamicJsonDocument doc(8192);
+    setBaseConfig(doc);
+    ConfigJournal writer;
+    writer.compact(doc);
+    writer.begin(doc);
+
+    std::vector<size_t> boundaries(1, 0);
+    std::vector<std::string> states(1, toJsonString(doc));
+    auto commitEdit = [&]() {
+        TEST_ASSERT_TRUE(writer.commit(doc));
+        boundaries.push_back(readHostFile(CONFIG_JOURNAL_FILE).size());
+        states.push_back(toJsonString(doc));
+        TEST_ASSERT_GREATER_THAN(boundaries[boundaries.size() - 2], boundaries.back());
+    };
+
+    doc["device"]["currency"] = "chf";
+    commitEdit();
+    doc["modules"]["solana"]["type"] = "crypto";
+    doc["modules"]["solana"]["name"] = "Solana";
+    commitEdit();
+    doc["modules"].remove("ethereum");
+    commitEdit();
+    doc["modules"]["bitcoin"]["name"] = "BTC";
+    commitEdit();
+    doc["device"]["refreshInterval"] = 600;
+    commitEdit();
+    doc["version"] = 3;  // Top-level value, not an object
+    commitEdit();
+
+    HostFileData journalBytes = readHostFile(CONFIG_JOURNAL_FILE);
+    HostFileData snapshotBytes = readHostFile(CONFIG_FILE);
+    TEST_ASSERT_EQUAL(boundaries.back(), journalBytes.size());
+
+    for (size_t cut = 0; cut <= journalBytes.size(); cut++) {
+        LittleFS.format();
+        writeHostFile(CONFIG_FILE, snapshotBytes.data(), snapshotBytes.size());
+        writeHostFile(CONFIG_JOURNAL_FILE, journalBytes.data(), cut);
+
+        // Everything up to the last whole record, and only a partial one counts as torn
+        size_t whole = 0;
+        while (whole + 1 < boundaries.size() && boundaries[whole + 1] <= cut) {
+            whole++;
+        }
+        bool clean = boundaries[whole] == cut;
+
+        char message[48];
+        snprintf(message, sizeof(message), "cut at %u of %u", (unsigned)cut, (unsigned)journalBytes.size());
+        ConfigJournal reader;
+        TEST_ASSERT_EQUAL_MESSAGE(clean, bootConfig(reader, config), message);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(states[whole].c_str(), toJsonString(config).c_str(), message);
+        TEST_ASSERT_EQUAL_MESSAGE(whole, statOf(reader, "replayedAtBoot"), message);
+
+        // A torn journal is folded into the snapshot: the next boot is clean and the same
+        reader.begin(config);
+        ConfigJournal next;
+        TEST_ASSERT_TRUE_MESSAGE(bootConfig(next, config), message);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(states[whole].c_str(), toJsonString(config).c_str(), message);
+    }
+}
+
+void test_stale_journal_after_snapshot_is_skipped() {
+    DynamicJsonDocument doc(8192);
+    setBaseConfig(doc);
+    ConfigJournal writer;
+    writer.compact(doc);
+    writer.begin(doc);
+
+    doc["device"]["currency"] = "chf";
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    doc["modules"].remove("ethereum");
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    HostFileData staleJournal = readHostFile(CONFIG_JOURNAL_FILE);
+    TEST_ASSERT_FALSE(staleJournal.empty());
+
+    // Folded into the snapshot without being journaled, then the power goes
+    // after the rename but before the journal is removed
+    doc["device"]["currency"] = "eur";
+    doc["modules"]["ethereum"]["type"] = "crypto";
+    TEST_ASSERT_TRUE(writer.compact(doc));
+    TEST_ASSERT_FALSE(LittleFS.exists(CONFIG_JOURNAL_FILE));
+    writeHostFile(CONFIG_JOURNAL_FILE, staleJournal.data(), staleJournal.size());
+
+    ConfigJournal reader;
+    TEST_ASSERT_TRUE(bootConfig(reader, config));
+    TEST_ASSERT_EQUAL_STRING("eur", config["device"]["currency"].as<const char*>());
+    TEST_ASSERT_FALSE(config["modules"]["ethereum"].isNull());
+    TEST_ASSERT_EQUAL(0, statOf(reader, "replayedAtBoot"));
+    TEST_ASSERT_EQUAL(2, statOf(reader, "skippedAtBoot"));
+
+    // Records written after that boot follow the stale ones and still apply
+    reader.begin(config);
+    config["device"]["currency"] = "gbp";
+    TEST_ASSERT_TRUE(reader.commit(config));
+    ConfigJournal next;
+    TEST_ASSERT_TRUE(bootConfig(next, config));
+    TEST_ASSERT_EQUAL_STRING("gbp", config["device"]["currency"].as<const char*>());
+    TEST_ASSERT_FALSE(config["modules"]["ethereum"].isNull());
+    TEST_ASSERT_EQUAL(1, statOf(next, "replayedAtBoot"));
+    TEST_ASSERT_EQUAL(2, statOf(next, "skippedAtBoot"));
+}
+
+void test_replay_reclaims_a_full_pool() {
+    const size_t NOTE_LENGTH = 1200;
+    const char NOTES[] = {'a', 'b', 'c'};
+
+    // Snapshot that fills most of the pool, then edits that each replace a large value
+    DynamicJsonDocument doc(16384);
+    setBaseConfig(doc);
+    doc["modules"]["filler"]["text"] = std::string(4600, 'x');
+    doc["modules"]["bitcoin"]["notes"] = std::string(NOTE_LENGTH, '-');
+    ConfigJournal writer;
+    writer.compact(doc);
+    writer.begin(doc);
+    for (char note : NOTES) {
+        doc["modules"]["bitcoin"]["notes"] = std::string(NOTE_LENGTH, note);
+        doc.garbageCollect();
+        TEST_ASSERT_TRUE(writer.commit(doc));
+    }
+    TEST_ASSERT_TRUE(LittleFS.exists(CONFIG_JOURNAL_FILE));  // Still journaled, not compacted
+
+    // Without garbage collection the replaced values don't fit
+    ConfigJournal reader;
+    config.clear();
+    HostFileData snapshot = readHostFile(CONFIG_FILE);
+    size_t start = reader.openSnapshot(snapshot.data(), snapshot.size());
+    deserializeMsgPack(config, (const char*)snapshot.data() + start, snapshot.size() - start);
+    TEST_ASSERT_GREATER_THAN(config.capacity(), config.memoryUsage() + sizeof(NOTES) * NOTE_LENGTH);
+
+    TEST_ASSERT_TRUE(bootConfig(reader, config));
+    TEST_ASSERT_FALSE(config.overflowed());
+    TEST_ASSERT_EQUAL(sizeof(NOTES), statOf(reader, "replayedAtBoot"));
+    TEST_ASSERT_EQUAL_STRING(toJsonString(doc).c_str(), toJsonString(config).c_str());
+}
+
+void test_failed_append_holds_queued_appends() {
+    DynamicJsonDocument doc(8192);
+    setBaseConfig(doc);
+    ConfigJournal writer;
+    writer.compact(doc);
+    writer.begin(doc);
+    std::string base = toJsonString(doc);
+    TEST_ASSERT_TRUE(writer.init());
+
+    // The writer stalls on its first open while three appends queue up; the
+    // first of them only gets part of its record onto flash
+    LittleFS.hostGate().lock();
+    doc["device"]["currency"] = "chf";
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    doc["modules"]["bitcoin"]["name"] = "BTC";
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    doc["device"]["refreshInterval"] = 600;
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    LittleFS.hostShortWrite(4);
+    LittleFS.hostGate().unlock();
+    TEST_ASSERT_FALSE(writer.flush());
+
+    // Nothing lands behind the torn record, where replay could never reach it
+    TEST_ASSERT_EQUAL(4, readHostFile(CONFIG_JOURNAL_FILE).size());
+    ConfigJournal reader;
+    TEST_ASSERT_FALSE(bootConfig(reader, config));
+    TEST_ASSERT_EQUAL_STRING(base.c_str(), toJsonString(config).c_str());
+
+    // The next commit folds all three edits into a snapshot, and appends resume after it
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    doc["modules"]["bitcoin"]["name"] = "Bitcoin";
+    TEST_ASSERT_TRUE(writer.commit(doc));
+    TEST_ASSERT_TRUE(writer.flush());
+    writer.stop();
+
+    ConfigJournal next;
+    TEST_ASSERT_TRUE(bootConfig(next, config));
+    TEST_ASSERT_EQUAL(1, statOf(next, "replayedAtBoot"));
+    TEST_ASSERT_EQUAL_STRING(toJsonString(doc).c_str(), toJsonString(config).c_str());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_torn_write_at_every_offset);
+    RUN_TEST(test_stale_journal_after_snapshot_is_skipped);
+    RUN_TEST(test_replay_reclaims_a_full_pool);
+    RUN_TEST(test_failed_append_holds_queued_appends);
+    return UNITY_END();
+}
@@ -0,0 +1,379 @@
+// Settings server under load on loopback sockets: keep-alive clients hammer it
+// while others stop reading halfway through large responses and event
+// streams. handleClient() must never wait on a client, and everyone else must
+// keep getting complete, correct responses.
+
+#include <Arduino.h>
+#include <unity.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/event_web_server.cpp"
+
+#define LOAD_CLIENTS 3           // One slot stays free for the stalled client
+#define LOAD_REQUESTS 200        // Keep-alive requests per load client
+#define PAGE_SIZE 20000          // send_P() body
+#define BIG_BLOCKS 256           // sendChunked() body: 256 x 1KB
+#define STALLED_RCVBUF 4096      // Receive buffer of clients that never read
+// Longest acceptable handleClient() pass. A pass that waited on a full send
+// buffer would take a second or more; the budget only leaves room for host
+// scheduler jitter
+#define HANDLE_BUDGET_US 50000
+
+EventWebServer server(0);
+static char page[PAGE_SIZE];
+static uint8_t block[1024];
+
+// ---------------------------------------------------------------------------
+// Blocking HTTP/1.1 client
+// ---------------------------------------------------------------------------
+
+struct Response {
+    int status = 0;
+    std::string headers;
+    std::string body;
+};
+
+class TestClient {
+private:
+    int fd;
+    std::string buffer;
+
+    bool fill() {
+        char chunk[4096];
+        ssize_t n = lwip_recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) return false;
+        buffer.append(chunk, n);
+        return true;
+    }
+
+    bool readLine(std::string& line) {
+        size_t end;
+        while ((end = buffer.find("\r\n")) == std::string::npos) {
+            if (!fill()) return false;
+        }
+        line = buffer.substr(0, end);
+        buffer.erase(0, end + 2);
+        return true;
+    }
+
+    bool readBytes(std::string& out, size_t length) {
+        while (buffer.size() < length) {
+            if (!fill()) return false;
+        }
+        out.append(buffer, 0, length);
+        buffer.erase(0, length);
+        return true;
+    }
+
+public:
+    explicit TestClient(int receiveBuffer = 0) {
+        fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (receiveBuffer > 0) {
+            setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+        }
+        timeval timeout = {5, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(hostServerPort);
+        connect(fd, (sockaddr*)&addr, sizeof(addr));
+    }
+
+    ~TestClient() { ::close(fd); }
+
+    void request(const char* method, const char* path) {
+        std::string text = std::string(method) + " " + path + " HTTP/1.1\r\nHost: tracker\r\n\r\n";
+        lwip_send(fd, text.data(), text.size(), 0);
+    }
+
+    // One response: Content-Length, chunked, or (HEAD) no body at all
+    bool readResponse(Response& response, bool head = false) {
+        std::string line;
+        if (!readLine(line) || line.compare(0, 9, "HTTP/1.1 ") != 0) return false;
+        response.status = atoi(line.c_str() + 9);
+        response.headers.clear();
+        response.body.clear();
+
+        long length = -1;
+        bool chunked = false;
+        while (readLine(line) && !line.empty()) {
+            response.headers += line + "\n";
+            if (line.compare(0, 16, "Content-Length: ") == 0) length = atol(line.c_str() + 16);
+            if (line == "Transfer-Encoding: chunked") chunked = true;
+        }
+        if (head) return true;
+        if (length >= 0) return readBytes(response.body, length);
+        if (!chunked) return false;
+
+        for (;;) {
+            if (!readLine(line)) return false;
+            size_t size = strtoul(line.c_str(), nullptr, 16);
+            std::string crlf;
+            if (size == 0) return readLine(line);
+            if (!readBytes(response.body, size) || !readBytes(crlf, 2)) return false;
+        }
+    }
+
+    // Event stream: the next complete "event: ...\ndata: ...\n\n" block
+    bool readEvent(std::string& event) {
+        size_t end;
+        while ((end = buffer.find("\n\n")) == std::string::npos) {
+            if (!fill()) return false;
+        }
+        event = buffer.substr(0, end);
+        buffer.erase(0, end + 2);
+        return true;
+    }
+
+    // Drains what the server managed to send; true once it closed the connection
+    bool closedByServer() {
+        char c;
+        ssize_t n;
+        while ((n = lwip_recv(fd, &c, 1, MSG_DONTWAIT)) > 0) {}
+        return n == 0;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// loop() stand-in
+// ---------------------------------------------------------------------------
+
+static uint32_t worstPassUs = 0;
+
+static void serveOnce() {
+    uint32_t start = micros();
+    server.handleClient();
+    worstPassUs = max(worstPassUs, (uint32_t)(micros() - start));
+}
+
+template <typename Done>
+static void serveUntil(Done done, unsigned long timeoutMs) {
+    unsigned long start = millis();
+    while (!done() && millis() - start < timeoutMs) {
+        serveOnce();
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+static uint32_t percentile(std::vector<uint32_t>& samples, int pct) {
+    if (samples.empty()) return 0;
+    std::sort(samples.begin(), samples.end());
+    return samples[(samples.size() - 1) * pct / 100];
+}
+
+// ---------------------------------------------------------------------------
+// Tests
+// ---------------------------------------------------------------------------
+
+void setUp() {
+    worstPassUs = 0;
+}
+
+void tearDown() {
+    // Let the server see every closed socket before the next test
+    serveUntil([] { return server.getOpenConnections() == 0; }, 1000);
+}
+
+void test_keep_alive_load() {
+    std::atomic<int> finished(0);
+    std::atomic<int> failures(0);
+    std::vector<uint32_t> latencies[LOAD_CLIENTS];
+    std::vector<std::thread> clients;
+
+    for (int c = 0; c < LOAD_CLIENTS; c++) {
+        clients.emplace_back([c, &finished, &failures, &latencies] {
+            TestClient client;
+            Response response;
+            for (int i = 0; i < LOAD_REQUESTS; i++) {
+                bool pageRequest = i % 4 == 0;
+                uint32_t start = micros();
+                client.request("GET", pageRequest ? "/" : "/api/status");
+                if (!client.readResponse(response) || response.status != 200 ||
+                    response.body.size() != (pageRequest ? (size_t)PAGE_SIZE : strlen("{\"ok\":true}"))) {
+                    failures++;
+                    break;
+                }
+                latencies[c].push_back(micros() - start);
+            }
+            finished++;
+        });
+    }
+
+    serveUntil([&finished] { return finished == LOAD_CLIENTS; }, 30000);
+    for (std::thread& t : clients) t.join();
+
+    std::vector<uint32_t> all;
+    for (auto& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    char line[160];
+    snprintf(line, sizeof(line), "  %u requests on %d keep-alive clients: p50 %uus, p99 %uus, max %uus; worst pass %uus",
+             (unsigned)all.size(), LOAD_CLIENTS, (unsigned)percentile(all, 50), (unsigned)percentile(all, 99),
+             (unsigned)percentile(all, 100), (unsigned)worstPassUs);
+    TEST_MESSAGE(line);
+
+    TEST_ASSERT_EQUAL(0, failures.load());
+    TEST_ASSERT_EQUAL(LOAD_CLIENTS * LOAD_REQUESTS, all.size());
+    TEST_ASSERT_LESS_THAN(HANDLE_BUDGET_US, worstPassUs);
+}
+
+void test_stalled_reader_does_not_block_others() {
+    // Asks for 256KB and never reads: its socket fills within a few KB
+    TestClient stalled(STALLED_RCVBUF);
+    stalled.request("GET", "/api/big");
+    serveUntil([] { return false; }, 200);
+
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+    std::vector<uint32_t> latencies;
+    std::thread reader([&done, &failures, &latencies] {
+        TestClient client;
+        Response response;
+        for (int i = 0; i < LOAD_REQUESTS; i++) {
+            uint32_t start = micros();
+            client.request("GET", "/");
+            if (!client.readResponse(response) || response.body.size() != PAGE_SIZE) {
+                failures++;
+                break;
+            }
+            latencies.push_back(micros() - start);
+        }
+        // A full chunked body while the stalled response is still pending
+        client.request("GET", "/api/big");
+        if (!client.readResponse(response) || response.body.size() != BIG_BLOCKS * sizeof(block)) {
+            failures++;
+        }
+        done = true;
+    });
+
+    serveUntil([&done] { return done.load(); }, 30000);
+    reader.join();
+
+    char line[160];
+    snprintf(line, sizeof(line), "  next to a stalled client: p50 %uus, p99 %uus; worst pass %uus",
+             (unsigned)percentile(latencies, 50), (unsigned)percentile(latencies, 99), (unsigned)worstPassUs);
+    TEST_MESSAGE(line);
+
+    TEST_ASSERT_EQUAL(0, failures.load());
+    TEST_ASSERT_LESS_THAN(HANDLE_BUDGET_US, worstPassUs);
+
+    // Once the reader's close is seen, only the stalled response is left, still waiting
+    serveUntil([] { return server.getOpenConnections() <= 1; }, 1000);
+    TEST_ASSERT_EQUAL(1, server.getOpenConnections());
+}
+
+void test_stalled_event_client_is_dropped() {
+    TestClient live;
+    TestClient stalled(STALLED_RCVBUF);
+    live.request("GET", "/api/events");
+    stalled.request("GET", "/api/events");
+    serveUntil([] { return server.getEventStreamCount() == 2; }, 2000);
+    TEST_ASSERT_EQUAL(2, server.getEventStreamCount());
+
+    // The live client reads everything; the stalled one falls behind
+    const int EVENTS = 300;
+    std::atomic<int> received(0);
+    std::thread reader([&live, &received] {
+        std::string event;
+        live.readEvent(event);  // "retry: 3000"
+        while (received < EVENTS && live.readEvent(event)) {
+            if (event.find("event: tick") == 0) received++;
+        }
+    });
+
+    String data = "{\"seq\":0,\"pad\":\"" + String(std::string(256, 'x').c_str()) + "\"}";
+    for (int i = 0; i < EVENTS; i++) {
+        uint32_t start = micros();
+        server.broadcastEvent("tick", data);
+        worstPassUs = max(worstPassUs, (uint32_t)(micros() - start));
+        serveUntil([] { return false; }, 2);
+    }
+    serveUntil([&received] { return received == EVENTS; }, 5000);
+    reader.join();
+
+    TEST_ASSERT_EQUAL(EVENTS, received.load());
+    TEST_ASSERT_EQUAL(1, server.getEventStreamCount());  // Stalled one dropped
+    TEST_ASSERT_TRUE(stalled.closedByServer());
+    TEST_ASSERT_LESS_THAN(HANDLE_BUDGET_US, worstPassUs);
+}
+
+void test_head_sends_headers_only() {
+    TestClient client;
+    Response response;
+
+    // HEAD then GET on one connection: a stray HEAD body would corrupt the GET
+    client.request("HEAD", "/");
+    serveUntil([] { return false; }, 50);
+    client.request("GET", "/api/status");
+    serveUntil([] { return false; }, 50);
+    TEST_ASSERT_TRUE(client.readResponse(response, true));
+    TEST_ASSERT_EQUAL(200, response.status);
+    TEST_ASSERT_TRUE(response.headers.find("Content-Length: 20000") != std::string::npos);
+    TEST_ASSERT_TRUE(client.readResponse(response));
+    TEST_ASSERT_EQUAL_STRING("{\"ok\":true}", response.body.c_str());
+
+    // Chunked route: headers, no chunks, not even the last one
+    client.request("HEAD", "/api/big");
+    serveUntil([] { return false; }, 50);
+    client.request("GET", "/api/status");
+    serveUntil([] { return false; }, 50);
+    TEST_ASSERT_TRUE(client.readResponse(response, true));
+    TEST_ASSERT_TRUE(response.headers.find("Transfer-Encoding: chunked") != std::string::npos);
+    TEST_ASSERT_TRUE(client.readResponse(response));
+    TEST_ASSERT_EQUAL_STRING("{\"ok\":true}", response.body.c_str());
+
+    // POST-only routes don't answer HEAD
+    client.request("HEAD", "/api/save");
+    serveUntil([] { return false; }, 50);
+    TEST_ASSERT_TRUE(client.readResponse(response, true));
+    TEST_ASSERT_EQUAL(404, response.status);
+}
+
+void test_write_timeout_drops_stalled_response() {
+    // Runs last: switches to virtual time to skip the timeout
+    TestClient stalled(STALLED_RCVBUF);
+    stalled.request("GET", "/api/big");
+    serveUntil([] { return false; }, 200);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, server.getOpenConnections());
+
+    hostUseVirtualTime(millis());
+    hostAdvance(HTTP_WRITE_TIMEOUT + 1);
+    server.handleClient();
+    server.handleClient();
+
+    TEST_ASSERT_EQUAL(0, server.getOpenConnections());
+    TEST_ASSERT_TRUE(stalled.closedByServer());
+}
+
+int main() {
+    memset(page, 'p', sizeof(page));
+    memset(block, 'b', sizeof(block));
+
+    server.on("/", HTTP_GET, [] { server.send_P(200, "text/html", page, sizeof(page)); });
+    server.on("/api/status", HTTP_GET, [] { server.send(200, "application/json", "{\"ok\":true}"); });
+    server.on("/api/save", HTTP_POST, [] { server.send(200, "application/json", "{\"saved\":true}"); });
+    server.on("/api/big", HTTP_GET, [] {
+        server.sendChunked(200, "application/octet-stream", [sent = 0](Print& out) mutable {
+            if (sent == BIG_BLOCKS) return false;
+            out.write(block, sizeof(block));
+            sent++;
+            return true;
+        });
+    });
+    server.on("/api/events", HTTP_GET, [] {
+        if (!server.beginEventStream()) {
+            server.send(503, "application/json", "{\"error\":\"Too many event streams\"}");
+        }
+    });
+    server.begin();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_keep_alive_load);
+    RUN_TEST(test_stalled_reader_does_not_block_others);
+    RUN_TEST(test_stalled_event_client_is_dropped);
+    RUN_TEST(test_head_sends_headers_only);
+    RUN_TEST(test_write_timeout_drops_stalled_response);
+    return UNITY_END();
+}
@@ -0,0 +1,256 @@
+// Fetch worker on a host thread against a deliberately slow local upstream:
+// loop() (dispatchResults() plus submissions) must keep running every few
+// milliseconds while requests block the worker for seconds.
+
+#include <Arduino.h>
+#include <unity.h>
+#include <arpa/inet.h>
+#include <lwip/sockets.h>
+#include <atomic>
+#include "fetch_worker.h"
+
+#define UPSTREAM_DELAY_MS 1500   // Each upstream request takes this long to answer
+// Longest acceptable loop() pass. A pass that waited on the network would take
+// UPSTREAM_DELAY_MS; the budget only leaves room for host scheduler jitter
+#define LOOP_BUDGET_US 50000
+
+static uint16_t upstreamPort = 0;
+static std::atomic<uint32_t> upstreamDelayMs(UPSTREAM_DELAY_MS);
+
+#define UPSTREAM_BODY "{\"price\":42.5,\"volume\":1200}"
+
+// Local upstream: accepts, waits, then answers every request with a small JSON body
+static void upstreamMain(int listenFd) {
+    for (;;) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) continue;
+        char request[512];
+        lwip_recv(fd, request, sizeof(request), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(upstreamDelayMs.load()));
+        const char* reply = "HTTP/1.0 200 OK\r\nContent-Type: application/json\r\n\r\n" UPSTREAM_BODY;
+        lwip_send(fd, reply, strlen(reply), 0);
+        ::close(fd);
+    }
+}
+
+static void startUpstream() {
+    int listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    TEST_ASSERT_EQUAL(0, bind(listenFd, (sockaddr*)&addr, sizeof(addr)));
+    TEST_ASSERT_EQUAL(0, listen(listenFd, 16));
+    socklen_t len = sizeof(addr);
+    getsockname(listenFd, (sockaddr*)&addr, &len);
+    upstreamPort = ntohs(addr.sin_port);
+    std::thread(upstreamMain, listenFd).detach();
+}
+
+// Blocking GET against the local upstream: the body after the blank line
+static bool upstreamGet(String& body, String& errorMsg, int* httpCode) {
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(upstreamPort);
+    if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+        ::close(fd);
+        errorMsg = "Connection refused";
+        if (httpCode) *httpCode = -1;
+        return false;
+    }
+    lwip_send(fd, "GET / HTTP/1.0\r\n\r\n", 18, 0);
+
+    String response;
+    char buf[256];
+    ssize_t n;
+    while ((n = lwip_recv(fd, buf, sizeof(buf), 0)) > 0) {
+        response.concat(buf, n);
+    }
+    ::close(fd);
+
+    int split = response.indexOf("\r\n\r\n");
+    if (split < 0) {
+        errorMsg = "Truncated response";
+        if (httpCode) *httpCode = -5;
+        return false;
+    }
+    body = response.substring(split + 4);
+    if (httpCode) *httpCode = 200;
+    return true;
+}
+
+// Network manager with the calls the worker makes, all through the slow upstream
+#define NETWORK_H
+class HostConnectionPool {
+public:
+    void closeIdle() {}
+};
+
+class NetworkManager {
+public:
+    HostConnectionPool pool;
+    HostConnectionPool& getConnectionPool() { return pool; }
+
+    bool httpGet(const char* url, String& response, String& errorMsg, int* httpCode = nullptr,
+                 FetchTrace* trace = nullptr) {
+        return upstreamGet(response, errorMsg, httpCode);
+    }
+    bool httpGetWithHeaders(const char* url, String& response, String& errorMsg, int* httpCode = nullptr,
+                            FetchTrace* trace = nullptr) {
+        return upstreamGet(response, errorMsg, httpCode);
+    }
+    bool httpGetJson(const FetchRequest& request, JsonDocument& doc, String& errorMsg, int* httpCode = nullptr,
+                     FetchTrace* trace = nullptr) {
+        String body;
+        if (!upstreamGet(body, errorMsg, httpCode)) return false;
+        // Same call as NetworkManager::httpRequest(), on the whole body instead of the socket
+        DeserializationError error = request.filter
+            ? deserializeJson(doc, body, DeserializationOption::Filter(request.filter->as<JsonVariantConst>()))
+            : deserializeJson(doc, body);
+        if (error) {
+            errorMsg = error.c_str();
+            return false;
+        }
+        return true;
+    }
+};
+
+#include "../../src/fetch_worker.cpp"
+
+NetworkManager network;
+FetchWorker fetchWorker;
+
+struct Completion {
+    std::thread::id thread;
+    int order;
+    bool success;
+    String body;
+    float price;
+    bool hasVolume;
+};
+
+static std::vector<Completion> completions;
+
+static FetchCallback recordAs(int order) {
+    return [order](FetchResult& result) {
+        completions.push_back({std::this_thread::get_id(), order, result.success, result.body,
+                               result.doc ? (*result.doc)["price"] | 0.0f : 0.0f,
+                               result.doc && result.doc->containsKey("volume")});
+    };
+}
+
+static uint32_t loopPasses = 0;
+
+// loop() stand-in: hands results back and times each pass until count callbacks ran
+static uint32_t runLoopUntil(size_t count, unsigned long timeoutMs) {
+    uint32_t worstUs = 0;
+    loopPasses = 0;
+    unsigned long start = millis();
+    while (completions.size() < count && millis() - start < timeoutMs) {
+        uint32_t passStart = micros();
+        fetchWorker.dispatchResults();
+        worstUs = max(worstUs, (uint32_t)(micros() - passStart));
+        loopPasses++;
+        delay(1);  // The rest of loop(): button, display
+    }
+    return worstUs;
+}
+
+void setUp() {
+    completions.clear();
+    upstreamDelayMs = UPSTREAM_DELAY_MS;
+}
+
+void tearDown() {}
+
+void test_loop_stays_responsive_while_upstream_is_slow() {
+    TEST_ASSERT_TRUE(fetchWorker.init());
+
+    // Two body fetches and two streamed parses (one filtered), 6s of upstream time in total
+    FetchRequest plain;
+    plain.url = "http://127.0.0.1/plain";
+    FetchRequest browser;
+    browser.url = "http://127.0.0.1/browser";
+    browser.withHeaders = true;
+    FetchRequest streamed;
+    streamed.url = "http://127.0.0.1/streamed";
+    streamed.docCapacity = 256;
+    FetchRequest filtered;
+    filtered.url = "http://127.0.0.1/filtered";
+    filtered.docCapacity = 256;
+    filtered.newFilter()["price"] = true;
+
+    uint32_t submitUs = micros();
+    TEST_ASSERT_TRUE(fetchWorker.submit(std::move(plain), recordAs(0)));
+    TEST_ASSERT_TRUE(fetchWorker.submit(std::move(browser), recordAs(1)));
+    TEST_ASSERT_TRUE(fetchWorker.submit(std::move(streamed), recordAs(2)));
+    TEST_ASSERT_TRUE(fetchWorker.submit(std::move(filtered), recordAs(3)));
+    submitUs = micros() - submitUs;
+    TEST_ASSERT_TRUE(fetchWorker.isBusy());
+
+    uint32_t worstUs = runLoopUntil(4, 5 * UPSTREAM_DELAY_MS);
+
+    char line[160];
+    snprintf(line, sizeof(line), "4 fetches x %dms upstream: submit %uus, %u loop passes, worst %uus",
+             UPSTREAM_DELAY_MS, (unsigned)submitUs, (unsigned)loopPasses, (unsigned)worstUs);
+    TEST_MESSAGE(line);
+
+    TEST_ASSERT_EQUAL(4, completions.size());
+    TEST_ASSERT_LESS_THAN(LOOP_BUDGET_US, submitUs);
+    TEST_ASSERT_LESS_THAN(LOOP_BUDGET_US, worstUs);
+    TEST_ASSERT_FALSE(fetchWorker.isBusy());
+    // loop() kept its ~1ms period instead of stalling behind each fetch
+    TEST_ASSERT_GREATER_THAN(UPSTREAM_DELAY_MS, loopPasses);
+
+    // Callbacks run on the loop thread, in submission order
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(completions[i].thread == std::this_thread::get_id());
+        TEST_ASSERT_EQUAL(i, completions[i].order);
+        TEST_ASSERT_TRUE(completions[i].success);
+    }
+    TEST_ASSERT_EQUAL_STRING(UPSTREAM_BODY, completions[0].body.c_str());
+    TEST_ASSERT_EQUAL_FLOAT(42.5f, completions[2].price);
+    TEST_ASSERT_TRUE(completions[2].hasVolume);
+    // The filter travelled with the moved request: only price was kept
+    TEST_ASSERT_EQUAL_FLOAT(42.5f, completions[3].price);
+    TEST_ASSERT_FALSE(completions[3].hasVolume);
+}
+
+void test_full_queue_rejects_without_blocking() {
+    TEST_ASSERT_TRUE(fetchWorker.init());
+    upstreamDelayMs = 200;
+
+    // The worker holds one job; FETCH_QUEUE_LENGTH more wait; the rest are refused at once
+    int accepted = 0;
+    uint32_t worstSubmitUs = 0;
+    for (int i = 0; i < FETCH_QUEUE_LENGTH + 4; i++) {
+        FetchRequest request;
+        request.url = "http://127.0.0.1/burst";
+        uint32_t start = micros();
+        if (fetchWorker.submit(std::move(request), recordAs(i))) accepted++;
+        worstSubmitUs = max(worstSubmitUs, (uint32_t)(micros() - start));
+        if (i == 0) delay(50);  // Let the worker pick up the first job
+    }
+
+    TEST_ASSERT_LESS_THAN(FETCH_QUEUE_LENGTH + 4, accepted);
+    TEST_ASSERT_GREATER_OR_EQUAL(FETCH_QUEUE_LENGTH, accepted);
+    TEST_ASSERT_LESS_THAN(LOOP_BUDGET_US, worstSubmitUs);
+
+    uint32_t worstUs = runLoopUntil(accepted, (accepted + 2) * 200 * 2);
+    TEST_ASSERT_EQUAL(accepted, completions.size());
+    TEST_ASSERT_LESS_THAN(LOOP_BUDGET_US, worstUs);
+}
+
+int main() {
+    startUpstream();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_loop_stays_responsive_while_upstream_is_slow);
+    RUN_TEST(test_full_queue_rejects_without_blocking);
+    int failures = UNITY_END();
+
+    // The worker thread never returns (like its task); leave without joining it
+    fflush(stdout);
+    _Exit(failures);
+}
@@ -0,0 +1,326 @@
+// Captured response bodies and their encodings, as the upstream servers send them.
+// Regenerate with Python's zlib/gzip (level 6 unless noted) if a body changes.
+
+#ifndef INFLATE_FIXTURES_H
+#define INFLATE_FIXTURES_H
+
+#include <Arduino.h>
+
+// CoinGecko /simple/price, ten coins
+static const char COINGECKO_JSON[] =
+    "{\"bitcoin\":{\"usd\":22668.3273,\"usd_24h_change\":-5.586413217208},\"ethereum\":{\"usd\":45565.4306,\"usd_24h"
+    "_change\":-6.841019413319},\"solana\":{\"usd\":37511.7635,\"usd_24h_change\":-2.148977329399},\"cardano\":{\"u"
+    "sd\":4059.9718,\"usd_24h_change\":0.118971731031},\"dogecoin\":{\"usd\":2624.7442,\"usd_24h_change\":-1.06166"
+    "9061402},\"polkadot\":{\"usd\":4889.9262,\"usd_24h_change\":-6.548591786498},\"chainlink\":{\"usd\":29716.372,"
+    "\"usd_24h_change\":5.229633994753},\"avalanche-2\":{\"usd\":8666.1811,\"usd_24h_change\":-4.428176566288},\"w"
+    "rapped-staked-ether\":{\"usd\":43920.3442,\"usd_24h_change\":7.163343079312},\"the-open-network\":{\"usd\":40"
+    "397.2275,\"usd_24h_change\":-1.653112405588}}";
+
+// Content-Encoding: gzip (no optional header fields)
+static const uint8_t COINGECKO_GZIP[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x6D, 0x91, 0xC1, 0x8E, 0x83, 0x30,
+    0x0C, 0x44, 0xFF, 0x85, 0x73, 0xB1, 0x62, 0x3B, 0xB1, 0x93, 0xFE, 0x4C, 0x95, 0x85, 0xA8, 0x20,
+    0xBA, 0x80, 0x5A, 0xBA, 0x3D, 0x54, 0xFD, 0xF7, 0x35, 0x7B, 0x28, 0xBB, 0x5A, 0x2E, 0x89, 0x94,
+    0xE8, 0x79, 0xC6, 0x33, 0xCF, 0xEA, 0xA3, 0x5F, 0x9A, 0xA9, 0x1F, 0xAB, 0xE3, 0xB3, 0xBA, 0xDF,
+    0xDA, 0xEA, 0x48, 0x24, 0x12, 0x81, 0x49, 0xF9, 0xB0, 0x3E, 0x9C, 0xC8, 0x77, 0xA7, 0xA6, 0xCB,
+    0xE3, 0xB9, 0x54, 0xC7, 0x3A, 0x40, 0x88, 0xE2, 0x91, 0x09, 0x95, 0x5C, 0x7C, 0x1D, 0xAA, 0xB2,
+    0x74, 0xE5, 0x5A, 0xEE, 0x9F, 0x6F, 0xDC, 0x87, 0x20, 0x01, 0x3C, 0x3B, 0xD9, 0xC1, 0x05, 0xA2,
+    0x47, 0x87, 0xC9, 0x26, 0x30, 0x26, 0xC3, 0x6F, 0xD3, 0x25, 0x8F, 0xF9, 0x0D, 0xB3, 0x06, 0x44,
+    0x50, 0xE1, 0xB0, 0x03, 0x13, 0xA0, 0x8F, 0x49, 0x95, 0x29, 0x71, 0x5A, 0xE1, 0x26, 0x5F, 0xDB,
+    0x3C, 0x4E, 0x9B, 0xB4, 0x0B, 0x09, 0x92, 0x62, 0xFC, 0x0F, 0x3B, 0x40, 0x34, 0x16, 0x95, 0xD1,
+    0x31, 0x1A, 0xDB, 0x4E, 0xE7, 0xF2, 0x77, 0x6D, 0x21, 0x0F, 0xEA, 0x3D, 0xED, 0x28, 0x23, 0x38,
+    0x41, 0x91, 0x64, 0xA7, 0x77, 0x64, 0xF4, 0x3C, 0x5D, 0x86, 0xDC, 0x4E, 0xCB, 0x26, 0x1D, 0xA3,
+    0x49, 0xDB, 0x8C, 0xDD, 0xA5, 0x83, 0x8F, 0x21, 0xA1, 0x5A, 0x72, 0x69, 0xCD, 0xCC, 0x7E, 0xFA,
+    0xF1, 0xD2, 0x8F, 0xC3, 0x26, 0x6E, 0xD6, 0x04, 0x58, 0x77, 0xF0, 0x00, 0x44, 0x49, 0xD8, 0x36,
+    0xF6, 0x1A, 0xD8, 0xE8, 0xFC, 0x95, 0x2D, 0xB3, 0xA6, 0x2B, 0x35, 0xBD, 0xF9, 0x28, 0x22, 0x80,
+    0x11, 0x71, 0x47, 0xDE, 0x83, 0xA7, 0x88, 0x2A, 0x41, 0x84, 0xE2, 0x2A, 0xFF, 0xB8, 0xE6, 0x79,
+    0x2E, 0x6D, 0x7D, 0x5B, 0xF2, 0x60, 0xD7, 0x4F, 0x83, 0xDB, 0x22, 0x9C, 0xC8, 0x01, 0xEF, 0xE6,
+    0xA0, 0x80, 0x66, 0xC4, 0xAA, 0xD5, 0xC4, 0xB8, 0xC6, 0x60, 0x64, 0x3D, 0xCD, 0x65, 0xAC, 0xC7,
+    0xB2, 0x3C, 0xA6, 0xEB, 0xF0, 0xAB, 0x09, 0x4E, 0x6A, 0xC6, 0x75, 0xAF, 0x47, 0x04, 0x09, 0x8C,
+    0x48, 0x56, 0x57, 0x30, 0x43, 0xAF, 0x6F, 0x7E, 0x0D, 0xBE, 0x7B, 0x83, 0x02, 0x00, 0x00,
+};
+
+// Content-Encoding: deflate, zlib-wrapped (RFC 1950)
+static const uint8_t COINGECKO_ZLIB[] = {
+    0x78, 0x9C, 0x6D, 0x91, 0xC1, 0x8E, 0x83, 0x30, 0x0C, 0x44, 0xFF, 0x85, 0x73, 0xB1, 0x62, 0x3B,
+    0xB1, 0x93, 0xFE, 0x4C, 0x95, 0x85, 0xA8, 0x20, 0xBA, 0x80, 0x5A, 0xBA, 0x3D, 0x54, 0xFD, 0xF7,
+    0x35, 0x7B, 0x28, 0xBB, 0x5A, 0x2E, 0x89, 0x94, 0xE8, 0x79, 0xC6, 0x33, 0xCF, 0xEA, 0xA3, 0x5F,
+    0x9A, 0xA9, 0x1F, 0xAB, 0xE3, 0xB3, 0xBA, 0xDF, 0xDA, 0xEA, 0x48, 0x24, 0x12, 0x81, 0x49, 0xF9,
+    0xB0, 0x3E, 0x9C, 0xC8, 0x77, 0xA7, 0xA6, 0xCB, 0xE3, 0xB9, 0x54, 0xC7, 0x3A, 0x40, 0x88, 0xE2,
+    0x91, 0x09, 0x95, 0x5C, 0x7C, 0x1D, 0xAA, 0xB2, 0x74, 0xE5, 0x5A, 0xEE, 0x9F, 0x6F, 0xDC, 0x87,
+    0x20, 0x01, 0x3C, 0x3B, 0xD9, 0xC1, 0x05, 0xA2, 0x47, 0x87, 0xC9, 0x26, 0x30, 0x26, 0xC3, 0x6F,
+    0xD3, 0x25, 0x8F, 0xF9, 0x0D, 0xB3, 0x06, 0x44, 0x50, 0xE1, 0xB0, 0x03, 0x13, 0xA0, 0x8F, 0x49,
+    0x95, 0x29, 0x71, 0x5A, 0xE1, 0x26, 0x5F, 0xDB, 0x3C, 0x4E, 0x9B, 0xB4, 0x0B, 0x09, 0x92, 0x62,
+    0xFC, 0x0F, 0x3B, 0x40, 0x34, 0x16, 0x95, 0xD1, 0x31, 0x1A, 0xDB, 0x4E, 0xE7, 0xF2, 0x77, 0x6D,
+    0x21, 0x0F, 0xEA, 0x3D, 0xED, 0x28, 0x23, 0x38, 0x41, 0x91, 0x64, 0xA7, 0x77, 0x64, 0xF4, 0x3C,
+    0x5D, 0x86, 0xDC, 0x4E, 0xCB, 0x26, 0x1D, 0xA3, 0x49, 0xDB, 0x8C, 0xDD, 0xA5, 0x83, 0x8F, 0x21,
+    0xA1, 0x5A, 0x72, 0x69, 0xCD, 0xCC, 0x7E, 0xFA, 0xF1, 0xD2, 0x8F, 0xC3, 0x26, 0x6E, 0xD6, 0x04,
+    0x58, 0x77, 0xF0, 0x00, 0x44, 0x49, 0xD8, 0x36, 0xF6, 0x1A, 0xD8, 0xE8, 0xFC, 0x95, 0x2D, 0xB3,
+    0xA6, 0x2B, 0x35, 0xBD, 0xF9, 0x28, 0x22, 0x80, 0x11, 0x71, 0x47, 0xDE, 0x83, 0xA7, 0x88, 0x2A,
+    0x41, 0x84, 0xE2, 0x2A, 0xFF, 0xB8, 0xE6, 0x79, 0x2E, 0x6D, 0x7D, 0x5B, 0xF2, 0x60, 0xD7, 0x4F,
+    0x83, 0xDB, 0x22, 0x9C, 0xC8, 0x01, 0xEF, 0xE6, 0xA0, 0x80, 0x66, 0xC4, 0xAA, 0xD5, 0xC4, 0xB8,
+    0xC6, 0x60, 0x64, 0x3D, 0xCD, 0x65, 0xAC, 0xC7, 0xB2, 0x3C, 0xA6, 0xEB, 0xF0, 0xAB, 0x09, 0x4E,
+    0x6A, 0xC6, 0x75, 0xAF, 0x47, 0x04, 0x09, 0x8C, 0x48, 0x56, 0x57, 0x30, 0x43, 0xAF, 0x6F, 0x88,
+    0x23, 0xB7, 0x1E,
+};
+
+// Yahoo /v7/finance/spark, five tickers
+static const char YAHOO_JSON[] =
+    "{\"spark\":{\"result\":[{\"symbol\":\"AAPL\",\"response\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"AAPL\",\"exchange"
+    "Name\":\"NMS\",\"fullExchangeName\":\"NasdaqGS\",\"instrumentType\":\"EQUITY\",\"firstTradeDate\":345479400,\"regu"
+    "larMarketTime\":1729022401,\"hasPrePostMarketData\":true,\"gmtoffset\":-14400,\"timezone\":\"EDT\",\"exchangeT"
+    "imezoneName\":\"America/New_York\",\"regularMarketPrice\":231.78,\"fiftyTwoWeekHigh\":280.45,\"fiftyTwoWeekL"
+    "ow\":164.56,\"regularMarketDayHigh\":234.1,\"regularMarketDayLow\":228.3,\"regularMarketVolume\":30673100,\""
+    "longName\":\"AAPL Inc.\",\"shortName\":\"AAPL Inc.\",\"chartPreviousClose\":230.16,\"previousClose\":230.16,\"sc"
+    "ale\":3,\"priceHint\":2,\"currentTradingPeriod\":{\"pre\":{\"timezone\":\"EDT\",\"start\":1729065600,\"end\":172908"
+    "5400,\"gmtoffset\":-14400},\"regular\":{\"timezone\":\"EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\""
+    ":-14400},\"post\":{\"timezone\":\"EDT\",\"start\":1729108800,\"end\":1729123200,\"gmtoffset\":-14400}},\"tradingP"
+    "eriods\":[[{\"timezone\":\"EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400}]],\"dataGranulari"
+    "ty\":\"1d\",\"range\":\"1d\",\"validRanges\":[\"1d\",\"5d\",\"1mo\",\"3mo\",\"6mo\",\"1y\",\"2y\",\"5y\",\"10y\",\"ytd\",\"max\"]},"
+    "\"timestamp\":[1729085400],\"indicators\":{\"quote\":[{\"close\":[231.78]}],\"adjclose\":[{\"adjclose\":[231.78]"
+    "}]}}]},{\"symbol\":\"MSFT\",\"response\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"MSFT\",\"exchangeName\":\"NMS\",\""
+    "fullExchangeName\":\"NasdaqGS\",\"instrumentType\":\"EQUITY\",\"firstTradeDate\":345479400,\"regularMarketTime"
+    "\":1729022401,\"hasPrePostMarketData\":true,\"gmtoffset\":-14400,\"timezone\":\"EDT\",\"exchangeTimezoneName\":"
+    "\"America/New_York\",\"regularMarketPrice\":416.12,\"fiftyTwoWeekHigh\":503.51,\"fiftyTwoWeekLow\":295.45,\"r"
+    "egularMarketDayHigh\":420.28,\"regularMarketDayLow\":409.88,\"regularMarketVolume\":7252221,\"longName\":\"M"
+    "SFT Inc.\",\"shortName\":\"MSFT Inc.\",\"chartPreviousClose\":413.21,\"previousClose\":413.21,\"scale\":3,\"pric"
+    "eHint\":2,\"currentTradingPeriod\":{\"pre\":{\"timezone\":\"EDT\",\"start\":1729065600,\"end\":1729085400,\"gmtoff"
+    "set\":-14400},\"regular\":{\"timezone\":\"EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400},\"po"
+    "st\":{\"timezone\":\"EDT\",\"start\":1729108800,\"end\":1729123200,\"gmtoffset\":-14400}},\"tradingPeriods\":[[{\""
+    "timezone\":\"EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400}]],\"dataGranularity\":\"1d\",\"ra"
+    "nge\":\"1d\",\"validRanges\":[\"1d\",\"5d\",\"1mo\",\"3mo\",\"6mo\",\"1y\",\"2y\",\"5y\",\"10y\",\"ytd\",\"max\"]},\"timestamp\":"
+    "[1729085400],\"indicators\":{\"quote\":[{\"close\":[416.12]}],\"adjclose\":[{\"adjclose\":[416.12]}]}}]},{\"sym"
+    "bol\":\"NVDA\",\"response\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"NVDA\",\"exchangeName\":\"NMS\",\"fullExchange"
+    "Name\":\"NasdaqGS\",\"instrumentType\":\"EQUITY\",\"firstTradeDate\":345479400,\"regularMarketTime\":1729022401"
+    ",\"hasPrePostMarketData\":true,\"gmtoffset\":-14400,\"timezone\":\"EDT\",\"exchangeTimezoneName\":\"America/New"
+    "_York\",\"regularMarketPrice\":131.6,\"fiftyTwoWeekHigh\":159.24,\"fiftyTwoWeekLow\":93.44,\"regularMarketDa"
+    "yHigh\":132.92,\"regularMarketDayLow\":129.63,\"regularMarketVolume\":75714297,\"longName\":\"NVDA Inc.\",\"sh"
+    "ortName\":\"NVDA Inc.\",\"chartPreviousClose\":130.68,\"previousClose\":130.68,\"scale\":3,\"priceHint\":2,\"cur"
+    "rentTradingPeriod\":{\"pre\":{\"timezone\":\"EDT\",\"start\":1729065600,\"end\":1729085400,\"gmtoffset\":-14400},"
+    "\"regular\":{\"timezone\":\"EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400},\"post\":{\"timezon"
+    "e\":\"EDT\",\"start\":1729108800,\"end\":1729123200,\"gmtoffset\":-14400}},\"tradingPeriods\":[[{\"timezone\":\"ED"
+    "T\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400}]],\"dataGranularity\":\"1d\",\"range\":\"1d\",\"va"
+    "lidRanges\":[\"1d\",\"5d\",\"1mo\",\"3mo\",\"6mo\",\"1y\",\"2y\",\"5y\",\"10y\",\"ytd\",\"max\"]},\"timestamp\":[1729085400],"
+    "\"indicators\":{\"quote\":[{\"close\":[131.6]}],\"adjclose\":[{\"adjclose\":[131.6]}]}}]},{\"symbol\":\"GOOGL\",\"r"
+    "esponse\":[{\"meta\":{\"currency\":\"USD\",\"symbol\":\"GOOGL\",\"exchangeName\":\"NMS\",\"fullExchangeName\":\"Nasdaq"
+    "GS\",\"instrumentType\":\"EQUITY\",\"firstTradeDate\":345479400,\"regularMarketTime\":1729022401,\"hasPrePostM"
+    "arketData\":true,\"gmtoffset\":-14400,\"timezone\":\"EDT\",\"exchangeTimezoneName\":\"America/New_York\",\"regul"
+    "arMarketPrice\":165.16,\"fiftyTwoWeekHigh\":199.84,\"fiftyTwoWeekLow\":117.26,\"regularMarketDayHigh\":166."
+    "81,\"regularMarketDayLow\":162.68,\"regularMarketVolume\":18874421,\"longName\":\"GOOGL Inc.\",\"shortName\":\""
+    "GOOGL Inc.\",\"chartPreviousClose\":164.0,\"previousClose\":164.0,\"scale\":3,\"priceHint\":2,\"currentTrading"
+    "Period\":{\"pre\":{\"timezone\":\"EDT\",\"start\":1729065600,\"end\":1729085400,\"gmtoffset\":-14400},\"regular\":{"
+    "\"timezone\":\"EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400},\"post\":{\"timezone\":\"EDT\",\"s"
+    "tart\":1729108800,\"end\":1729123200,\"gmtoffset\":-14400}},\"tradingPeriods\":[[{\"timezone\":\"EDT\",\"start\":"
+    "1729085400,\"end\":1729108800,\"gmtoffset\":-14400}]],\"dataGranularity\":\"1d\",\"range\":\"1d\",\"validRanges\":"
+    "[\"1d\",\"5d\",\"1mo\",\"3mo\",\"6mo\",\"1y\",\"2y\",\"5y\",\"10y\",\"ytd\",\"max\"]},\"timestamp\":[1729085400],\"indicators"
+    "\":{\"quote\":[{\"close\":[165.16]}],\"adjclose\":[{\"adjclose\":[165.16]}]}}]},{\"symbol\":\"AMZN\",\"response\":["
+    "{\"meta\":{\"currency\":\"USD\",\"symbol\":\"AMZN\",\"exchangeName\":\"NMS\",\"fullExchangeName\":\"NasdaqGS\",\"instru"
+    "mentType\":\"EQUITY\",\"firstTradeDate\":345479400,\"regularMarketTime\":1729022401,\"hasPrePostMarketData\":"
+    "true,\"gmtoffset\":-14400,\"timezone\":\"EDT\",\"exchangeTimezoneName\":\"America/New_York\",\"regularMarketPri"
+    "ce\":187.69,\"fiftyTwoWeekHigh\":227.1,\"fiftyTwoWeekLow\":133.26,\"regularMarketDayHigh\":189.57,\"regularM"
+    "arketDayLow\":184.87,\"regularMarketVolume\":39870700,\"longName\":\"AMZN Inc.\",\"shortName\":\"AMZN Inc.\",\"c"
+    "hartPreviousClose\":186.38,\"previousClose\":186.38,\"scale\":3,\"priceHint\":2,\"currentTradingPeriod\":{\"pr"
+    "e\":{\"timezone\":\"EDT\",\"start\":1729065600,\"end\":1729085400,\"gmtoffset\":-14400},\"regular\":{\"timezone\":\""
+    "EDT\",\"start\":1729085400,\"end\":1729108800,\"gmtoffset\":-14400},\"post\":{\"timezone\":\"EDT\",\"start\":172910"
+    "8800,\"end\":1729123200,\"gmtoffset\":-14400}},\"tradingPeriods\":[[{\"timezone\":\"EDT\",\"start\":1729085400,\""
+    "end\":1729108800,\"gmtoffset\":-14400}]],\"dataGranularity\":\"1d\",\"range\":\"1d\",\"validRanges\":[\"1d\",\"5d\",\""
+    "1mo\",\"3mo\",\"6mo\",\"1y\",\"2y\",\"5y\",\"10y\",\"ytd\",\"max\"]},\"timestamp\":[1729085400],\"indicators\":{\"quote\":["
+    "{\"close\":[187.69]}],\"adjclose\":[{\"adjclose\":[187.69]}]}}]}],\"error\":null}}";
+
+// Content-Encoding: gzip, level 9 with FNAME and mtime
+static const uint8_t YAHOO_GZIP[] = {
+    0x1F, 0x8B, 0x08, 0x08, 0xC1, 0xC9, 0x0E, 0x67, 0x02, 0xFF, 0x73, 0x70, 0x61, 0x72, 0x6B, 0x2E,
+    0x6A, 0x73, 0x6F, 0x6E, 0x00, 0xED, 0x98, 0x5F, 0x6F, 0xD3, 0x30, 0x10, 0xC0, 0xBF, 0x0A, 0xCA,
+    0x73, 0x31, 0xB1, 0xE3, 0x24, 0xCE, 0xDE, 0x2A, 0x0A, 0x03, 0x89, 0x95, 0xC2, 0x0A, 0x08, 0xA6,
+    0x0A, 0x85, 0xC6, 0xEB, 0x02, 0x49, 0x5C, 0x12, 0x97, 0x51, 0xA6, 0x7E, 0x77, 0xEE, 0x9C, 0x64,
+    0x74, 0xA9, 0x53, 0x54, 0xC4, 0x63, 0xA4, 0xC9, 0x53, 0xEF, 0x5F, 0xCE, 0x3E, 0xDF, 0x4F, 0xB6,
+    0xEF, 0x9C, 0x6A, 0x1D, 0x97, 0xDF, 0x9C, 0xB3, 0x3B, 0xA7, 0x94, 0xD5, 0x26, 0xD3, 0xCE, 0xD9,
+    0xD5, 0x9D, 0x53, 0x6D, 0xF3, 0x2F, 0x2A, 0x73, 0xCE, 0x9C, 0xF1, 0x78, 0xF6, 0xCA, 0x19, 0xA1,
+    0x6A, 0xAD, 0x8A, 0x4A, 0x1A, 0x65, 0x2E, 0x75, 0x8C, 0xF6, 0xCB, 0x4D, 0x59, 0xCA, 0x62, 0xB9,
+    0x05, 0xB3, 0x77, 0x97, 0x13, 0xB0, 0xEA, 0x7A, 0xC9, 0x9F, 0xCB, 0x9B, 0xB8, 0x58, 0xC9, 0x69,
+    0x9C, 0x83, 0xA7, 0x33, 0xBD, 0xB8, 0x04, 0xE1, 0xF5, 0x26, 0xCB, 0x9E, 0x75, 0x14, 0x71, 0x95,
+    0xC4, 0xDF, 0xCF, 0x51, 0x9B, 0x16, 0x95, 0x2E, 0x37, 0xB9, 0x2C, 0xF4, 0x7C, 0xBB, 0x46, 0xDD,
+    0xB3, 0x37, 0xEF, 0x5E, 0xCE, 0x3F, 0xA2, 0x5F, 0x5A, 0x56, 0x7A, 0x5E, 0xC6, 0x89, 0x9C, 0xC4,
+    0x1A, 0x34, 0x1E, 0xF7, 0x79, 0x18, 0x71, 0xD7, 0xC5, 0xEC, 0x56, 0x9B, 0x2C, 0x2E, 0x2F, 0x60,
+    0x1E, 0x52, 0xCF, 0x53, 0x8C, 0x49, 0x43, 0x16, 0xB9, 0x8C, 0x71, 0x97, 0x8E, 0x9C, 0x9B, 0xB8,
+    0x9A, 0x95, 0x72, 0xA6, 0x2A, 0x5D, 0x5B, 0x80, 0x3F, 0xE4, 0x0F, 0x9F, 0x91, 0x23, 0x67, 0x95,
+    0x6B, 0x75, 0x7D, 0x5D, 0x49, 0x98, 0xF6, 0x63, 0xCA, 0x4D, 0x34, 0x0D, 0x01, 0x7E, 0xA9, 0xC2,
+    0x7C, 0x7C, 0x32, 0xDF, 0x9B, 0xC6, 0xBC, 0x51, 0x34, 0x59, 0x8F, 0x73, 0x59, 0xA6, 0xCB, 0xF8,
+    0xC9, 0x54, 0xDE, 0x7E, 0xFE, 0xA8, 0x60, 0x09, 0x3B, 0x89, 0xCC, 0x40, 0x0B, 0x76, 0xCC, 0xA3,
+    0x24, 0x14, 0x98, 0xFF, 0xB5, 0xDE, 0xCE, 0x6F, 0xD5, 0x07, 0x29, 0xBF, 0xBD, 0x48, 0x57, 0x37,
+    0xA0, 0x11, 0x2E, 0xE1, 0xFE, 0x43, 0xCD, 0x2B, 0x75, 0x0B, 0xC9, 0x07, 0x9C, 0xF8, 0x41, 0x27,
+    0xDC, 0x24, 0xDE, 0x36, 0x6E, 0x1E, 0x27, 0xF4, 0x50, 0x69, 0x3C, 0x19, 0x13, 0xC4, 0xEB, 0xE8,
+    0xDE, 0xAB, 0x6C, 0x83, 0x09, 0x7B, 0x6E, 0x10, 0x7A, 0x14, 0x67, 0x98, 0xA9, 0x62, 0xD5, 0x4E,
+    0x02, 0x2A, 0xF5, 0xE8, 0x65, 0xB1, 0x24, 0x58, 0xBE, 0x1B, 0x55, 0x6A, 0x8B, 0x1C, 0x66, 0x5F,
+    0xC2, 0x6C, 0xE4, 0x8F, 0x54, 0x6D, 0xAA, 0xA7, 0x99, 0xAA, 0xCC, 0xAC, 0x5C, 0x42, 0x21, 0xC5,
+    0xB5, 0x5D, 0x5C, 0x2D, 0xE3, 0x0C, 0x3F, 0x89, 0x06, 0xB0, 0x0A, 0x2F, 0xD2, 0x02, 0x16, 0x98,
+    0x8D, 0x9A, 0x2D, 0x63, 0xCA, 0x98, 0x16, 0xAB, 0x19, 0x2C, 0xA0, 0x4A, 0x70, 0x2B, 0x41, 0x18,
+    0xFC, 0x77, 0xB0, 0xF4, 0x95, 0x86, 0x4F, 0x37, 0xD5, 0x0C, 0xFC, 0x00, 0x93, 0x97, 0x45, 0xD2,
+    0x08, 0x84, 0x6F, 0xEA, 0x75, 0x50, 0xC2, 0xDD, 0xFD, 0x02, 0xFC, 0x35, 0x66, 0x13, 0xE2, 0x3E,
+    0x26, 0x75, 0x85, 0xE8, 0x8B, 0xB9, 0x86, 0x0D, 0xF4, 0xB7, 0x80, 0xAD, 0xFF, 0x9F, 0x80, 0xCC,
+    0x63, 0xF6, 0x80, 0x10, 0x51, 0xEF, 0x2F, 0x43, 0x05, 0xBD, 0x75, 0xF5, 0xDF, 0xD2, 0x5D, 0x2C,
+    0x46, 0x4E, 0x02, 0xFB, 0xFC, 0xBC, 0x8C, 0x0B, 0x5C, 0x89, 0x54, 0x63, 0x9B, 0xD2, 0x04, 0x37,
+    0x29, 0xEE, 0xE5, 0xF6, 0xC7, 0x8F, 0x38, 0x4B, 0x93, 0xB7, 0x28, 0xC1, 0xEF, 0xD7, 0x32, 0x1F,
+    0x07, 0x9A, 0x2B, 0x18, 0x3D, 0x33, 0x06, 0x66, 0xA4, 0x5B, 0x18, 0x18, 0x0E, 0x3E, 0x0E, 0xD4,
+    0xC5, 0x71, 0xAB, 0xD1, 0x38, 0x8F, 0x7F, 0x3A, 0x8B, 0x5D, 0xDD, 0x3A, 0x90, 0x6F, 0xBE, 0x86,
+    0x58, 0x7F, 0x12, 0x5E, 0x60, 0x5B, 0x27, 0xD0, 0x2A, 0x5A, 0x95, 0x15, 0xAE, 0xE0, 0xF7, 0x8D,
+    0xD2, 0x35, 0x4A, 0x96, 0xF5, 0xB6, 0xB9, 0xAA, 0x9B, 0x64, 0xB1, 0x03, 0xD3, 0x38, 0xF9, 0xDA,
+    0x4A, 0xEF, 0xF6, 0x7F, 0xDC, 0x9B, 0xEC, 0xE0, 0x6F, 0xB4, 0x87, 0xA8, 0x8B, 0xCB, 0xE7, 0xF3,
+    0xD3, 0x11, 0xD5, 0x78, 0x0D, 0x88, 0x02, 0x3B, 0x4E, 0x03, 0x42, 0x99, 0x0D, 0x51, 0xBE, 0xEB,
+    0x11, 0x9F, 0x5A, 0x10, 0xC5, 0x22, 0xDF, 0xB0, 0xCB, 0x8E, 0x28, 0xCE, 0x5C, 0xC2, 0x44, 0x0F,
+    0xA3, 0xB8, 0x1B, 0x11, 0x21, 0x7A, 0x20, 0x15, 0x32, 0x9F, 0x31, 0x46, 0x1F, 0x30, 0x0A, 0x4B,
+    0x65, 0x63, 0xD4, 0xBE, 0xDC, 0xC6, 0x28, 0x4E, 0x3D, 0x82, 0xA1, 0xD6, 0x76, 0xF1, 0xC0, 0xA8,
+    0x81, 0x51, 0xA7, 0x30, 0xAA, 0xEE, 0x92, 0xA3, 0x8C, 0xBA, 0x37, 0xE9, 0x32, 0x6A, 0xFA, 0x7E,
+    0x32, 0x3E, 0x9D, 0x51, 0x8D, 0xD7, 0xC0, 0x28, 0xCC, 0x04, 0xF0, 0x1F, 0xD8, 0x10, 0x45, 0xFD,
+    0x88, 0x30, 0x6E, 0x41, 0x54, 0xE4, 0x11, 0xCE, 0xFB, 0x08, 0x45, 0x3D, 0x46, 0x22, 0xD6, 0x43,
+    0x28, 0xCA, 0x22, 0x12, 0xF4, 0x1D, 0xA3, 0x42, 0x3F, 0xA4, 0x9C, 0x45, 0xE1, 0x03, 0x44, 0x61,
+    0xA5, 0x6C, 0x88, 0xDA, 0x97, 0xDB, 0x10, 0x45, 0xE1, 0xBC, 0x14, 0x88, 0x03, 0x44, 0xB5, 0xE2,
+    0x01, 0x51, 0x03, 0xA2, 0x4E, 0x41, 0x94, 0x69, 0x92, 0xA3, 0x84, 0x6A, 0x2D, 0xBA, 0x80, 0x3A,
+    0x7F, 0xFD, 0xFA, 0xFC, 0x1F, 0x2E, 0x7A, 0xAD, 0xDB, 0x80, 0x28, 0xCC, 0x24, 0xF0, 0xCD, 0xE5,
+    0xC7, 0xC2, 0xA8, 0x08, 0x8E, 0x3C, 0x36, 0x46, 0x51, 0x1A, 0x12, 0xD6, 0x7B, 0xD3, 0xA3, 0x41,
+    0x40, 0x44, 0xDF, 0x55, 0x8F, 0x06, 0xCC, 0x30, 0xC2, 0x0A, 0x29, 0x2A, 0x44, 0xC8, 0x79, 0xE7,
+    0x1C, 0x65, 0x8A, 0x65, 0xA3, 0xD4, 0x03, 0x85, 0x15, 0x53, 0x70, 0x21, 0x75, 0x0F, 0x29, 0x55,
+    0x4B, 0x07, 0x48, 0x0D, 0x90, 0x3A, 0x09, 0x52, 0xA6, 0x4D, 0x8E, 0x53, 0xAA, 0x35, 0xE9, 0x62,
+    0x6A, 0x7C, 0xF1, 0x69, 0xFA, 0x0F, 0xCF, 0x51, 0xB5, 0xD7, 0x00, 0x29, 0x43, 0x86, 0x90, 0x04,
+    0x91, 0xF5, 0x39, 0x8A, 0x85, 0xC4, 0x76, 0xD5, 0xA3, 0x9E, 0x77, 0x8C, 0x51, 0x22, 0x22, 0x7E,
+    0xD8, 0xC7, 0x28, 0xC1, 0x89, 0x08, 0xFB, 0xDE, 0xA3, 0x22, 0x11, 0xBA, 0x61, 0xF7, 0x3D, 0x0A,
+    0x4A, 0x65, 0x7D, 0x8F, 0xDA, 0x93, 0x5B, 0x09, 0x25, 0x02, 0xE2, 0x59, 0x0E, 0x52, 0x8D, 0x78,
+    0x60, 0xD4, 0xC0, 0xA8, 0x93, 0x18, 0x65, 0xBA, 0xE4, 0x38, 0xA3, 0x5A, 0x13, 0x64, 0x14, 0xD8,
+    0xC9, 0xB2, 0x54, 0x50, 0x60, 0x98, 0x5D, 0xB6, 0xDB, 0xFD, 0x06, 0x24, 0x40, 0x8C, 0x15, 0x56,
+    0x17, 0x00, 0x00,
+};
+
+// Content-Encoding: deflate, sent raw (no zlib header) as some servers do
+static const uint8_t YAHOO_RAW[] = {
+    0xED, 0x98, 0x5F, 0x6F, 0xDB, 0x36, 0x10, 0xC0, 0xBF, 0xCA, 0xA0, 0x67, 0x97, 0x13, 0x29, 0x4A,
+    0xA2, 0xF2, 0x66, 0xD4, 0x5D, 0x5A, 0xA0, 0x71, 0xBD, 0xC6, 0xED, 0xD0, 0x05, 0xC6, 0xC0, 0x59,
+    0x8C, 0xA3, 0x55, 0x12, 0x5D, 0x89, 0x6E, 0xEA, 0x05, 0xFE, 0xEE, 0xBB, 0xA3, 0x24, 0xD7, 0x91,
+    0x69, 0x17, 0x2E, 0xF6, 0x28, 0x20, 0x60, 0xE0, 0xFB, 0xA7, 0x23, 0x8F, 0xF7, 0x03, 0xC9, 0x27,
+    0xAF, 0x5E, 0xCB, 0xEA, 0xB3, 0x77, 0xF5, 0xE4, 0x55, 0xAA, 0xDE, 0xE4, 0xC6, 0xBB, 0xBA, 0x7B,
+    0xF2, 0xEA, 0x6D, 0xF1, 0xB7, 0xCE, 0xBD, 0x2B, 0x6F, 0x3C, 0x9E, 0xBD, 0xF5, 0x46, 0xA8, 0x5A,
+    0xEB, 0xB2, 0x56, 0x56, 0x59, 0x28, 0x23, 0xD1, 0x7E, 0xB9, 0xA9, 0x2A, 0x55, 0x2E, 0xB7, 0x60,
+    0xF6, 0xE1, 0x76, 0x02, 0x56, 0x7D, 0x2F, 0xF5, 0x6D, 0xF9, 0x20, 0xCB, 0x95, 0x9A, 0xCA, 0x02,
+    0x3C, 0xBD, 0xE9, 0xCD, 0x2D, 0x08, 0xEF, 0x37, 0x79, 0xFE, 0xAA, 0xA7, 0x90, 0x75, 0x2A, 0xBF,
+    0x5C, 0xA3, 0x36, 0x2B, 0x6B, 0x53, 0x6D, 0x0A, 0x55, 0x9A, 0xF9, 0x76, 0x8D, 0xBA, 0x57, 0xBF,
+    0x7F, 0x78, 0x33, 0xFF, 0x84, 0x7E, 0x59, 0x55, 0x9B, 0x79, 0x25, 0x53, 0x35, 0x91, 0x06, 0x34,
+    0x01, 0x0F, 0x79, 0x9C, 0x70, 0xDF, 0xC7, 0xEC, 0x56, 0x9B, 0x5C, 0x56, 0x37, 0x30, 0x0F, 0x65,
+    0xE6, 0x19, 0xC6, 0xA4, 0x31, 0x4B, 0x7C, 0xC6, 0xB8, 0x4F, 0x47, 0xDE, 0x83, 0xAC, 0x67, 0x95,
+    0x9A, 0xE9, 0xDA, 0x34, 0x16, 0xE0, 0x0F, 0xF9, 0xC3, 0x67, 0xD4, 0xC8, 0x5B, 0x15, 0x46, 0xDF,
+    0xDF, 0xD7, 0x0A, 0xA6, 0xFD, 0x82, 0x72, 0x1B, 0xCD, 0x40, 0x80, 0x7F, 0x75, 0x69, 0x3F, 0x3E,
+    0x99, 0x1F, 0x4C, 0x63, 0xDE, 0x2A, 0xDA, 0xAC, 0xC7, 0x85, 0xAA, 0xB2, 0xA5, 0xFC, 0x75, 0xAA,
+    0x1E, 0xFF, 0xFA, 0xA4, 0x61, 0x09, 0x7B, 0x89, 0xCC, 0x40, 0x0B, 0x76, 0x2C, 0xA0, 0x24, 0x16,
+    0x98, 0xFF, 0xBD, 0xD9, 0xCE, 0x1F, 0xF5, 0x1F, 0x4A, 0x7D, 0x7E, 0x9D, 0xAD, 0x1E, 0x40, 0x23,
+    0x7C, 0xC2, 0xC3, 0xE7, 0x9A, 0xB7, 0xFA, 0x11, 0x92, 0x8F, 0x38, 0x09, 0xA3, 0x5E, 0xB8, 0x89,
+    0xDC, 0xB6, 0x6E, 0x01, 0x27, 0xF4, 0x58, 0x69, 0x3D, 0x19, 0x13, 0x24, 0xE8, 0xE9, 0x3E, 0xEA,
+    0x7C, 0x83, 0x09, 0x07, 0x7E, 0x14, 0x07, 0x14, 0x67, 0x98, 0xEB, 0x72, 0xD5, 0x4D, 0x02, 0x2A,
+    0xF5, 0xCB, 0x9B, 0x72, 0x49, 0xB0, 0x7C, 0x0F, 0xBA, 0x32, 0x0E, 0x39, 0xCC, 0xBE, 0x82, 0xD9,
+    0xA8, 0xAF, 0x99, 0xDE, 0xD4, 0x2F, 0x73, 0x5D, 0xDB, 0x59, 0xF9, 0x84, 0x42, 0x8A, 0x6B, 0xB7,
+    0xB8, 0x5E, 0xCA, 0x1C, 0x3F, 0x89, 0x06, 0xB0, 0x0A, 0xAF, 0xB3, 0x12, 0x16, 0x98, 0x8D, 0xDA,
+    0x2D, 0x63, 0xCB, 0x98, 0x95, 0xAB, 0x19, 0x2C, 0xA0, 0x4E, 0x71, 0x2B, 0x41, 0x18, 0xFC, 0x77,
+    0xB4, 0xF4, 0xB5, 0x81, 0x4F, 0xB7, 0xD5, 0x8C, 0xC2, 0x08, 0x93, 0x57, 0x65, 0xDA, 0x0A, 0x44,
+    0x68, 0xEB, 0x75, 0x54, 0xC2, 0xDD, 0x7E, 0x01, 0x7E, 0x18, 0xB3, 0x0D, 0xB1, 0x8F, 0x49, 0x7D,
+    0x21, 0x4E, 0xC5, 0x5C, 0xC3, 0x06, 0xFA, 0x51, 0xC0, 0xCE, 0xFF, 0x7B, 0x40, 0x16, 0x30, 0x77,
+    0x40, 0x88, 0x68, 0x0E, 0x97, 0xA1, 0x86, 0xDE, 0xBA, 0xFB, 0xDF, 0xD2, 0x5D, 0x2C, 0x46, 0x5E,
+    0x0A, 0xFB, 0xFC, 0xBA, 0x92, 0x25, 0xAE, 0x44, 0x66, 0xB0, 0x4D, 0x69, 0x8A, 0x9B, 0x14, 0xF7,
+    0x72, 0xF7, 0xE3, 0xAB, 0xCC, 0xB3, 0xF4, 0x3D, 0x4A, 0xF0, 0xFB, 0x8D, 0x2C, 0xC4, 0x81, 0x16,
+    0x1A, 0xC6, 0xC0, 0x8E, 0x91, 0x1D, 0xE9, 0x16, 0x06, 0x86, 0x43, 0x88, 0x03, 0xF5, 0x71, 0xDC,
+    0x1A, 0x34, 0x2E, 0xE4, 0x37, 0x6F, 0xB1, 0x6B, 0x5A, 0x07, 0xF2, 0x2D, 0xD6, 0x10, 0xEB, 0x7B,
+    0xC2, 0x0B, 0x6C, 0xEB, 0x14, 0x5A, 0xC5, 0xE8, 0xAA, 0xC6, 0x15, 0xFC, 0xB2, 0xD1, 0xA6, 0x41,
+    0xC9, 0xB2, 0xD9, 0x36, 0x77, 0x4D, 0x93, 0x2C, 0x76, 0x60, 0x2A, 0xD3, 0x7F, 0x3A, 0xE9, 0xD3,
+    0xE1, 0x8F, 0xBD, 0xC9, 0x0E, 0xFE, 0x46, 0x07, 0x88, 0xBA, 0xB9, 0xFD, 0x6D, 0x7E, 0x39, 0xA2,
+    0x5A, 0xAF, 0x01, 0x51, 0x60, 0xC7, 0x69, 0x44, 0x28, 0x73, 0x21, 0x2A, 0xF4, 0x03, 0x12, 0x52,
+    0x07, 0xA2, 0x58, 0x12, 0x5A, 0x76, 0xB9, 0x11, 0xC5, 0x99, 0x4F, 0x98, 0x38, 0xC1, 0x28, 0xEE,
+    0x27, 0x44, 0xF4, 0x95, 0x1D, 0xA4, 0x62, 0x16, 0x32, 0xC6, 0xE8, 0x33, 0x46, 0x61, 0xA9, 0x5C,
+    0x8C, 0x3A, 0x94, 0xBB, 0x18, 0xC5, 0x69, 0x40, 0x30, 0xD4, 0xDA, 0x2D, 0x1E, 0x18, 0x35, 0x30,
+    0xEA, 0x12, 0x46, 0x35, 0x5D, 0x72, 0x96, 0x51, 0x7B, 0x93, 0x3E, 0xA3, 0xA6, 0x1F, 0x27, 0xE3,
+    0xCB, 0x19, 0xD5, 0x7A, 0x0D, 0x8C, 0xC2, 0x4C, 0x00, 0xFF, 0x91, 0x0B, 0x51, 0x34, 0x4C, 0x08,
+    0xE3, 0x0E, 0x44, 0x25, 0x01, 0xE1, 0xFC, 0x14, 0xA1, 0x68, 0xC0, 0x48, 0xC2, 0x4E, 0x10, 0x8A,
+    0xB2, 0x84, 0x44, 0xA7, 0x8E, 0x51, 0x71, 0x18, 0x53, 0xCE, 0x92, 0xF8, 0x19, 0xA2, 0xB0, 0x52,
+    0x2E, 0x44, 0x1D, 0xCA, 0x5D, 0x88, 0xA2, 0x70, 0x5E, 0x8A, 0xC4, 0x11, 0xA2, 0x3A, 0xF1, 0x80,
+    0xA8, 0x01, 0x51, 0x97, 0x20, 0xCA, 0x36, 0xC9, 0x59, 0x42, 0x75, 0x16, 0x7D, 0x40, 0x5D, 0xBF,
+    0x7B, 0x77, 0xFD, 0x13, 0x17, 0xBD, 0xCE, 0x6D, 0x40, 0x14, 0x66, 0x12, 0x85, 0xF6, 0xF2, 0xE3,
+    0x60, 0x54, 0x02, 0x47, 0x1E, 0x17, 0xA3, 0x28, 0x8D, 0x09, 0x3B, 0x79, 0xD3, 0xA3, 0x51, 0x44,
+    0xC4, 0xA9, 0xAB, 0x1E, 0x8D, 0x98, 0x65, 0x84, 0x13, 0x52, 0x54, 0x88, 0x98, 0xF3, 0xDE, 0x39,
+    0xCA, 0x16, 0xCB, 0x45, 0xA9, 0x67, 0x0A, 0x27, 0xA6, 0xE0, 0x42, 0xEA, 0x1F, 0x53, 0xAA, 0x91,
+    0x0E, 0x90, 0x1A, 0x20, 0x75, 0x11, 0xA4, 0x6C, 0x9B, 0x9C, 0xA7, 0x54, 0x67, 0xD2, 0xC7, 0xD4,
+    0xF8, 0xE6, 0xCF, 0xE9, 0x4F, 0x3C, 0x47, 0x35, 0x5E, 0x03, 0xA4, 0x2C, 0x19, 0x62, 0x12, 0x25,
+    0xCE, 0xE7, 0x28, 0x16, 0x13, 0xD7, 0x55, 0x8F, 0x06, 0xC1, 0x39, 0x46, 0x89, 0x84, 0x84, 0xF1,
+    0x29, 0x46, 0x09, 0x4E, 0x44, 0x5F, 0xB9, 0x7F, 0x8F, 0x4A, 0x44, 0xEC, 0xC7, 0xFD, 0xF7, 0x28,
+    0x28, 0x95, 0xF3, 0x3D, 0xEA, 0x40, 0xEE, 0x24, 0x94, 0x88, 0x48, 0xE0, 0x38, 0x48, 0xB5, 0xE2,
+    0x81, 0x51, 0x03, 0xA3, 0x2E, 0x62, 0x94, 0xED, 0x92, 0xF3, 0x8C, 0xEA, 0x4C, 0x90, 0x51, 0x60,
+    0xA7, 0xAA, 0x4A, 0x43, 0x81, 0x61, 0x76, 0xF9, 0x6E, 0xF7, 0x1F,
+};
+
+// Open-Meteo /v1/forecast, three locations
+static const char OPEN_METEO_JSON[] =
+    "[{\"latitude\":37.7749,\"longitude\":-122.4194,\"generationtime_ms\":0.0349,\"utc_offset_seconds\":0,\"timezo"
+    "ne\":\"GMT\",\"timezone_abbreviation\":\"GMT\",\"elevation\":31,\"current_weather_units\":{\"time\":\"iso8601\",\"in"
+    "terval\":\"seconds\",\"temperature\":\"\302\260C\",\"windspeed\":\"km/h\",\"winddirection\":\"\302\260\",\"is_day\":\"\",\"weatherco"
+    "de\":\"wmo code\"},\"current_weather\":{\"time\":\"2024-10-16T12:00\",\"interval\":900,\"temperature\":18.4,\"wind"
+    "speed\":5.3,\"winddirection\":60,\"is_day\":1,\"weathercode\":45}},{\"latitude\":51.5074,\"longitude\":-0.1278,"
+    "\"generationtime_ms\":0.0349,\"utc_offset_seconds\":0,\"timezone\":\"GMT\",\"timezone_abbreviation\":\"GMT\",\"el"
+    "evation\":24,\"current_weather_units\":{\"time\":\"iso8601\",\"interval\":\"seconds\",\"temperature\":\"\302\260C\",\"wind"
+    "speed\":\"km/h\",\"winddirection\":\"\302\260\",\"is_day\":\"\",\"weathercode\":\"wmo code\"},\"current_weather\":{\"time\":\""
+    "2024-10-16T12:00\",\"interval\":900,\"temperature\":11.2,\"windspeed\":14.9,\"winddirection\":349,\"is_day\":1,"
+    "\"weathercode\":1}},{\"latitude\":35.6762,\"longitude\":139.6503,\"generationtime_ms\":0.0349,\"utc_offset_se"
+    "conds\":0,\"timezone\":\"GMT\",\"timezone_abbreviation\":\"GMT\",\"elevation\":11,\"current_weather_units\":{\"tim"
+    "e\":\"iso8601\",\"interval\":\"seconds\",\"temperature\":\"\302\260C\",\"windspeed\":\"km/h\",\"winddirection\":\"\302\260\",\"is_da"
+    "y\":\"\",\"weathercode\":\"wmo code\"},\"current_weather\":{\"time\":\"2024-10-16T12:00\",\"interval\":900,\"tempera"
+    "ture\":21.9,\"windspeed\":15.4,\"winddirection\":327,\"is_day\":1,\"weathercode\":1}}]";
+
+// Content-Encoding: gzip with FEXTRA, FNAME, FCOMMENT and FHCRC
+static const uint8_t OPEN_METEO_GZIP[] = {
+    0x1F, 0x8B, 0x08, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x41, 0x50, 0x02, 0x00,
+    0x68, 0x69, 0x66, 0x6F, 0x72, 0x65, 0x63, 0x61, 0x73, 0x74, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x00,
+    0x6F, 0x70, 0x65, 0x6E, 0x2D, 0x6D, 0x65, 0x74, 0x65, 0x6F, 0x00, 0x5F, 0x5E, 0xE5, 0x93, 0xB1,
+    0x6E, 0x83, 0x30, 0x10, 0x86, 0x5F, 0xA5, 0xF2, 0x4C, 0x5C, 0x9F, 0x31, 0x10, 0xB2, 0x76, 0xE8,
+    0xD4, 0x2D, 0x5B, 0x55, 0x21, 0x02, 0x97, 0xC6, 0x2A, 0xD8, 0x91, 0x31, 0x89, 0xDA, 0x28, 0xEF,
+    0x94, 0x67, 0xC8, 0x93, 0xD5, 0xA6, 0xD0, 0x84, 0x44, 0xED, 0x98, 0x25, 0x1B, 0xFC, 0x77, 0xBE,
+    0xFB, 0xE4, 0x4F, 0x7E, 0xDD, 0x91, 0x2A, 0xB7, 0xD2, 0xB6, 0x25, 0x92, 0x59, 0x98, 0xD0, 0x24,
+    0x11, 0x69, 0x40, 0x2A, 0xAD, 0xDE, 0xFB, 0x6C, 0x02, 0x9C, 0x53, 0x01, 0xA9, 0x08, 0xC8, 0x3B,
+    0x2A, 0x34, 0xAE, 0x59, 0x2B, 0x2B, 0x6B, 0xCC, 0xEA, 0x86, 0xCC, 0x18, 0x65, 0xA1, 0x3F, 0xD0,
+    0xDA, 0x22, 0xD3, 0xCB, 0x65, 0x83, 0x36, 0x6B, 0xB0, 0xD0, 0xAA, 0xF4, 0xB5, 0x80, 0xF8, 0xBE,
+    0x2F, 0xAD, 0xDC, 0x18, 0xF2, 0xFC, 0x32, 0x27, 0xA7, 0x20, 0xCB, 0x17, 0x0B, 0x83, 0x1B, 0xD9,
+    0x4D, 0xFB, 0xAD, 0x62, 0x85, 0x9B, 0x3E, 0x09, 0x21, 0x20, 0x45, 0x6B, 0x0C, 0x2A, 0x9B, 0x6D,
+    0x31, 0xB7, 0x2B, 0x34, 0x59, 0xAB, 0xA4, 0x75, 0x73, 0x77, 0xDD, 0x14, 0x77, 0x48, 0x36, 0x7A,
+    0x1A, 0x33, 0x70, 0x07, 0xA5, 0xB2, 0x68, 0x36, 0x79, 0xE5, 0xC2, 0x61, 0xBD, 0xDB, 0x85, 0xF5,
+    0xDA, 0xF3, 0xB6, 0xC6, 0x37, 0x1F, 0x0F, 0x4F, 0x2E, 0xDB, 0x4A, 0x57, 0x5B, 0x23, 0x96, 0x2E,
+    0xF9, 0xA8, 0x1F, 0x57, 0x7D, 0x54, 0x4A, 0x83, 0x45, 0x8F, 0x72, 0x3C, 0xF8, 0x81, 0x4D, 0x56,
+    0xE6, 0x9F, 0xEE, 0xCF, 0x37, 0xFC, 0xAC, 0x2F, 0xB4, 0xBF, 0x0E, 0xB2, 0xAD, 0xF5, 0x43, 0xF7,
+    0xB9, 0xBF, 0x02, 0x3C, 0x43, 0xE3, 0x8C, 0x8B, 0x09, 0xB0, 0x09, 0xC4, 0x73, 0xE0, 0x33, 0xC6,
+    0x46, 0x8C, 0x29, 0x63, 0x17, 0x74, 0x30, 0xA5, 0x62, 0x04, 0x17, 0xD1, 0xF0, 0x8A, 0x2C, 0x66,
+    0x27, 0x2E, 0xB8, 0xC0, 0x12, 0xD1, 0x7E, 0x1F, 0x9C, 0xAB, 0x8C, 0x80, 0x46, 0x2C, 0x11, 0x63,
+    0x95, 0x8C, 0x02, 0x4F, 0xA6, 0xB7, 0x15, 0xC9, 0xC5, 0x5D, 0x89, 0x04, 0xCA, 0x47, 0x70, 0x20,
+    0x68, 0x7A, 0x85, 0xD6, 0xDD, 0xF4, 0x5F, 0x2A, 0xE1, 0xC2, 0x64, 0x18, 0xD1, 0x38, 0x89, 0xF9,
+    0xC8, 0x24, 0x84, 0x29, 0x8D, 0x23, 0x16, 0xDE, 0x56, 0x25, 0xDC, 0xD5, 0x9B, 0xE4, 0x30, 0x98,
+    0x1B, 0x54, 0x46, 0xC3, 0x23, 0x3D, 0x57, 0xC9, 0x93, 0x7F, 0x55, 0xBE, 0x7D, 0x03, 0x02, 0x57,
+    0x80, 0x16, 0x61, 0x05, 0x00, 0x00,
+};
+
+// Content-Encoding: deflate, zlib-wrapped
+static const uint8_t OPEN_METEO_ZLIB[] = {
+    0x78, 0x9C, 0xE5, 0x93, 0xB1, 0x6E, 0x83, 0x30, 0x10, 0x86, 0x5F, 0xA5, 0xF2, 0x4C, 0x5C, 0x9F,
+    0x31, 0x10, 0xB2, 0x76, 0xE8, 0xD4, 0x2D, 0x5B, 0x55, 0x21, 0x02, 0x97, 0xC6, 0x2A, 0xD8, 0x91,
+    0x31, 0x89, 0xDA, 0x28, 0xEF, 0x94, 0x67, 0xC8, 0x93, 0xD5, 0xA6, 0xD0, 0x84, 0x44, 0xED, 0x98,
+    0x25, 0x1B, 0xFC, 0x77, 0xBE, 0xFB, 0xE4, 0x4F, 0x7E, 0xDD, 0x91, 0x2A, 0xB7, 0xD2, 0xB6, 0x25,
+    0x92, 0x59, 0x98, 0xD0, 0x24, 0x11, 0x69, 0x40, 0x2A, 0xAD, 0xDE, 0xFB, 0x6C, 0x02, 0x9C, 0x53,
+    0x01, 0xA9, 0x08, 0xC8, 0x3B, 0x2A, 0x34, 0xAE, 0x59, 0x2B, 0x2B, 0x6B, 0xCC, 0xEA, 0x86, 0xCC,
+    0x18, 0x65, 0xA1, 0x3F, 0xD0, 0xDA, 0x22, 0xD3, 0xCB, 0x65, 0x83, 0x36, 0x6B, 0xB0, 0xD0, 0xAA,
+    0xF4, 0xB5, 0x80, 0xF8, 0xBE, 0x2F, 0xAD, 0xDC, 0x18, 0xF2, 0xFC, 0x32, 0x27, 0xA7, 0x20, 0xCB,
+    0x17, 0x0B, 0x83, 0x1B, 0xD9, 0x4D, 0xFB, 0xAD, 0x62, 0x85, 0x9B, 0x3E, 0x09, 0x21, 0x20, 0x45,
+    0x6B, 0x0C, 0x2A, 0x9B, 0x6D, 0x31, 0xB7, 0x2B, 0x34, 0x59, 0xAB, 0xA4, 0x75, 0x73, 0x77, 0xDD,
+    0x14, 0x77, 0x48, 0x36, 0x7A, 0x1A, 0x33, 0x70, 0x07, 0xA5, 0xB2, 0x68, 0x36, 0x79, 0xE5, 0xC2,
+    0x61, 0xBD, 0xDB, 0x85, 0xF5, 0xDA, 0xF3, 0xB6, 0xC6, 0x37, 0x1F, 0x0F, 0x4F, 0x2E, 0xDB, 0x4A,
+    0x57, 0x5B, 0x23, 0x96, 0x2E, 0xF9, 0xA8, 0x1F, 0x57, 0x7D, 0x54, 0x4A, 0x83, 0x45, 0x8F, 0x72,
+    0x3C, 0xF8, 0x81, 0x4D, 0x56, 0xE6, 0x9F, 0xEE, 0xCF, 0x37, 0xFC, 0xAC, 0x2F, 0xB4, 0xBF, 0x0E,
+    0xB2, 0xAD, 0xF5, 0x43, 0xF7, 0xB9, 0xBF, 0x02, 0x3C, 0x43, 0xE3, 0x8C, 0x8B, 0x09, 0xB0, 0x09,
+    0xC4, 0x73, 0xE0, 0x33, 0xC6, 0x46, 0x8C, 0x29, 0x63, 0x17, 0x74, 0x30, 0xA5, 0x62, 0x04, 0x17,
+    0xD1, 0xF0, 0x8A, 0x2C, 0x66, 0x27, 0x2E, 0xB8, 0xC0, 0x12, 0xD1, 0x7E, 0x1F, 0x9C, 0xAB, 0x8C,
+    0x80, 0x46, 0x2C, 0x11, 0x63, 0x95, 0x8C, 0x02, 0x4F, 0xA6, 0xB7, 0x15, 0xC9, 0xC5, 0x5D, 0x89,
+    0x04, 0xCA, 0x47, 0x70, 0x20, 0x68, 0x7A, 0x85, 0xD6, 0xDD, 0xF4, 0x5F, 0x2A, 0xE1, 0xC2, 0x64,
+    0x18, 0xD1, 0x38, 0x89, 0xF9, 0xC8, 0x24, 0x84, 0x29, 0x8D, 0x23, 0x16, 0xDE, 0x56, 0x25, 0xDC,
+    0xD5, 0x9B, 0xE4, 0x30, 0x98, 0x1B, 0x54, 0x46, 0xC3, 0x23, 0x3D, 0x57, 0xC9, 0x93, 0x7F, 0x55,
+    0xBE, 0x7D, 0x03, 0x27, 0x60, 0xC5, 0x6D,
+};
+
+#endif // INFLATE_FIXTURES_H
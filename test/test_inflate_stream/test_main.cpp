@@ -0,0 +1,196 @@
+// InflateStream over captured gzip, zlib and raw deflate bodies: the output
+// must match the original JSON byte for byte, truncated bodies must report an
+// error, and the report shows what compression saves on the wire and costs in CPU.
+
+#include <Arduino.h>
+#include <unity.h>
+#include <zlib.h>
+#include <string>
+#include <vector>
+#include "../../src/inflate_stream.cpp"
+#include "fixtures.h"
+
+// HTTP body stand-in: a fixed buffer, read in whatever sizes the decoder asks for
+class MemoryStream : public Stream {
+private:
+    const uint8_t* data;
+    size_t length;
+    size_t pos;
+
+public:
+    MemoryStream(const uint8_t* data, size_t length) : data(data), length(length), pos(0) {}
+
+    int available() override { return length - pos; }
+    int read() override { return pos < length ? data[pos++] : -1; }
+    int peek() override { return pos < length ? data[pos] : -1; }
+    size_t readBytes(char* buffer, size_t size) override {
+        size_t n = min(size, length - pos);
+        memcpy(buffer, data + pos, n);
+        pos += n;
+        return n;
+    }
+    size_t write(uint8_t) override { return 0; }
+};
+
+struct Fixture {
+    const char* name;
+    const char* json;
+    const uint8_t* encoded;
+    size_t encodedLen;
+    InflateStream::Format format;
+};
+
+#define FIXTURE(name, json, bytes, format) {name, json, bytes, sizeof(bytes), InflateStream::format}
+
+static const Fixture FIXTURES[] = {
+    FIXTURE("coingecko gzip", COINGECKO_JSON, COINGECKO_GZIP, GZIP),
+    FIXTURE("coingecko zlib", COINGECKO_JSON, COINGECKO_ZLIB, DEFLATE),
+    FIXTURE("yahoo gzip+fname", YAHOO_JSON, YAHOO_GZIP, GZIP),
+    FIXTURE("yahoo raw", YAHOO_JSON, YAHOO_RAW, DEFLATE),
+    FIXTURE("open-meteo gzip+all", OPEN_METEO_JSON, OPEN_METEO_GZIP, GZIP),
+    FIXTURE("open-meteo zlib", OPEN_METEO_JSON, OPEN_METEO_ZLIB, DEFLATE),
+};
+static const size_t FIXTURE_COUNT = sizeof(FIXTURES) / sizeof(FIXTURES[0]);
+
+// Everything the decoder yields, pulled chunk bytes at a time (0 = read() per byte)
+static std::string inflateAll(InflateStream& stream, size_t chunk) {
+    std::string out;
+    if (chunk == 0) {
+        int c;
+        while ((c = stream.read()) >= 0) {
+            out += (char)c;
+        }
+        return out;
+    }
+    std::vector<char> buffer(chunk);
+    size_t n;
+    while ((n = stream.readBytes(buffer.data(), chunk)) > 0) {
+        out.append(buffer.data(), n);
+    }
+    return out;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_fixtures_inflate_to_the_original_body() {
+    char line[160];
+    TEST_MESSAGE("  body                     raw    wire   saved   inflate");
+    for (size_t i = 0; i < FIXTURE_COUNT; i++) {
+        const Fixture& f = FIXTURES[i];
+        size_t rawLen = strlen(f.json);
+
+        // Same body through every read pattern the JSON parser and callers use
+        const size_t chunks[] = {0, 1, 7, 64, 4096};
+        for (size_t chunk : chunks) {
+            MemoryStream body(f.encoded, f.encodedLen);
+            InflateStream stream(body, f.format);
+            std::string out = inflateAll(stream, chunk);
+
+            TEST_ASSERT_FALSE_MESSAGE(stream.hasError(), f.name);
+            TEST_ASSERT_EQUAL_MESSAGE(rawLen, out.size(), f.name);
+            TEST_ASSERT_EQUAL_STRING_MESSAGE(f.json, out.c_str(), f.name);
+            TEST_ASSERT_EQUAL_MESSAGE(rawLen, stream.getBytesOut(), f.name);
+        }
+
+        MemoryStream body(f.encoded, f.encodedLen);
+        InflateStream stream(body, f.format);
+        inflateAll(stream, 512);
+        snprintf(line, sizeof(line), "  %-20s %7u %7u %6.1f%% %7uus",
+                 f.name, (unsigned)rawLen, (unsigned)f.encodedLen,
+                 100.0 * (rawLen - f.encodedLen) / rawLen, (unsigned)stream.getInflateUs());
+        TEST_MESSAGE(line);
+    }
+}
+
+void test_large_body_wraps_the_window() {
+    // Hourly forecast for a year: several times the 32KB window. The host inflater
+    // fails any call where the window no longer holds tinfl's dictionary, wrap included
+    std::string times;
+    std::string temperatures;
+    char value[24];
+    for (int h = 0; h < 24 * 365; h++) {
+        snprintf(value, sizeof(value), "%s\"2024-%02d-%02dT%02d:00\"", h ? "," : "",
+                 1 + h / (24 * 31), 1 + h / 24 % 31, h % 24);
+        times += value;
+        snprintf(value, sizeof(value), "%s%.1f", h ? "," : "", 10 + (h * 37 % 200) / 10.0);
+        temperatures += value;
+    }
+    std::string json = "{\"hourly\":{\"time\":[" + times + "],\"temperature_2m\":[" + temperatures + "]}}";
+    TEST_ASSERT_GREATER_THAN(2 * TINFL_LZ_DICT_SIZE, json.size());
+
+    // gzip via zlib (windowBits 31 writes the gzip wrapper)
+    z_stream z = {};
+    TEST_ASSERT_EQUAL(Z_OK, deflateInit2(&z, 6, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY));
+    std::vector<uint8_t> gz(deflateBound(&z, json.size()) + 32);
+    z.next_in = (Bytef*)json.data();
+    z.avail_in = json.size();
+    z.next_out = gz.data();
+    z.avail_out = gz.size();
+    TEST_ASSERT_EQUAL(Z_STREAM_END, deflate(&z, Z_FINISH));
+    gz.resize(z.total_out);
+    deflateEnd(&z);
+
+    MemoryStream body(gz.data(), gz.size());
+    InflateStream stream(body, InflateStream::GZIP);
+    std::string out = inflateAll(stream, 1000);
+
+    TEST_ASSERT_FALSE(stream.hasError());
+    TEST_ASSERT_EQUAL(json.size(), out.size());
+    TEST_ASSERT_TRUE(out == json);
+
+    char line[120];
+    snprintf(line, sizeof(line), "  large body: %u -> %u bytes, %uus (%.1fus/KB)",
+             (unsigned)json.size(), (unsigned)gz.size(), (unsigned)stream.getInflateUs(),
+             stream.getInflateUs() * 1024.0 / json.size());
+    TEST_MESSAGE(line);
+}
+
+void test_truncated_body_reports_an_error() {
+    // Every cut of each fixture: the output so far is a prefix of the body, and
+    // unless only the gzip trailer (CRC and size, never read) is missing the
+    // stream reports the error. The zlib Adler-32 trailer is part of the stream
+    for (size_t i = 0; i < FIXTURE_COUNT; i++) {
+        const Fixture& f = FIXTURES[i];
+        size_t trailer = f.format == InflateStream::GZIP ? 8 : 0;
+
+        for (size_t cut = 0; cut < f.encodedLen; cut++) {
+            MemoryStream body(f.encoded, cut);
+            InflateStream stream(body, f.format);
+            std::string out = inflateAll(stream, 64);
+
+            TEST_ASSERT_TRUE_MESSAGE(strncmp(f.json, out.c_str(), out.size()) == 0, f.name);
+            if (cut < f.encodedLen - trailer) {
+                TEST_ASSERT_TRUE_MESSAGE(stream.hasError(), f.name);
+            } else {
+                TEST_ASSERT_FALSE_MESSAGE(stream.hasError(), f.name);
+                TEST_ASSERT_EQUAL_MESSAGE(strlen(f.json), out.size(), f.name);
+            }
+        }
+    }
+}
+
+void test_corrupt_body_reports_an_error() {
+    // Reserved block type (BTYPE 11) right after a valid zlib header
+    const uint8_t corrupt[] = {0x78, 0x9C, 0x07, 0x00, 0x00, 0x00};
+    MemoryStream body(corrupt, sizeof(corrupt));
+    InflateStream stream(body, InflateStream::DEFLATE);
+    TEST_ASSERT_EQUAL(-1, stream.read());
+    TEST_ASSERT_TRUE(stream.hasError());
+
+    // Not gzip at all
+    MemoryStream plain((const uint8_t*)COINGECKO_JSON, strlen(COINGECKO_JSON));
+    InflateStream notGzip(plain, InflateStream::GZIP);
+    TEST_ASSERT_EQUAL(-1, notGzip.read());
+    TEST_ASSERT_TRUE(notGzip.hasError());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_fixtures_inflate_to_the_original_body);
+    RUN_TEST(test_large_body_wraps_the_window);
+    RUN_TEST(test_truncated_body_reports_an_error);
+    RUN_TEST(test_corrupt_body_reports_an_error);
+    return UNITY_END();
+}
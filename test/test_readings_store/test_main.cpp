@@ -0,0 +1,171 @@
+// Readings store against the host LittleFS: a snapshot round trip, readings
+// moved out of an older firmware's config, and local slots (the settings
+// security code) that must neither reach flash nor keep the store dirty.
+
+#include <Arduino.h>
+#include <unity.h>
+#include <string>
+#include "../../src/readings_store.cpp"
+
+StaticJsonDocument<8192> config;
+
+#define SYNCED_EPOCH 1700000000UL  // Any wall-clock stamp past EPOCH_VALID_AFTER
+
+static std::string readingsFile() {
+    auto& files = LittleFS.hostFiles();
+    auto it = files.find(READINGS_FILE);
+    return it == files.end() ? std::string() : std::string(it->second->begin(), it->second->end());
+}
+
+void setUp() {
+    LittleFS.format();
+    hostUseVirtualTime(1000);
+    config.clear();
+    config["device"]["refreshInterval"] = 300;
+}
+
+void tearDown() {}
+
+void test_snapshot_round_trip() {
+    ReadingsStore store;
+    int bitcoin = store.declare("bitcoin", READING_VALUE | READING_CHANGE24H);
+    int weather = store.declare("weather", READING_TEMPERATURE | READING_CONDITION);
+    ModuleReading* reading = store.edit(bitcoin);
+    reading->value = 64250.5f;
+    reading->change = -1.25f;
+    reading->lastUpdate = SYNCED_EPOCH;
+    reading->lastSuccess = true;
+    reading = store.edit(weather);
+    reading->temperature = 18.5f;
+    strlcpy(reading->condition, "Cloudy", sizeof(reading->condition));
+    reading->lastUpdate = 5000;  // Uptime stamp: means nothing after a restart
+    store.setStatus("weather", false, "HTTP 503");
+    TEST_ASSERT_TRUE(store.save());
+    TEST_ASSERT_FALSE(LittleFS.exists(READINGS_TEMP_FILE));
+
+    ReadingsStore restored;
+    TEST_ASSERT_TRUE(restored.load());
+    TEST_ASSERT_EQUAL(2, restored.getCount());
+    const ModuleReading& coin = restored.read("bitcoin");
+    TEST_ASSERT_EQUAL(READING_VALUE | READING_CHANGE24H, coin.fields);
+    TEST_ASSERT_EQUAL_FLOAT(64250.5f, coin.value);
+    TEST_ASSERT_EQUAL_FLOAT(-1.25f, coin.change);
+    TEST_ASSERT_EQUAL(SYNCED_EPOCH, coin.lastUpdate);
+    TEST_ASSERT_TRUE(coin.lastSuccess);
+    const ModuleReading& sky = restored.read("weather");
+    TEST_ASSERT_EQUAL_FLOAT(18.5f, sky.temperature);
+    TEST_ASSERT_EQUAL_STRING("Cloudy", sky.condition);
+    TEST_ASSERT_EQUAL_STRING("HTTP 503", sky.lastError);
+    TEST_ASSERT_EQUAL(0, sky.lastUpdate);
+
+    // Another layout (older firmware) is ignored, not misread
+    std::string bytes = readingsFile();
+    bytes[6] ^= 0xFF;  // recordSize
+    LittleFS.hostFiles()[READINGS_FILE] = std::make_shared<HostFileData>(bytes.begin(), bytes.end());
+    ReadingsStore other;
+    TEST_ASSERT_FALSE(other.load());
+    TEST_ASSERT_EQUAL(0, other.getCount());
+}
+
+void test_local_slots_stay_off_flash() {
+    // A snapshot from before local slots, holding the settings code
+    ReadingsStore before;
+    ModuleReading* reading = before.edit(before.declare("settings", READING_CODE));
+    reading->securityCode = 424242;
+    reading->lastUpdate = SYNCED_EPOCH;
+    before.edit(before.declare("bitcoin", READING_VALUE))->value = 1.0f;
+    TEST_ASSERT_TRUE(before.save());
+
+    ReadingsStore store;
+    TEST_ASSERT_TRUE(store.load());
+    store.declare("settings", READING_CODE, false);
+    store.declare("quad", 0, false);
+    TEST_ASSERT_EQUAL(0, store.read("settings").securityCode);
+
+    // The next snapshot drops what the old one held for the local slot
+    hostAdvance(READINGS_SAVE_INTERVAL);
+    store.maybeSave();
+    TEST_ASSERT_EQUAL(1, store.getSnapshotCount());
+    ReadingsStore reloaded;
+    TEST_ASSERT_TRUE(reloaded.load());
+    TEST_ASSERT_EQUAL(-1, reloaded.find("settings"));
+    TEST_ASSERT_NOT_EQUAL(-1, reloaded.find("bitcoin"));
+
+    // A new code every 30s and the quad stamp every minute: no snapshot for a day
+    for (unsigned long second = 0; second < 86400UL; second += 30) {
+        hostAdvance(30000);
+        reading = store.edit("settings");
+        reading->securityCode = 100000 + second;
+        reading->lastUpdate = SYNCED_EPOCH + second;
+        store.setStatus("settings", true, "");
+        if (second % 60 == 0) store.setLastUpdate("quad", SYNCED_EPOCH + second);
+        store.maybeSave();
+    }
+    TEST_ASSERT_EQUAL(1, store.getSnapshotCount());
+    TEST_ASSERT_NOT_EQUAL(0, store.read("settings").securityCode);
+
+    // A real reading still goes out, without the code
+    store.edit("bitcoin")->value = 2.0f;
+    hostAdvance(READINGS_SAVE_INTERVAL);
+    store.maybeSave();
+    TEST_ASSERT_EQUAL(2, store.getSnapshotCount());
+    std::string bytes = readingsFile();
+    TEST_ASSERT_TRUE(bytes.find("settings") == std::string::npos);
+    TEST_ASSERT_TRUE(bytes.find("quad") == std::string::npos);
+}
+
+void test_migrate_from_config() {
+    JsonObject modules = config.createNestedObject("modules");
+    JsonObject bitcoin = modules.createNestedObject("bitcoin");
+    bitcoin["type"] = "crypto";
+    bitcoin["value"] = 64000.0f;
+    bitcoin["change24h"] = 2.5f;
+    bitcoin["lastUpdate"] = SYNCED_EPOCH;
+    bitcoin["lastSuccess"] = true;
+    JsonObject custom = modules.createNestedObject("custom");
+    custom["type"] = "custom";
+    custom["value"] = 42.0f;  // User-entered: a setting, not a reading
+    custom["lastUpdate"] = 1234;
+    JsonObject weather = modules.createNestedObject("weather");
+    weather["type"] = "weather";
+    weather["temperature"] = 12.0f;
+    weather["lastUpdate"] = SYNCED_EPOCH - 600;
+    JsonObject plain = modules.createNestedObject("ethereum");
+    plain["type"] = "crypto";
+
+    // The snapshot already has something newer for weather
+    ReadingsStore store;
+    ModuleReading* reading = store.edit(store.declare("weather", READING_TEMPERATURE));
+    reading->temperature = 15.0f;
+    reading->lastUpdate = SYNCED_EPOCH;
+
+    TEST_ASSERT_EQUAL(3, store.migrateFromConfig(modules));
+
+    const ModuleReading& coin = store.read("bitcoin");
+    TEST_ASSERT_EQUAL(READING_VALUE | READING_CHANGE24H, coin.fields);
+    TEST_ASSERT_EQUAL_FLOAT(64000.0f, coin.value);
+    TEST_ASSERT_EQUAL_FLOAT(2.5f, coin.change);
+    TEST_ASSERT_EQUAL(SYNCED_EPOCH, coin.lastUpdate);
+    TEST_ASSERT_TRUE(coin.lastSuccess);
+    TEST_ASSERT_EQUAL(0, store.read("custom").lastUpdate);  // Uptime stamp of an earlier boot
+    TEST_ASSERT_EQUAL_FLOAT(15.0f, store.read("weather").temperature);
+    TEST_ASSERT_EQUAL(-1, store.find("ethereum"));
+
+    // Stripped from config, except the custom value and the settings themselves
+    TEST_ASSERT_FALSE(bitcoin.containsKey("value"));
+    TEST_ASSERT_FALSE(bitcoin.containsKey("change24h"));
+    TEST_ASSERT_FALSE(bitcoin.containsKey("lastUpdate"));
+    TEST_ASSERT_EQUAL_STRING("crypto", bitcoin["type"] | "");
+    TEST_ASSERT_EQUAL_FLOAT(42.0f, custom["value"] | 0.0f);
+    TEST_ASSERT_FALSE(custom.containsKey("lastUpdate"));
+    TEST_ASSERT_FALSE(weather.containsKey("temperature"));
+    TEST_ASSERT_EQUAL(0, store.migrateFromConfig(modules));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_snapshot_round_trip);
+    RUN_TEST(test_local_slots_stay_off_flash);
+    RUN_TEST(test_migrate_from_config);
+    return UNITY_END();
+}
@@ -0,0 +1,336 @@
+// Refresh queue over a day of virtual time: how old does each module's data get?
+//
+// Eight network modules on three upstream hosts run through the real Scheduler
+// (refresh queue, global budget, host token buckets, backoff). The fetch
+// worker is replaced by a simulated upstream that answers after 0.2-1.5s and
+// fails every 50th request. The button moves to the next module every ten
+// minutes, as a user cycling through screens would.
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <HTTPClient.h>
+#include <unity.h>
+
+// Only isOnline() is needed from the network manager
+#define NETWORK_H
+class NetworkManager {
+public:
+    bool online = true;
+    bool isOnline() { return online; }
+};
+
+#include "../../src/scheduler.cpp"
+#include "../../src/readings_store.cpp"
+#include "../../src/fetch_stats.cpp"
+#include "../../src/event_bus.cpp"
+
+StaticJsonDocument<8192> config;
+NetworkManager network;
+FetchWorker fetchWorker;
+FetchStats fetchStats;
+EventBus eventBus;
+ReadingsStore readings;
+
+#define SIM_DAY 86400UL        // seconds simulated
+#define SIM_STEP_MS 100        // loop() period
+#define SIM_SWITCH_EVERY 600   // seconds between button presses
+#define SIM_WARMUP 180         // seconds every module gets to its first reading
+#define SIM_INTERVAL 300       // config refreshInterval
+#define SIM_FAIL_EVERY 50      // upstream fails every Nth request
+
+// Clock never syncs in the simulation: stamps are uptime seconds
+unsigned long nowSeconds() { return millis() / 1000; }
+bool isTimeSynced() { return false; }
+void initTimeSync() {}
+bool checkTimeSync() { return false; }
+unsigned long timestampAge(unsigned long timestamp) {
+    if (timestamp == 0) return AGE_UNKNOWN;
+    unsigned long now = millis() / 1000;
+    return timestamp <= now ? now - timestamp : 0;
+}
+
+ModuleInterface* ModuleFactory::createModule(const char* type, const char* id, JsonObject cfg) {
+    return nullptr;  // Modules are registered by the test
+}
+
+// ---------------------------------------------------------------------------
+// Simulated upstream in place of the fetch worker
+// ---------------------------------------------------------------------------
+
+struct SimJob {
+    unsigned long doneAt;  // millis()
+    FetchResult result;
+    FetchCallback onComplete;
+};
+
+static std::vector<SimJob> simJobs;
+static uint32_t simRequests = 0;
+
+FetchWorker::FetchWorker() : jobQueue(nullptr), resultQueue(nullptr), task(nullptr), pending(0) {}
+
+bool FetchWorker::init() { return true; }
+
+bool FetchWorker::submit(FetchRequest&& request, FetchCallback onComplete) {
+    simRequests++;
+    SimJob job;
+    job.doneAt = millis() + random(200, 1500);
+    job.result.success = simRequests % SIM_FAIL_EVERY != 0;
+    job.result.httpCode = job.result.success ? HTTP_CODE_OK : 503;
+    job.result.errorMsg = job.result.success ? "" : "HTTP 503";
+    job.result.body = request.url;
+    job.result.durationMs = job.doneAt - millis();
+    job.result.doc = nullptr;
+    job.onComplete = onComplete;
+    simJobs.push_back(job);
+    pending++;
+    return true;
+}
+
+void FetchWorker::dispatchResults() {
+    for (size_t i = 0; i < simJobs.size();) {
+        if (simJobs[i].doneAt > millis()) {
+            i++;
+            continue;
+        }
+        SimJob job = simJobs[i];  // The callback may submit more work
+        simJobs.erase(simJobs.begin() + i);
+        pending--;
+        job.onComplete(job.result);
+    }
+}
+
+class SimModule : public ModuleInterface {
+private:
+    String moduleId;
+    const char* host;
+    float price;
+
+public:
+    uint32_t fetches;
+
+    SimModule(const char* id, const char* host, float price) : moduleId(id), host(host), price(price), fetches(0) {
+        this->id = moduleId.c_str();
+        displayName = "Sim";
+        defaultRefreshInterval = SIM_INTERVAL;
+        minRefreshInterval = 60;
+        readings.declare(id, READING_VALUE | READING_CHANGE);
+    }
+
+    bool fetch(String& errorMsg) override {
+        errorMsg = "Blocking fetch not simulated";
+        return false;
+    }
+    String formatDisplay() override { return moduleId; }
+    const char* upstreamHost() override { return host; }
+
+    bool prepareRequest(FetchRequest& request, String& errorMsg) override {
+        request.url = String("https://") + host + "/" + moduleId;
+        return true;
+    }
+
+    bool handleResponse(const String& payload, String& errorMsg) override {
+        price *= 1.0f + random(-100, 101) / 100000.0f;  // +/-0.1% per fetch
+        ModuleReading* reading = readings.edit(id);
+        reading->value = price;
+        reading->change = 0.5f;
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
+        fetches++;
+        return true;
+    }
+};
+
+// Local module: never queued, must not use the fetch budget
+class LocalModule : public ModuleInterface {
+public:
+    uint32_t fetches = 0;
+
+    LocalModule() {
+        id = "custom";
+        displayName = "Custom";
+        defaultRefreshInterval = SIM_INTERVAL;
+        minRefreshInterval = 0;
+    }
+    bool fetch(String& errorMsg) override {
+        ModuleReading* reading = readings.edit(id);
+        reading->lastUpdate = nowSeconds();
+        reading->lastSuccess = true;
+        fetches++;
+        return true;
+    }
+    String formatDisplay() override { return "custom"; }
+    bool needsNetwork() override { return false; }
+};
+
+static const char* SIM_IDS[] = {"bitcoin", "ethereum", "solana", "aapl", "msft", "nvda", "sf", "london"};
+static const uint8_t SIM_COUNT = sizeof(SIM_IDS) / sizeof(SIM_IDS[0]);
+
+struct AgeReport {
+    unsigned long firstDataAt[SIM_COUNT];  // seconds, 0 = none yet
+    unsigned long maxAge[SIM_COUNT];       // after its first reading
+    double ageSum[SIM_COUNT];
+    uint32_t samples[SIM_COUNT];
+    unsigned long maxSwitchAge;            // Age of the module a button press showed
+    uint32_t fetches[SIM_COUNT];
+};
+
+static void runDay(bool backgroundRefresh, AgeReport& report) {
+    memset(&report, 0, sizeof(report));
+    config.clear();
+    config["device"]["activeModule"] = SIM_IDS[0];
+    config["device"]["refreshInterval"] = SIM_INTERVAL;
+    config["device"]["backgroundRefresh"] = backgroundRefresh;
+
+    Scheduler scheduler;
+    SimModule* modules[SIM_COUNT];
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        const char* host = i < 3 ? "api.coingecko.com" : i < 6 ? "query1.finance.yahoo.com" : "api.open-meteo.com";
+        modules[i] = new SimModule(SIM_IDS[i], host, 100.0f + i);
+        scheduler.registerModule(modules[i]);
+    }
+    scheduler.registerModule(new LocalModule());
+    scheduler.init();
+
+    uint8_t active = 0;
+    unsigned long lastSample = 0;
+    unsigned long start = millis() / 1000;
+    while (millis() / 1000 - start < SIM_DAY) {
+        hostAdvance(SIM_STEP_MS);
+        fetchWorker.dispatchResults();
+        scheduler.tick();
+
+        unsigned long now = millis() / 1000;
+        unsigned long elapsed = now - start;
+        if (now == lastSample) continue;
+        lastSample = now;
+
+        // Button press: the newly shown module's data should already be fresh
+        if (elapsed % SIM_SWITCH_EVERY == 0) {
+            active = (active + 1) % SIM_COUNT;
+            config["device"]["activeModule"] = SIM_IDS[active];
+            unsigned long age = timestampAge(readings.getLastUpdate(SIM_IDS[active]));
+            if (elapsed > SIM_WARMUP && age != AGE_UNKNOWN && age > report.maxSwitchAge) {
+                report.maxSwitchAge = age;
+            }
+        }
+
+        for (uint8_t i = 0; i < SIM_COUNT; i++) {
+            unsigned long age = timestampAge(readings.getLastUpdate(SIM_IDS[i]));
+            if (age == AGE_UNKNOWN) continue;
+            if (report.firstDataAt[i] == 0) {
+                report.firstDataAt[i] = elapsed;
+            }
+            report.maxAge[i] = max(report.maxAge[i], age);
+            report.ageSum[i] += age;
+            report.samples[i]++;
+        }
+    }
+
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        report.fetches[i] = modules[i]->fetches;
+    }
+}
+
+static void printReport(const char* title, const AgeReport& report) {
+    char line[160];
+    TEST_MESSAGE(title);
+    TEST_MESSAGE("  module      first data   fetches   mean age   max age");
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        double mean = report.samples[i] ? report.ageSum[i] / report.samples[i] : 0;
+        snprintf(line, sizeof(line), "  %-10s %10lus %9u %9.0fs %8lus",
+                 SIM_IDS[i], report.firstDataAt[i], (unsigned)report.fetches[i], mean, report.maxAge[i]);
+        TEST_MESSAGE(line);
+    }
+    snprintf(line, sizeof(line), "  oldest data shown after a button press: %lus", report.maxSwitchAge);
+    TEST_MESSAGE(line);
+}
+
+void setUp() {
+    srand(1);
+    hostUseVirtualTime(1000);
+    readings = ReadingsStore();
+    fetchWorker = FetchWorker();
+    simJobs.clear();
+    simRequests = 0;
+}
+
+void tearDown() {}
+
+void test_background_refresh_keeps_every_module_fresh() {
+    AgeReport report;
+    runDay(true, report);
+    printReport("Background refresh, one day:", report);
+
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        TEST_ASSERT_NOT_EQUAL_MESSAGE(0, report.samples[i], SIM_IDS[i]);
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(SIM_WARMUP, report.firstDataAt[i], SIM_IDS[i]);
+        // Never stale by isCacheStale()'s definition (2x the refresh interval)
+        TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(2 * SIM_INTERVAL, report.maxAge[i], SIM_IDS[i]);
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(2 * SIM_INTERVAL, report.maxSwitchAge);
+}
+
+void test_active_only_refresh_goes_stale() {
+    AgeReport report;
+    runDay(false, report);
+    printReport("Active module only, one day:", report);
+
+    // Modules wait for their turn on screen: far past the staleness limit
+    unsigned long oldest = 0;
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        oldest = max(oldest, report.maxAge[i]);
+    }
+    TEST_ASSERT_GREATER_THAN(2 * SIM_INTERVAL, oldest);
+    TEST_ASSERT_GREATER_THAN(2 * SIM_INTERVAL, report.maxSwitchAge);
+}
+
+void test_offline_pauses_only_network_modules() {
+    config.clear();
+    config["device"]["activeModule"] = "custom";
+    config["device"]["refreshInterval"] = SIM_INTERVAL;
+    config["device"]["backgroundRefresh"] = true;
+
+    Scheduler scheduler;
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        scheduler.registerModule(new SimModule(SIM_IDS[i], "api.coingecko.com", 100.0f));
+    }
+    LocalModule* local = new LocalModule();
+    scheduler.registerModule(local);
+    scheduler.init();
+
+    // An hour without a link: the local module on screen keeps refreshing
+    network.online = false;
+    for (unsigned long ms = 0; ms < 3600000UL; ms += SIM_STEP_MS) {
+        hostAdvance(SIM_STEP_MS);
+        fetchWorker.dispatchResults();
+        scheduler.tick();
+    }
+    char line[96];
+    snprintf(line, sizeof(line), "Offline hour: %u network requests, %u local refreshes",
+             (unsigned)simRequests, (unsigned)local->fetches);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL(0, simRequests);
+    // Once per refresh interval, as when online
+    TEST_ASSERT_GREATER_OR_EQUAL(3600 / SIM_INTERVAL - 1, local->fetches);
+
+    // Link back: every network module catches up
+    network.online = true;
+    for (unsigned long ms = 0; ms < 600000UL; ms += SIM_STEP_MS) {
+        hostAdvance(SIM_STEP_MS);
+        fetchWorker.dispatchResults();
+        scheduler.tick();
+    }
+    snprintf(line, sizeof(line), "Ten minutes back online: %u network requests", (unsigned)simRequests);
+    TEST_MESSAGE(line);
+    for (uint8_t i = 0; i < SIM_COUNT; i++) {
+        TEST_ASSERT_NOT_EQUAL_MESSAGE(0, readings.getLastUpdate(SIM_IDS[i]), SIM_IDS[i]);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_background_refresh_keeps_every_module_fresh);
+    RUN_TEST(test_active_only_refresh_goes_stale);
+    RUN_TEST(test_offline_pauses_only_network_modules);
+    return UNITY_END();
+}